@@ -3,6 +3,7 @@
 #include "../Components/CharacterStatusComponent.h"
 #include "../Components/InventoryComponent.h"
 #include "../Managers/CharacterPresetManager.h"
+#include "../Managers/SimulationRandomManager.h"
 #include "../CharacterGenerator/SpecialtySystem.h"
 #include "../CharacterGenerator/CharacterTalent.h"
 #include "Kismet/GameplayStatics.h"
@@ -32,20 +33,24 @@ void AC_BP_GenerateCharacter::GenerateRandomCharacter()
 		return;
 	}
 
+	// 生成ごとにターン・生成器・通し番号をキーにした乱数ストリームを使う
+	FIdleRandomStream RandomStream = USimulationRandomManager::MakeStreamForCurrentTurn(
+		this, EIdleRandomDomain::CharacterGeneration, USimulationRandomManager::GetEntityKey(this), GeneratedCount++);
+	
 	// 1. ランダム専門性取得
-	ESpecialtyType RandomSpecialty = USpecialtySystem::GetRandomSpecialty();
+	ESpecialtyType RandomSpecialty = USpecialtySystem::GetRandomSpecialty(RandomStream);
 	
 	// 2. ランダム才能生成
-	FCharacterTalent BaseTalent = UCharacterTalentGenerator::GenerateRandomTalent();
+	FCharacterTalent BaseTalent = UCharacterTalentGenerator::GenerateRandomTalent(RandomStream);
 	
 	// 3. 専門性ボーナス適用
-	FCharacterTalent FinalTalent = UCharacterTalentGenerator::ApplySpecialtyBonus(BaseTalent, RandomSpecialty);
+	FCharacterTalent FinalTalent = UCharacterTalentGenerator::ApplySpecialtyBonus(BaseTalent, RandomSpecialty, RandomStream);
 	
 	// 4. ステータス計算
 	FCharacterStatus CalculatedStatus = UCharacterStatusManager::CalculateMaxStatus(FinalTalent);
 	
 	// 5. ランダム名前生成
-	FString RandomName = GenerateRandomName();
+	FString RandomName = GenerateRandomName(RandomStream);
 	
 	// 6. キャラクタースポーン
 	FVector SpawnLocation = GetActorLocation();
@@ -65,6 +70,7 @@ void AC_BP_GenerateCharacter::GenerateRandomCharacter()
 	{
 		// 名前設定
 		SpawnedActor->SetCharacterName(RandomName);
+		SpawnedActor->SetCharacterId(RandomStream.NextGuid());
 		
 		// ステータスコンポーネントにデータ設定
 		if (UCharacterStatusComponent* StatusComp = SpawnedActor->GetStatusComponent())
@@ -92,7 +98,7 @@ void AC_BP_GenerateCharacter::GenerateRandomCharacter()
 	// SpawnedActorがnullの場合は既に上でログ出力済み
 }
 
-FString AC_BP_GenerateCharacter::GenerateRandomName()
+FString AC_BP_GenerateCharacter::GenerateRandomName(FIdleRandomStream& RandomStream)
 {
 	if (LastNames.Num() == 0)
 	{
@@ -100,7 +106,7 @@ FString AC_BP_GenerateCharacter::GenerateRandomName()
 	}
 	
 	// ランダムに苗字を選択
-	FString LastName = LastNames[FMath::RandRange(0, LastNames.Num() - 1)];
+	FString LastName = LastNames[RandomStream.RandRange(0, LastNames.Num() - 1)];
 	
 	return LastName;
 }
@@ -232,7 +238,9 @@ AC_IdleCharacter* AC_BP_GenerateCharacter::GenerateEnemyAtLocation(
 	}
 
 	// 場所からランダムな敵を選択
-	FString EnemyPresetId = PresetManager->GetRandomEnemyFromLocation(LocationId);
+	FIdleRandomStream RandomStream = USimulationRandomManager::MakeStreamForCurrentTurn(
+		this, EIdleRandomDomain::EnemySpawn, USimulationRandomManager::GetStringKey(LocationId), GeneratedCount++);
+	FString EnemyPresetId = PresetManager->GetRandomEnemyFromLocation(LocationId, RandomStream);
 	if (EnemyPresetId.IsEmpty())
 	{
 		UE_LOG(LogTemp, Warning, TEXT("GenerateEnemyAtLocation: No enemies available at location %s"), *LocationId);
@@ -47,7 +47,10 @@ public:
 
 private:
 	// ランダム名前生成
-	FString GenerateRandomName();
+	FString GenerateRandomName(FIdleRandomStream& RandomStream);
+
+	// 生成の通し番号（同じターンの生成を区別する乱数キー）
+	int32 GeneratedCount = 0;
 
 	// 日本語苗字リスト
 	TArray<FString> LastNames;
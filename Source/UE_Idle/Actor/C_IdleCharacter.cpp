@@ -2,6 +2,7 @@
 
 
 #include "C_IdleCharacter.h"
+#include "../UE_Idle.h"
 #include "../Components/CharacterStatusComponent.h"
 #include "../Components/InventoryComponent.h"
 #include "../Components/CharacterBrain.h"
@@ -15,6 +16,7 @@
 #include "Components/StaticMeshComponent.h"
 #include "Engine/StaticMesh.h"
 #include "../AI/IdleAIController.h"
+#include "../Managers/CharacterRosterManager.h"
 
 // Sets default values
 AC_IdleCharacter::AC_IdleCharacter()
@@ -33,11 +35,11 @@ AC_IdleCharacter::AC_IdleCharacter()
 	FloatingMovement = CreateDefaultSubobject<UPawnMovementComponent>(TEXT("FloatingMovement"));
 	if (FloatingMovement)
 	{
-		UE_LOG(LogTemp, VeryVerbose, TEXT("PawnMovementComponent created successfully"));
+		UE_LOG(LogIdleAI, VeryVerbose, TEXT("PawnMovementComponent created successfully"));
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("Failed to create PawnMovementComponent"));
+		UE_LOG(LogIdleAI, Error, TEXT("Failed to create PawnMovementComponent"));
 	}
 	
 	// 2D表示メッシュ
@@ -53,11 +55,11 @@ AC_IdleCharacter::AC_IdleCharacter()
 		IconMesh->SetCollisionResponseToAllChannels(ECR_Block);
 		IconMesh->SetCollisionResponseToChannel(ECC_Pawn, ECR_Block);
 		
-		UE_LOG(LogTemp, VeryVerbose, TEXT("IconMesh created successfully"));
+		UE_LOG(LogIdleAI, VeryVerbose, TEXT("IconMesh created successfully"));
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("Failed to create IconMesh"));
+		UE_LOG(LogIdleAI, Error, TEXT("Failed to create IconMesh"));
 	}
 	
 	// グリッド位置初期化
@@ -68,17 +70,17 @@ AC_IdleCharacter::AC_IdleCharacter()
 	AIControllerClass = AIdleAIController::StaticClass();
 	AutoPossessAI = EAutoPossessAI::PlacedInWorldOrSpawned;
 	
-	UE_LOG(LogTemp, Warning, TEXT("AC_IdleCharacter: APawn constructor completed"));
+	UE_LOG(LogIdleAI, Verbose, TEXT("AC_IdleCharacter: APawn constructor completed"));
 
 	// コンポーネント作成（防御的チェック付き）
 	StatusComponent = CreateDefaultSubobject<UCharacterStatusComponent>(TEXT("StatusComponent"));
 	if (!StatusComponent)
 	{
-		UE_LOG(LogTemp, Error, TEXT("Failed to create StatusComponent"));
+		UE_LOG(LogIdleAI, Error, TEXT("Failed to create StatusComponent"));
 	}
 	else
 	{
-		UE_LOG(LogTemp, VeryVerbose, TEXT("StatusComponent created successfully"));
+		UE_LOG(LogIdleAI, VeryVerbose, TEXT("StatusComponent created successfully"));
 	}
 	
 	InventoryComponent = CreateDefaultSubobject<UInventoryComponent>(TEXT("InventoryComponent"));
@@ -86,11 +88,11 @@ AC_IdleCharacter::AC_IdleCharacter()
 	{
 		// Set owner ID for character inventory
 		InventoryComponent->OwnerId = TEXT("Character");
-		UE_LOG(LogTemp, VeryVerbose, TEXT("InventoryComponent created successfully"));
+		UE_LOG(LogIdleAI, VeryVerbose, TEXT("InventoryComponent created successfully"));
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("Failed to create InventoryComponent"));
+		UE_LOG(LogIdleAI, Error, TEXT("Failed to create InventoryComponent"));
 	}
 
 	// ===========================================
@@ -101,11 +103,11 @@ AC_IdleCharacter::AC_IdleCharacter()
 	MyBrain = CreateDefaultSubobject<UCharacterBrain>(TEXT("CharacterBrain"));
 	if (!MyBrain)
 	{
-		UE_LOG(LogTemp, Error, TEXT("Failed to create CharacterBrain"));
+		UE_LOG(LogIdleAI, Error, TEXT("Failed to create CharacterBrain"));
 	}
 	else
 	{
-		UE_LOG(LogTemp, VeryVerbose, TEXT("CharacterBrain created successfully"));
+		UE_LOG(LogIdleAI, VeryVerbose, TEXT("CharacterBrain created successfully"));
 	}
 
 	// デフォルト設定
@@ -124,13 +126,13 @@ void AC_IdleCharacter::BeginPlay()
 	Super::BeginPlay();
 	
 	// デバッグログ追加
-	UE_LOG(LogTemp, Warning, TEXT("C_IdleCharacter::BeginPlay - %s, InventoryComponent: %s"), 
+	UE_LOG(LogIdleAI, Verbose, TEXT("C_IdleCharacter::BeginPlay - %s, InventoryComponent: %s"), 
 		*GetName(), InventoryComponent ? TEXT("Valid") : TEXT("NULL"));
 	
 	// インベントリの装備変更イベントをステータスコンポーネントの再計算に接続
 	if (InventoryComponent && StatusComponent)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("C_IdleCharacter: Binding equipment change events"));
+		UE_LOG(LogIdleAI, Verbose, TEXT("C_IdleCharacter: Binding equipment change events"));
 		
 		// Dynamic multicast delegatesはAddDynamicを使用
 		InventoryComponent->OnItemEquipped.AddDynamic(this, &AC_IdleCharacter::HandleItemEquipped);
@@ -138,7 +140,7 @@ void AC_IdleCharacter::BeginPlay()
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("C_IdleCharacter: Failed to bind equipment events - missing components"));
+		UE_LOG(LogIdleAI, Error, TEXT("C_IdleCharacter: Failed to bind equipment events - missing components"));
 	}
 
 	// ===========================================
@@ -163,14 +165,37 @@ void AC_IdleCharacter::BeginPlay()
 				MyBrain->InitializeReferences(TaskManager, TeamComp, MovementComp);
 				MyBrain->SetPersonality(MyPersonality);
 				
-				UE_LOG(LogTemp, Warning, TEXT("🧠 Autonomous system initialized for character %s"), *CharacterName);
+				UE_LOG(LogIdleAI, Log, TEXT("🧠 Autonomous system initialized for character %s"), *CharacterName);
 			}
 			else
 			{
-				UE_LOG(LogTemp, Warning, TEXT("🧠⚠️ Failed to initialize autonomous system - missing components"));
+				UE_LOG(LogIdleAI, Warning, TEXT("🧠⚠️ Failed to initialize autonomous system - missing components"));
 			}
 		}
 	}
+
+	// レベル配置キャラクターのID（生成器でスポーンした場合はこの後で上書きされる）
+	if (!CharacterId.IsValid())
+	{
+		CharacterId = FGuid::NewDeterministicGuid(GetPathName());
+	}
+
+	// ターン処理用の名簿に登録
+	if (UCharacterRosterManager* Roster = UCharacterRosterManager::Get(this))
+	{
+		Roster->RegisterCharacter(this);
+	}
+}
+
+void AC_IdleCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// 名簿から登録解除
+	if (UCharacterRosterManager* Roster = UCharacterRosterManager::Get(this))
+	{
+		Roster->UnregisterCharacter(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 // Called every frame
@@ -182,7 +207,7 @@ void AC_IdleCharacter::Tick(float DeltaTime)
 // Equipment change handlers
 void AC_IdleCharacter::HandleItemEquipped(const FString& ItemId, EEquipmentSlot Slot)
 {
-	UE_LOG(LogTemp, Warning, TEXT("C_IdleCharacter: Item equipped - %s in slot %d"), *ItemId, (int32)Slot);
+	UE_LOG(LogIdleAI, Verbose, TEXT("C_IdleCharacter: Item equipped - %s in slot %d"), *ItemId, (int32)Slot);
 	if (StatusComponent)
 	{
 		StatusComponent->OnEquipmentChanged();
@@ -191,7 +216,7 @@ void AC_IdleCharacter::HandleItemEquipped(const FString& ItemId, EEquipmentSlot
 
 void AC_IdleCharacter::HandleItemUnequipped(const FString& ItemId, EEquipmentSlot Slot)
 {
-	UE_LOG(LogTemp, Warning, TEXT("C_IdleCharacter: Item unequipped - %s from slot %d"), *ItemId, (int32)Slot);
+	UE_LOG(LogIdleAI, Verbose, TEXT("C_IdleCharacter: Item unequipped - %s from slot %d"), *ItemId, (int32)Slot);
 	if (StatusComponent)
 	{
 		StatusComponent->OnEquipmentChanged();
@@ -215,13 +240,13 @@ UCharacterStatusComponent* AC_IdleCharacter::GetStatusComponent() const
 {
 	if (!StatusComponent)
 	{
-		UE_LOG(LogTemp, Error, TEXT("GetStatusComponent: StatusComponent is null for character %s"), 
+		UE_LOG(LogIdleAI, Error, TEXT("GetStatusComponent: StatusComponent is null for character %s"), 
 			   CharacterName.IsEmpty() ? TEXT("Unknown") : *CharacterName);
 		return nullptr;
 	}
 	else if (!IsValid(StatusComponent))
 	{
-		UE_LOG(LogTemp, Error, TEXT("GetStatusComponent: StatusComponent is invalid for character %s"), 
+		UE_LOG(LogIdleAI, Error, TEXT("GetStatusComponent: StatusComponent is invalid for character %s"), 
 			   CharacterName.IsEmpty() ? TEXT("Unknown") : *CharacterName);
 		return nullptr;
 	}
@@ -238,14 +263,14 @@ UInventoryComponent* AC_IdleCharacter::GetInventoryComponent() const
 	// 詳細なデバッグログ
 	if (!InventoryComponent)
 	{
-		UE_LOG(LogTemp, VeryVerbose, TEXT("AC_IdleCharacter::GetInventoryComponent - InventoryComponent is NULL for %s"), *GetName());
+		UE_LOG(LogIdleAI, VeryVerbose, TEXT("AC_IdleCharacter::GetInventoryComponent - InventoryComponent is NULL for %s"), *GetName());
 		
 		// const_castを使って、FindComponentByClassを試す（デバッグ用）
 		AC_IdleCharacter* MutableThis = const_cast<AC_IdleCharacter*>(this);
 		UInventoryComponent* FoundComp = MutableThis->FindComponentByClass<UInventoryComponent>();
 		if (FoundComp)
 		{
-			UE_LOG(LogTemp, VeryVerbose, TEXT("AC_IdleCharacter::GetInventoryComponent - Found via FindComponentByClass"));
+			UE_LOG(LogIdleAI, VeryVerbose, TEXT("AC_IdleCharacter::GetInventoryComponent - Found via FindComponentByClass"));
 			return FoundComp;
 		}
 	}
@@ -283,14 +308,14 @@ FDerivedStats AC_IdleCharacter::GetDerivedStats() const
 void AC_IdleCharacter::OnTurnTick(int32 CurrentTurn)
 {
 	// 新しいBehavior Tree自律システムでの実装
-	UE_LOG(LogTemp, Warning, TEXT("🧠 %s: OnTurnTick(Turn %d) - Behavior Tree autonomous processing"), 
+	UE_LOG(LogIdleAI, Verbose, TEXT("🧠 %s: OnTurnTick(Turn %d) - Behavior Tree autonomous processing"), 
 		*CharacterName, CurrentTurn);
 
 	// AIControllerからBehavior Treeを再開（毎ターン新しい判断）
 	if (auto* AIController = GetController<AIdleAIController>())
 	{
 		AIController->RestartBehaviorTree();
-		UE_LOG(LogTemp, Warning, TEXT("🧠🔄 %s: Behavior Tree restarted for fresh decision"), 
+		UE_LOG(LogIdleAI, Verbose, TEXT("🧠🔄 %s: Behavior Tree restarted for fresh decision"), 
 			*CharacterName);
 	}
 	else
@@ -298,7 +323,7 @@ void AC_IdleCharacter::OnTurnTick(int32 CurrentTurn)
 		// フォールバック：旧システムが残っている場合
 		if (bAutonomousSystemEnabled && MyBrain)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("🧠⚠️ %s: Using fallback CharacterBrain system"), *CharacterName);
+			UE_LOG(LogIdleAI, Verbose, TEXT("🧠⚠️ %s: Using fallback CharacterBrain system"), *CharacterName);
 			
 			// 自律的な判断プロセスを実行
 			AnalyzeMySituation();
@@ -309,7 +334,7 @@ void AC_IdleCharacter::OnTurnTick(int32 CurrentTurn)
 			// デバッグ情報表示
 			if (bShowDebugInfo)
 			{
-				UE_LOG(LogTemp, Warning, TEXT("🧠📊 %s: Decided action %d (%s)"), 
+				UE_LOG(LogIdleAI, Verbose, TEXT("🧠📊 %s: Decided action %d (%s)"), 
 					*CharacterName, 
 					(int32)PlannedAction.ActionType, 
 					*PlannedAction.ActionReason);
@@ -318,6 +343,33 @@ void AC_IdleCharacter::OnTurnTick(int32 CurrentTurn)
 	}
 }
 
+bool AC_IdleCharacter::UsesBrainTurnPipeline() const
+{
+	// OnTurnTickと同じ分岐：AIControllerがあればBehavior Tree側で処理
+	return !GetController<AIdleAIController>() && bAutonomousSystemEnabled && MyBrain;
+}
+
+void AC_IdleCharacter::PrepareTurnSnapshot()
+{
+	AnalyzeMySituation();
+	ConsultMyTeam();
+}
+
+void AC_IdleCharacter::CommitTurnDecision(const FCharacterAction& InitialAction)
+{
+	ResolvePlannedAction(InitialAction);
+	ExecuteMyAction();
+
+	// デバッグ情報表示
+	if (bShowDebugInfo)
+	{
+		UE_LOG(LogIdleAI, Verbose, TEXT("🧠📊 %s: Decided action %d (%s)"), 
+			*CharacterName, 
+			(int32)PlannedAction.ActionType, 
+			*PlannedAction.ActionReason);
+	}
+}
+
 void AC_IdleCharacter::SetPersonality(ECharacterPersonality NewPersonality)
 {
 	MyPersonality = NewPersonality;
@@ -327,13 +379,13 @@ void AC_IdleCharacter::SetPersonality(ECharacterPersonality NewPersonality)
 		MyBrain->SetPersonality(NewPersonality);
 	}
 	
-	UE_LOG(LogTemp, Log, TEXT("🧠 %s: Personality set to %d"), 
+	UE_LOG(LogIdleAI, Log, TEXT("🧠 %s: Personality set to %d"), 
 		*CharacterName, (int32)NewPersonality);
 }
 
 void AC_IdleCharacter::AnalyzeMySituation()
 {
-	UE_LOG(LogTemp, VeryVerbose, TEXT("🧠🔍 %s: Starting situation analysis"), *CharacterName);
+	UE_LOG(LogIdleAI, VeryVerbose, TEXT("🧠🔍 %s: Starting situation analysis"), *CharacterName);
 	
 	// 現在地の取得（LocationMovementComponentから直接）
 	// GetCurrentLocationDirect()が存在しないため一時的に"base"に設定
@@ -367,7 +419,7 @@ void AC_IdleCharacter::AnalyzeMySituation()
 					CurrentSituation.TeamAssignedTask = Team.AssignedTask;
 					CurrentSituation.Teammates = Team.Members;
 					
-					UE_LOG(LogTemp, VeryVerbose, TEXT("🧠👥 %s: Found in Team %d, assigned task: %d"), 
+					UE_LOG(LogIdleAI, VeryVerbose, TEXT("🧠👥 %s: Found in Team %d, assigned task: %d"), 
 						*CharacterName, i, (int32)Team.AssignedTask);
 					break;
 				}
@@ -375,17 +427,17 @@ void AC_IdleCharacter::AnalyzeMySituation()
 			
 			if (CurrentSituation.MyTeamIndex == -1)
 			{
-				UE_LOG(LogTemp, Warning, TEXT("🧠⚠️ %s: Not assigned to any team!"), *CharacterName);
+				UE_LOG(LogIdleAI, Verbose, TEXT("🧠⚠️ %s: Not assigned to any team!"), *CharacterName);
 			}
 		}
 		else
 		{
-			UE_LOG(LogTemp, Warning, TEXT("🧠⚠️ %s: TeamComponent not found!"), *CharacterName);
+			UE_LOG(LogIdleAI, Warning, TEXT("🧠⚠️ %s: TeamComponent not found!"), *CharacterName);
 		}
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("🧠⚠️ %s: PlayerController not found!"), *CharacterName);
+		UE_LOG(LogIdleAI, Warning, TEXT("🧠⚠️ %s: PlayerController not found!"), *CharacterName);
 	}
 
 	// 利用可能タスクの取得（TaskInformationService削除により一時的に無効化）
@@ -405,7 +457,7 @@ void AC_IdleCharacter::AnalyzeMySituation()
 	// 危険地域判定（簡易版）
 	CurrentSituation.bDangerousArea = (CurrentSituation.CurrentLocation != TEXT("base"));
 
-	UE_LOG(LogTemp, VeryVerbose, TEXT("🧠🔍 %s: Situation analyzed - Location: %s, Team: %d, Task: %d"), 
+	UE_LOG(LogIdleAI, VeryVerbose, TEXT("🧠🔍 %s: Situation analyzed - Location: %s, Team: %d, Task: %d"), 
 		*CharacterName, 
 		*CurrentSituation.CurrentLocation, 
 		CurrentSituation.MyTeamIndex, 
@@ -419,7 +471,7 @@ void AC_IdleCharacter::ConsultMyTeam()
 	
 	if (CurrentSituation.MyTeamIndex == -1)
 	{
-		UE_LOG(LogTemp, VeryVerbose, TEXT("🧠👥 %s: Not in any team, skipping team consultation"), *CharacterName);
+		UE_LOG(LogIdleAI, VeryVerbose, TEXT("🧠👥 %s: Not in any team, skipping team consultation"), *CharacterName);
 		return;
 	}
 
@@ -429,14 +481,14 @@ void AC_IdleCharacter::ConsultMyTeam()
 		
 	if (!PlayerController)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("🧠👥⚠️ %s: PlayerController not found"), *CharacterName);
+		UE_LOG(LogIdleAI, Warning, TEXT("🧠👥⚠️ %s: PlayerController not found"), *CharacterName);
 		return;
 	}
 
 	UTeamComponent* TeamComp = PlayerController->FindComponentByClass<UTeamComponent>();
 	if (!TeamComp)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("🧠👥⚠️ %s: TeamComponent not found"), *CharacterName);
+		UE_LOG(LogIdleAI, Warning, TEXT("🧠👥⚠️ %s: TeamComponent not found"), *CharacterName);
 		return;
 	}
 
@@ -452,7 +504,7 @@ void AC_IdleCharacter::ConsultMyTeam()
 	CurrentSituation.TeamRecommendedItem = TeamStrategy.RecommendedTargetItem;
 	CurrentSituation.TeamStrategyReason = TeamStrategy.StrategyReason;
 	
-	UE_LOG(LogTemp, Verbose, TEXT("🧠👥📋 %s: Team strategy - Task: %d, Location: %s, Item: %s"), 
+	UE_LOG(LogIdleAI, Verbose, TEXT("🧠👥📋 %s: Team strategy - Task: %d, Location: %s, Item: %s"), 
 		*CharacterName, 
 		(int32)TeamStrategy.RecommendedTaskType,
 		*TeamStrategy.RecommendedLocation,
@@ -472,7 +524,7 @@ void AC_IdleCharacter::ConsultMyTeam()
 	CurrentSituation.bTeamNeedsCoordination = DetailedTeamInfo.bNeedsCoordination;
 	CurrentSituation.TeamCoordinationMessage = DetailedTeamInfo.CoordinationMessage;
 	
-	UE_LOG(LogTemp, Verbose, TEXT("🧠👥📊 %s: Team info - Members: %d/%d, State: %d, Target: %s"), 
+	UE_LOG(LogIdleAI, Verbose, TEXT("🧠👥📊 %s: Team info - Members: %d/%d, State: %d, Target: %s"), 
 		*CharacterName, 
 		DetailedTeamInfo.ActiveMembers,
 		DetailedTeamInfo.TotalMembers,
@@ -485,7 +537,7 @@ void AC_IdleCharacter::ConsultMyTeam()
 	
 	if (CurrentSituation.bTeamNeedsCoordination)
 	{
-		UE_LOG(LogTemp, Log, TEXT("🧠👥🤝 %s: Team coordination needed - %s"), 
+		UE_LOG(LogIdleAI, Verbose, TEXT("🧠👥🤝 %s: Team coordination needed - %s"), 
 			*CharacterName, 
 			*CurrentSituation.TeamCoordinationMessage);
 			
@@ -514,7 +566,7 @@ void AC_IdleCharacter::ConsultMyTeam()
 	                                   MyPersonality == ECharacterPersonality::Defensive);
 	CurrentSituation.bPersonallyCooperative = bPersonalitySupportsTeamwork;
 
-	UE_LOG(LogTemp, VeryVerbose, TEXT("🧠👥✅ %s: Team consultation completed - Strategy priority: %d, Should coordinate: %s, Team efficiency: %.2f"), 
+	UE_LOG(LogIdleAI, VeryVerbose, TEXT("🧠👥✅ %s: Team consultation completed - Strategy priority: %d, Should coordinate: %s, Team efficiency: %.2f"), 
 		*CharacterName, 
 		TeamStrategy.StrategyPriority,
 		CurrentSituation.bShouldCoordinateAction ? TEXT("Yes") : TEXT("No"),
@@ -525,13 +577,13 @@ void AC_IdleCharacter::DecideMyAction()
 {
 	if (!MyBrain)
 	{
-		UE_LOG(LogTemp, Error, TEXT("🧠❌ %s: MyBrain is null - using default wait action"), *CharacterName);
+		UE_LOG(LogIdleAI, Error, TEXT("🧠❌ %s: MyBrain is null - using default wait action"), *CharacterName);
 		PlannedAction = FCharacterAction(); // デフォルトアクション（待機）
 		PlannedAction.ActionReason = TEXT("No brain available");
 		return;
 	}
 	
-	UE_LOG(LogTemp, VeryVerbose, TEXT("🧠🎯 %s: Brain available, analyzing situation for decision"), *CharacterName);
+	UE_LOG(LogIdleAI, VeryVerbose, TEXT("🧠🎯 %s: Brain available, analyzing situation for decision"), *CharacterName);
 
 	// ========================================
 	// Phase 2.3: チーム連携を考慮した行動決定
@@ -540,11 +592,16 @@ void AC_IdleCharacter::DecideMyAction()
 	// 1. CharacterBrainに基本的な判断を委譲
 	FCharacterAction InitialAction = MyBrain->DecideOptimalAction(CurrentSituation);
 	
-	UE_LOG(LogTemp, VeryVerbose, TEXT("🧠🎯 %s: Initial action decided - %d (%s)"), 
+	UE_LOG(LogIdleAI, VeryVerbose, TEXT("🧠🎯 %s: Initial action decided - %d (%s)"), 
 		*CharacterName, 
 		(int32)InitialAction.ActionType, 
 		*InitialAction.ActionReason);
 
+	ResolvePlannedAction(InitialAction);
+}
+
+void AC_IdleCharacter::ResolvePlannedAction(const FCharacterAction& InitialAction)
+{
 	// 2. チーム連携が必要な場合の調整処理
 	if (CurrentSituation.bShouldCoordinateAction && CurrentSituation.MyTeamIndex != -1)
 	{
@@ -566,13 +623,13 @@ void AC_IdleCharacter::DecideMyAction()
 					PlannedAction = InitialAction;
 					PlannedAction.ActionReason += TEXT(" (Team coordinated)");
 					
-					UE_LOG(LogTemp, Verbose, TEXT("🧠👥✅ %s: Action approved by team coordination"), 
+					UE_LOG(LogIdleAI, Verbose, TEXT("🧠👥✅ %s: Action approved by team coordination"), 
 						*CharacterName);
 				}
 				else
 				{
 					// 行動が調整された場合は代替案を検討
-					UE_LOG(LogTemp, Verbose, TEXT("🧠👥🔄 %s: Action adjustment needed by team"), 
+					UE_LOG(LogIdleAI, Verbose, TEXT("🧠👥🔄 %s: Action adjustment needed by team"), 
 						*CharacterName);
 					
 					// 代替行動を決定（チーム戦略に基づく）
@@ -612,7 +669,7 @@ void AC_IdleCharacter::DecideMyAction()
 		}
 	}
 	
-	UE_LOG(LogTemp, VeryVerbose, TEXT("🧠🎯✅ %s: Final action decided - %d (%s)"), 
+	UE_LOG(LogIdleAI, VeryVerbose, TEXT("🧠🎯✅ %s: Final action decided - %d (%s)"), 
 		*CharacterName, 
 		(int32)PlannedAction.ActionType, 
 		*PlannedAction.ActionReason);
@@ -659,7 +716,7 @@ FCharacterAction AC_IdleCharacter::DetermineAdjustedAction()
 		AdjustedAction.ActionReason = TEXT("Team coordination: No specific task assigned");
 	}
 	
-	UE_LOG(LogTemp, Verbose, TEXT("🧠👥🔄 %s: Adjusted action - %d (%s)"), 
+	UE_LOG(LogIdleAI, Verbose, TEXT("🧠👥🔄 %s: Adjusted action - %d (%s)"), 
 		*CharacterName, 
 		(int32)AdjustedAction.ActionType, 
 		*AdjustedAction.ActionReason);
@@ -693,7 +750,7 @@ FCharacterAction AC_IdleCharacter::AlignActionWithTeamStrategy(const FCharacterA
 		AlignedAction.ActionReason += TEXT(" (Aligned with team target item)");
 	}
 	
-	UE_LOG(LogTemp, VeryVerbose, TEXT("🧠👥📋 %s: Action aligned with team strategy"), *CharacterName);
+	UE_LOG(LogIdleAI, VeryVerbose, TEXT("🧠👥📋 %s: Action aligned with team strategy"), *CharacterName);
 	
 	return AlignedAction;
 }
@@ -703,7 +760,7 @@ void AC_IdleCharacter::ExecuteMyAction()
 	if (PlannedAction.ActionType == ECharacterActionType::Wait)
 	{
 		// 待機の場合は何もしない
-		UE_LOG(LogTemp, VeryVerbose, TEXT("🧠💤 %s: Executing wait action"), *CharacterName);
+		UE_LOG(LogIdleAI, VeryVerbose, TEXT("🧠💤 %s: Executing wait action"), *CharacterName);
 		return;
 	}
 
@@ -734,7 +791,7 @@ void AC_IdleCharacter::ExecuteMyAction()
 			break;
 			
 		default:
-			UE_LOG(LogTemp, Warning, TEXT("🧠⚠️ %s: Unhandled action type %d"), 
+			UE_LOG(LogIdleAI, Warning, TEXT("🧠⚠️ %s: Unhandled action type %d"), 
 				*CharacterName, (int32)PlannedAction.ActionType);
 			break;
 	}
@@ -742,7 +799,7 @@ void AC_IdleCharacter::ExecuteMyAction()
 
 void AC_IdleCharacter::CheckAndUpdateActionProgress()
 {
-	UE_LOG(LogTemp, VeryVerbose, TEXT("🧠🔄 %s: Checking action progress for %d"), 
+	UE_LOG(LogIdleAI, VeryVerbose, TEXT("🧠🔄 %s: Checking action progress for %d"), 
 		*CharacterName, (int32)PlannedAction.ActionType);
 	
 	// 移動アクションの場合：移動完了をチェック
@@ -753,19 +810,19 @@ void AC_IdleCharacter::CheckAndUpdateActionProgress()
 			bool bMovementCompleted = CheckMovementProgressDirect();
 			if (bMovementCompleted)
 			{
-				UE_LOG(LogTemp, Warning, TEXT("🧠✅ %s: Movement completed! Analyzing new situation..."), *CharacterName);
+				UE_LOG(LogIdleAI, Verbose, TEXT("🧠✅ %s: Movement completed! Analyzing new situation..."), *CharacterName);
 				
 				// 移動完了：状況を再分析して次の行動を決定
 				AnalyzeMySituation();
 				ConsultMyTeam(); 
 				DecideMyAction();
 				
-				UE_LOG(LogTemp, Warning, TEXT("🧠🔄 %s: New action after movement: %d (%s)"), 
+				UE_LOG(LogIdleAI, Verbose, TEXT("🧠🔄 %s: New action after movement: %d (%s)"), 
 					*CharacterName, (int32)PlannedAction.ActionType, *PlannedAction.ActionReason);
 			}
 			else
 			{
-				UE_LOG(LogTemp, VeryVerbose, TEXT("🧠🚶 %s: Still moving... waiting for completion"), *CharacterName);
+				UE_LOG(LogIdleAI, VeryVerbose, TEXT("🧠🚶 %s: Still moving... waiting for completion"), *CharacterName);
 			}
 		}
 	}
@@ -781,7 +838,7 @@ void AC_IdleCharacter::ExecuteMovementAction()
 {
 	bool bSuccess = MoveToLocationDirect(PlannedAction.TargetLocation);
 	
-	UE_LOG(LogTemp, VeryVerbose, TEXT("🧠🚶 %s: Movement to %s %s"), 
+	UE_LOG(LogIdleAI, VeryVerbose, TEXT("🧠🚶 %s: Movement to %s %s"), 
 		*CharacterName, 
 		*PlannedAction.TargetLocation, 
 		bSuccess ? TEXT("started") : TEXT("failed"));
@@ -793,14 +850,14 @@ void AC_IdleCharacter::ExecuteGatheringAction()
 	AC_PlayerController* PC = Cast<AC_PlayerController>(UGameplayStatics::GetPlayerController(GetWorld(), 0));
 	if (!PC)
 	{
-		UE_LOG(LogTemp, Error, TEXT("🧠❌ %s: PlayerController not available"), *CharacterName);
+		UE_LOG(LogIdleAI, Error, TEXT("🧠❌ %s: PlayerController not available"), *CharacterName);
 		return;
 	}
 	
 	UTaskManagerComponent* TaskManager = PC->FindComponentByClass<UTaskManagerComponent>();
 	if (!TaskManager)
 	{
-		UE_LOG(LogTemp, Error, TEXT("🧠❌ %s: TaskManager not available"), *CharacterName);
+		UE_LOG(LogIdleAI, Error, TEXT("🧠❌ %s: TaskManager not available"), *CharacterName);
 		return;
 	}
 	
@@ -822,7 +879,7 @@ void AC_IdleCharacter::ExecuteGatheringAction()
 	
 	if (MyTeamIndex == -1)
 	{
-		UE_LOG(LogTemp, Error, TEXT("🧠❌ %s: Could not find team index"), *CharacterName);
+		UE_LOG(LogIdleAI, Error, TEXT("🧠❌ %s: Could not find team index"), *CharacterName);
 		return;
 	}
 	
@@ -831,7 +888,7 @@ void AC_IdleCharacter::ExecuteGatheringAction()
 	
 	bool bSuccess = TaskManager->ExecuteGathering(MyTeamIndex, PlannedAction.TargetItem, CurrentLocation);
 	
-	UE_LOG(LogTemp, VeryVerbose, TEXT("🧠⛏️ %s: Gathering %s %s"), 
+	UE_LOG(LogIdleAI, VeryVerbose, TEXT("🧠⛏️ %s: Gathering %s %s"), 
 		*CharacterName, 
 		*PlannedAction.TargetItem, 
 		bSuccess ? TEXT("started") : TEXT("failed"));
@@ -840,10 +897,10 @@ void AC_IdleCharacter::ExecuteGatheringAction()
 void AC_IdleCharacter::ExecuteCombatAction()
 {
 	// 戦闘機能は未実装
-	UE_LOG(LogTemp, Warning, TEXT("🧠⚔️ %s: Combat action not yet implemented"), *CharacterName);
+	UE_LOG(LogIdleAI, Verbose, TEXT("🧠⚔️ %s: Combat action not yet implemented"), *CharacterName);
 	bool bSuccess = false;
 	
-	UE_LOG(LogTemp, VeryVerbose, TEXT("🧠⚔️ %s: Combat at %s %s"), 
+	UE_LOG(LogIdleAI, VeryVerbose, TEXT("🧠⚔️ %s: Combat at %s %s"), 
 		*CharacterName, 
 		*PlannedAction.TargetLocation, 
 		bSuccess ? TEXT("started") : TEXT("failed"));
@@ -863,7 +920,7 @@ void AC_IdleCharacter::ExecuteReturnAction()
 void AC_IdleCharacter::ExecuteUnloadAction()
 {
 	FString CharName = GetName();
-	UE_LOG(LogTemp, Warning, TEXT("🧠📦 %s: Executing unload action"), *CharName);
+	UE_LOG(LogIdleAI, Verbose, TEXT("🧠📦 %s: Executing unload action"), *CharName);
 	
 	// PlayerControllerを取得して荷下ろし
 	AC_PlayerController* PlayerController = Cast<AC_PlayerController>(
@@ -871,75 +928,62 @@ void AC_IdleCharacter::ExecuteUnloadAction()
 	
 	if (!PlayerController)
 	{
-		UE_LOG(LogTemp, Error, TEXT("🧠❌ %s: PlayerController not found for unload"), *CharName);
+		UE_LOG(LogIdleAI, Error, TEXT("🧠❌ %s: PlayerController not found for unload"), *CharName);
 		return;
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("🧠📦 %s: PlayerController found, checking inventory"), *CharName);
+	UE_LOG(LogIdleAI, Verbose, TEXT("🧠📦 %s: PlayerController found, checking inventory"), *CharName);
 	
 	// InventoryComponentを取得（既存のメンバ変数とFindComponentの両方を試す）
 	UInventoryComponent* MyInventory = InventoryComponent;
 	if (!MyInventory)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("🧠📦 %s: InventoryComponent member is null, trying FindComponentByClass"), *CharName);
+		UE_LOG(LogIdleAI, Verbose, TEXT("🧠📦 %s: InventoryComponent member is null, trying FindComponentByClass"), *CharName);
 		MyInventory = FindComponentByClass<UInventoryComponent>();
 	}
 	
 	if (!MyInventory)
 	{
-		UE_LOG(LogTemp, Error, TEXT("🧠❌ %s: InventoryComponent not found"), *CharName);
+		UE_LOG(LogIdleAI, Error, TEXT("🧠❌ %s: InventoryComponent not found"), *CharName);
 		return;
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("🧠📦 %s: InventoryComponent found, getting items"), *CharName);
+	UE_LOG(LogIdleAI, Verbose, TEXT("🧠📦 %s: InventoryComponent found, getting items"), *CharName);
 	
-	TMap<FString, int32> AllItems = MyInventory->GetAllItems();
+	TMap<FString, int32> AllItems = MyInventory->GetTransferableItems();
 	int32 TransferredCount = 0;
-	
-	UE_LOG(LogTemp, Warning, TEXT("🧠📦 %s: Found %d different item types in inventory"), 
-		*CharName, AllItems.Num());
-	
-	// 全アイテムを転送
 	for (const auto& ItemPair : AllItems)
 	{
-		const FString& ItemId = ItemPair.Key;
-		int32 Quantity = ItemPair.Value;
-		
-		UE_LOG(LogTemp, Warning, TEXT("🧠📦 %s: Processing item %s x %d"), 
-			*CharName, *ItemId, Quantity);
-		
-		// PlayerControllerのAddItemToStorageを直接呼び出し
-		PlayerController->AddItemToStorage_Implementation(ItemId, Quantity);
-		TransferredCount += Quantity;
-		UE_LOG(LogTemp, Warning, TEXT("🧠📦 %s: Transferred %d x %s to storage"), 
-			*CharName, Quantity, *ItemId);
+		TransferredCount += ItemPair.Value;
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("🧠📦 %s: Total items to transfer: %d"), 
-		*CharName, TransferredCount);
+	UE_LOG(LogIdleAI, Verbose, TEXT("🧠📦 %s: Found %d different item types in inventory (%d items)"), 
+		*CharName, AllItems.Num(), TransferredCount);
+	
+	// 全アイテムを倉庫へ一括転送（倉庫に入りきらなければ何も移さない）
+	if (TransferredCount > 0 && !MyInventory->TransferMany(PlayerController->GlobalInventory, AllItems))
+	{
+		UE_LOG(LogIdleAI, Log, TEXT("🧠⚠️ %s: Storage cannot accept %d items, unload skipped"), 
+			*CharName, TransferredCount);
+		return;
+	}
 	
-	// インベントリから転送したアイテムを削除
 	if (TransferredCount > 0)
 	{
-		// 転送済みアイテムを削除
-		for (const auto& ItemPair : AllItems)
-		{
-			MyInventory->RemoveItem(ItemPair.Key, ItemPair.Value);
-		}
-		UE_LOG(LogTemp, Warning, TEXT("🧠✅ %s: Unloaded %d items to storage"), 
+		UE_LOG(LogIdleAI, Verbose, TEXT("🧠✅ %s: Unloaded %d items to storage"), 
 			*CharName, TransferredCount);
 		
 		// 荷下ろし完了後：状況を再分析して次の行動を決定
-		UE_LOG(LogTemp, Warning, TEXT("🧠✅ %s: Unload completed! Analyzing new situation..."), *CharName);
+		UE_LOG(LogIdleAI, Verbose, TEXT("🧠✅ %s: Unload completed! Analyzing new situation..."), *CharName);
 		AnalyzeMySituation();
 		ConsultMyTeam(); 
 		DecideMyAction();
-		UE_LOG(LogTemp, Warning, TEXT("🧠🔄 %s: New action after unload: %d (%s)"), 
+		UE_LOG(LogIdleAI, Verbose, TEXT("🧠🔄 %s: New action after unload: %d (%s)"), 
 			*CharName, (int32)PlannedAction.ActionType, *PlannedAction.ActionReason);
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("🧠📦 %s: No items to unload"), *CharName);
+		UE_LOG(LogIdleAI, Verbose, TEXT("🧠📦 %s: No items to unload"), *CharName);
 	}
 }
 
@@ -32,6 +32,9 @@ protected:
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
 
+	// Called when the actor is removed from play
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 public:	
 	// Called every frame
 	virtual void Tick(float DeltaTime) override;
@@ -57,6 +60,12 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Character")
 	void SetCharacterName(const FString& NewName) { CharacterName = NewName; }
 
+	// 安定キャラクターID取得・設定（乱数キー・リプレイのキャラクター特定に使う）
+	UFUNCTION(BlueprintPure, Category = "Character")
+	FGuid GetCharacterId() const { return CharacterId; }
+
+	void SetCharacterId(const FGuid& NewId) { CharacterId = NewId; }
+
 	// キャラクター種族取得・設定
 	UFUNCTION(BlueprintCallable, Category = "Character")
 	FString GetCharacterRace() const { return CharacterRace; }
@@ -80,6 +89,28 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Autonomous Character")
 	void OnTurnTick(int32 CurrentTurn);
 
+	// ===========================================
+	// フェーズ分割ターン処理（TimeManagerから呼ばれる）
+	// ===========================================
+
+	/**
+	 * CharacterBrainによるフェーズ分割処理の対象か
+	 * Behavior Treeで動くキャラクターはOnTurnTickをそのまま使う
+	 */
+	bool UsesBrainTurnPipeline() const;
+
+	/**
+	 * スナップショットフェーズ：状況分析とチーム情報取得（ゲームスレッド）
+	 * 自分のCurrentSituationのみを更新する
+	 */
+	void PrepareTurnSnapshot();
+
+	/**
+	 * コミットフェーズ：判断フェーズの結果にチーム調整を適用して実行（ゲームスレッド）
+	 * @param InitialAction 判断フェーズでCharacterBrainが決定した行動
+	 */
+	void CommitTurnDecision(const FCharacterAction& InitialAction);
+
 	/**
 	 * キャラクターの性格を設定
 	 * @param NewPersonality 新しい性格
@@ -135,6 +166,12 @@ protected:
 	 */
 	void DecideMyAction();
 
+	/**
+	 * CharacterBrainの初期判断にチーム調整を適用し、PlannedActionを確定
+	 * @param InitialAction CharacterBrainが決定した行動
+	 */
+	void ResolvePlannedAction(const FCharacterAction& InitialAction);
+
 	/**
 	 * 決定された行動を実行
 	 */
@@ -217,6 +254,11 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Character")
 	FString CharacterName = TEXT("Idle Character");
 
+	// セッションをまたいで変わらないキャラクターID
+	// 生成器が乱数系列から割り当てる。未設定ならBeginPlayでパス名から決める（レベル配置用）
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Character")
+	FGuid CharacterId;
+
 	// キャラクターの種族（CharacterPresets.csvのRowNameに対応）
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Character")
 	FString CharacterRace = TEXT("human");
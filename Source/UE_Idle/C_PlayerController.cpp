@@ -1,6 +1,7 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "C_PlayerController.h"
+#include "UE_Idle.h"
 #include "Components/InventoryComponent.h"
 #include "Components/TeamComponent.h"
 #include "Components/EventLogManager.h"
@@ -12,6 +13,8 @@
 #include "Components/BaseComponent.h"
 #include "Components/GridMapComponent.h"
 #include "Components/MapGeneratorComponent.h"
+#include "Managers/SimulationReplayManager.h"
+#include "Managers/TaskAllocationSolver.h"
 #include "Actor/C_IdleCharacter.h"
 #include "UI/C__InventoryList.h"
 #include "UI/C_TaskList.h"
@@ -495,6 +498,149 @@ void AC_PlayerController::StopTaskSystemCpp()
 	}
 }
 
+void AC_PlayerController::IdleFastForward(int32 NumTurns)
+{
+	if (!TimeManager)
+	{
+		UE_LOG(LogIdleSim, Error, TEXT("IdleFastForward: TimeManager is NULL"));
+		return;
+	}
+
+	const float TurnsPerSecond = TimeManager->FastForwardTurns(NumTurns);
+	ClientMessage(FString::Printf(TEXT("Fast-forwarded %d turns (%.1f turns/sec), now at turn %d"),
+		NumTurns, TurnsPerSecond, TimeManager->GetCurrentTurn()));
+}
+
+void AC_PlayerController::IdleOfflineProgress(float ElapsedSeconds)
+{
+	if (!TimeManager)
+	{
+		UE_LOG(LogIdleSim, Error, TEXT("IdleOfflineProgress: TimeManager is NULL"));
+		return;
+	}
+
+	const int32 Segments = TimeManager->ApplyOfflineProgress(ElapsedSeconds);
+	ClientMessage(FString::Printf(TEXT("Applied %.0f s of offline progress (%d segments), now at turn %d"),
+		ElapsedSeconds, Segments, TimeManager->GetCurrentTurn()));
+}
+
+void AC_PlayerController::IdleTurnBudget(float BudgetMs)
+{
+	if (!TimeManager)
+	{
+		UE_LOG(LogIdleSim, Error, TEXT("IdleTurnBudget: TimeManager is NULL"));
+		return;
+	}
+
+	if (BudgetMs > 0.0f)
+	{
+		TimeManager->SetCharacterTurnBudget(BudgetMs);
+		TimeManager->ResetTurnBudgetStats();
+	}
+
+	const FTurnBudgetStats Stats = TimeManager->GetTurnBudgetStats();
+	ClientMessage(FString::Printf(TEXT("Turn budget: worst frame %.2f ms (last turn %.2f ms over %d frames), backlog %d (peak %d), forced flushes %d"),
+		Stats.WorstFrameMs, Stats.LastTurnWorstFrameMs, Stats.LastTurnFrameCount, Stats.Backlog, Stats.PeakBacklog, Stats.ForcedFlushCount));
+}
+
+void AC_PlayerController::IdleReplayRecord()
+{
+	USimulationReplayManager* ReplayManager = USimulationReplayManager::Get(this);
+	if (!ReplayManager)
+	{
+		UE_LOG(LogIdleSim, Error, TEXT("IdleReplayRecord: SimulationReplayManager is NULL"));
+		return;
+	}
+
+	ReplayManager->StartRecording();
+	ClientMessage(FString::Printf(TEXT("Replay recording started at turn %d"), ReplayManager->GetCurrentRecording().StartTurn));
+}
+
+void AC_PlayerController::IdleReplaySave(const FString& RecordingName)
+{
+	USimulationReplayManager* ReplayManager = USimulationReplayManager::Get(this);
+	if (!ReplayManager || RecordingName.IsEmpty())
+	{
+		UE_LOG(LogIdleSim, Error, TEXT("IdleReplaySave: SimulationReplayManager is NULL or name is empty"));
+		return;
+	}
+
+	ReplayManager->StopRecording();
+	const bool bSaved = ReplayManager->SaveRecording(RecordingName);
+	ClientMessage(FString::Printf(TEXT("Replay '%s' %s (%d commands, turns %d -> %d)"),
+		*RecordingName, bSaved ? TEXT("saved") : TEXT("failed to save"),
+		ReplayManager->GetCurrentRecording().Commands.Num(),
+		ReplayManager->GetCurrentRecording().StartTurn, ReplayManager->GetCurrentRecording().EndTurn));
+}
+
+void AC_PlayerController::IdleReplayRun(const FString& RecordingName)
+{
+	USimulationReplayManager* ReplayManager = USimulationReplayManager::Get(this);
+	if (!ReplayManager)
+	{
+		UE_LOG(LogIdleSim, Error, TEXT("IdleReplayRun: SimulationReplayManager is NULL"));
+		return;
+	}
+
+	FIdleReplayRecording Recording;
+	if (!ReplayManager->LoadRecording(RecordingName, Recording))
+	{
+		ClientMessage(FString::Printf(TEXT("Replay '%s' not found"), *RecordingName));
+		return;
+	}
+
+	const FIdleReplayBenchmarkResult Result = ReplayManager->RunReplay(Recording);
+	ClientMessage(FString::Printf(TEXT("Replay '%s': %d turns in %.3f s (%.1f turns/sec), %d commands (%d failed), memory %.1f -> %.1f MB (peak %.1f MB)"),
+		*RecordingName, Result.SimulatedTurns, Result.ElapsedSeconds, Result.TurnsPerSecond,
+		Result.CommandsApplied + Result.CommandsFailed, Result.CommandsFailed,
+		Result.UsedMemoryBeforeMB, Result.UsedMemoryAfterMB, Result.PeakMemoryMB));
+}
+
+void AC_PlayerController::IdleAllocationBenchmark(int32 NumTeams, int32 NumTasks)
+{
+	const FTaskAllocationBenchmarkResult Result = UTaskAllocationSolver::RunBenchmark(
+		NumTeams > 0 ? NumTeams : 100, NumTasks > 0 ? NumTasks : 1000);
+
+	ClientMessage(FString::Printf(TEXT("Allocation %d teams x %d tasks: build %.3f ms, solve %.3f ms (cost %.1f, %d distinct tasks), greedy %.3f ms (cost %.1f, %d distinct tasks)"),
+		Result.TeamCount, Result.TaskCount, Result.BuildMatrixMs, Result.SolveMs, Result.TotalCost, Result.DistinctTasks,
+		Result.GreedyMs, Result.GreedyTotalCost, Result.GreedyDistinctTasks));
+}
+
+void AC_PlayerController::IdleInventoryBenchmark(int32 NumItemTypes)
+{
+	TArray<int32> Sizes;
+	if (NumItemTypes > 0)
+	{
+		Sizes.Add(NumItemTypes);
+	}
+	else
+	{
+		Sizes = { 10, 100, 1000 };
+	}
+
+	for (int32 Size : Sizes)
+	{
+		const FInventorySlotBenchmarkResult Result = UInventoryComponent::RunSlotIndexBenchmark(Size);
+		ClientMessage(FString::Printf(TEXT("Inventory %d item types x %d ops: lookup linear %.3f ms / indexed %.3f ms, churn linear %.3f ms / indexed %.3f ms"),
+			Result.ItemTypeCount, Result.OperationCount, Result.LinearLookupMs, Result.IndexedLookupMs,
+			Result.LinearChurnMs, Result.IndexedChurnMs));
+	}
+}
+
+void AC_PlayerController::IdleSetLogVerbosity(const FString& CategoryName, const FString& VerbosityName)
+{
+	const ELogVerbosity::Type Verbosity = ParseLogVerbosityFromString(VerbosityName);
+	if (Verbosity == ELogVerbosity::NoLogging && !VerbosityName.Equals(TEXT("NoLogging"), ESearchCase::IgnoreCase))
+	{
+		ClientMessage(FString::Printf(TEXT("Unknown verbosity '%s' (Fatal/Error/Warning/Display/Log/Verbose/VeryVerbose)"), *VerbosityName));
+		return;
+	}
+
+	const bool bApplied = IdleLog::SetVerbosity(CategoryName, Verbosity);
+	ClientMessage(FString::Printf(TEXT("IdleSetLogVerbosity %s -> %s: %s"), *CategoryName, ToString(Verbosity),
+		bApplied ? TEXT("applied") : TEXT("unknown category (Time/Task/Inventory/Combat/AI/Sim/All)")));
+}
+
 // C++専用初期化システム（Blueprint機能とは独立）
 void AC_PlayerController::InitializeGatheringSystemCpp()
 {
@@ -518,6 +664,7 @@ void AC_PlayerController::InitializeTaskManagementSystem()
 		// TaskManager references
 		TaskManager->SetGlobalInventoryReference(GlobalInventory);
 		TaskManager->SetTeamComponentReference(TeamComponent);
+		TaskManager->SetCraftingComponentReference(CraftingComponent);
 		
 		UE_LOG(LogTemp, Log, TEXT("AC_PlayerController: TaskManager references set"));
 	}
@@ -145,6 +145,42 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Task Management Debug")
 	void StopTaskSystemCpp();
 
+	// コンソールコマンド: IdleFastForward <ターン数>
+	UFUNCTION(Exec, Category = "Task Management Debug")
+	void IdleFastForward(int32 NumTurns);
+
+	// コンソールコマンド: IdleOfflineProgress <経過秒数>
+	UFUNCTION(Exec, Category = "Task Management Debug")
+	void IdleOfflineProgress(float ElapsedSeconds);
+
+	// コンソールコマンド: IdleTurnBudget <ミリ秒>（0以下で統計表示のみ）
+	UFUNCTION(Exec, Category = "Task Management Debug")
+	void IdleTurnBudget(float BudgetMs);
+
+	// コンソールコマンド: IdleReplayRecord（プレイヤー操作の記録開始）
+	UFUNCTION(Exec, Category = "Task Management Debug")
+	void IdleReplayRecord();
+
+	// コンソールコマンド: IdleReplaySave <名前>（記録終了して保存）
+	UFUNCTION(Exec, Category = "Task Management Debug")
+	void IdleReplaySave(const FString& RecordingName);
+
+	// コンソールコマンド: IdleReplayRun <名前>（記録をヘッドレス再生してベンチマーク）
+	UFUNCTION(Exec, Category = "Task Management Debug")
+	void IdleReplayRun(const FString& RecordingName);
+
+	// コンソールコマンド: IdleAllocationBenchmark <チーム数> <タスク数>（0で100チーム × 1000タスク）
+	UFUNCTION(Exec, Category = "Task Management Debug")
+	void IdleAllocationBenchmark(int32 NumTeams, int32 NumTasks);
+
+	// コンソールコマンド: IdleInventoryBenchmark <アイテム種類数>（0で10/100/1000種類を順に計測）
+	UFUNCTION(Exec, Category = "Task Management Debug")
+	void IdleInventoryBenchmark(int32 NumItemTypes);
+
+	// コンソールコマンド: IdleSetLogVerbosity <Time|Task|Inventory|Combat|AI|Sim|All> <Verbosity>
+	UFUNCTION(Exec, Category = "Task Management Debug")
+	void IdleSetLogVerbosity(const FString& CategoryName, const FString& VerbosityName);
+
 	// Debug function for gathering system
 	UFUNCTION(BlueprintCallable, Category = "Debug")
 	void TestGatheringSetup();
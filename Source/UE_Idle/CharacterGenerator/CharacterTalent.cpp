@@ -6,21 +6,27 @@ float UCharacterTalentGenerator::BaseStatRangeMultiplier = 0.4f;   // 1-12 (30 *
 float UCharacterTalentGenerator::SpecialtyBonusRangeMultiplier = 0.375f; // 37.5%
 
 FCharacterTalent UCharacterTalentGenerator::GenerateRandomTalent()
+{
+    FIdleRandomStream RandomStream = FIdleRandomStream::MakeNondeterministic();
+    return GenerateRandomTalent(RandomStream);
+}
+
+FCharacterTalent UCharacterTalentGenerator::GenerateRandomTalent(FIdleRandomStream& RandomStream)
 {
     FCharacterTalent Talent;
     
     // 係数ベースの基本能力値計算（調整可能）
     float MaxBaseStat = 30.0f * BaseStatRangeMultiplier; // デフォルト: 30 * 0.4 = 12
     
-    Talent.Strength = FMath::RandRange(1.0f, MaxBaseStat);
-    Talent.Toughness = FMath::RandRange(1.0f, MaxBaseStat);
-    Talent.Intelligence = FMath::RandRange(1.0f, MaxBaseStat);
-    Talent.Dexterity = FMath::RandRange(1.0f, MaxBaseStat);
-    Talent.Agility = FMath::RandRange(1.0f, MaxBaseStat);
-    Talent.Willpower = FMath::RandRange(1.0f, MaxBaseStat);
+    Talent.Strength = RandomStream.FRandRange(1.0f, MaxBaseStat);
+    Talent.Toughness = RandomStream.FRandRange(1.0f, MaxBaseStat);
+    Talent.Intelligence = RandomStream.FRandRange(1.0f, MaxBaseStat);
+    Talent.Dexterity = RandomStream.FRandRange(1.0f, MaxBaseStat);
+    Talent.Agility = RandomStream.FRandRange(1.0f, MaxBaseStat);
+    Talent.Willpower = RandomStream.FRandRange(1.0f, MaxBaseStat);
     
     // スキルの個数をランダムに決定 (1-4)
-    int32 SkillCount = FMath::RandRange(1, 4);
+    int32 SkillCount = RandomStream.RandRange(1, 4);
     
     // 選択済みスキルを追跡
     TArray<ESkillType> SelectedSkills;
@@ -35,7 +41,7 @@ FCharacterTalent UCharacterTalentGenerator::GenerateRandomTalent()
         while (!bValidSkill)
         {
             // ランダムにスキルを選択
-            NewSkill = static_cast<ESkillType>(FMath::RandRange(0, static_cast<int32>(ESkillType::Count) - 1));
+            NewSkill = static_cast<ESkillType>(RandomStream.RandRange(0, static_cast<int32>(ESkillType::Count) - 1));
             
             // 既に選択されていないか確認
             if (!SelectedSkills.Contains(NewSkill))
@@ -48,7 +54,7 @@ FCharacterTalent UCharacterTalentGenerator::GenerateRandomTalent()
         // スキルと値を設定
         FSkillTalent SkillTalent;
         SkillTalent.SkillType = NewSkill;
-        SkillTalent.Value = FMath::RandRange(1.0f, 20.0f);
+        SkillTalent.Value = RandomStream.FRandRange(1.0f, 20.0f);
         
         Talent.Skills.Add(SkillTalent);
     }
@@ -57,6 +63,12 @@ FCharacterTalent UCharacterTalentGenerator::GenerateRandomTalent()
 }
 
 FCharacterTalent UCharacterTalentGenerator::ApplySpecialtyBonus(const FCharacterTalent& BaseTalent, ESpecialtyType SpecialtyType)
+{
+    FIdleRandomStream RandomStream = FIdleRandomStream::MakeNondeterministic();
+    return ApplySpecialtyBonus(BaseTalent, SpecialtyType, RandomStream);
+}
+
+FCharacterTalent UCharacterTalentGenerator::ApplySpecialtyBonus(const FCharacterTalent& BaseTalent, ESpecialtyType SpecialtyType, FIdleRandomStream& RandomStream)
 {
     FCharacterTalent ResultTalent = BaseTalent;
     FSpecialtyBonus SpecialtyBonus = GetSpecialtyBonus(SpecialtyType);
@@ -65,42 +77,42 @@ FCharacterTalent UCharacterTalentGenerator::ApplySpecialtyBonus(const FCharacter
     if (SpecialtyBonus.Strength > 0.0f)
     {
         float AdjustedBonus = SpecialtyBonus.Strength * SpecialtyBonusRangeMultiplier;
-        float RandomBonus = FMath::RandRange(AdjustedBonus * 0.5f, AdjustedBonus);
+        float RandomBonus = RandomStream.FRandRange(AdjustedBonus * 0.5f, AdjustedBonus);
         ResultTalent.Strength = FMath::Clamp(ResultTalent.Strength + RandomBonus, 1.0f, 100.0f);
     }
     
     if (SpecialtyBonus.Toughness > 0.0f)
     {
         float AdjustedBonus = SpecialtyBonus.Toughness * SpecialtyBonusRangeMultiplier;
-        float RandomBonus = FMath::RandRange(AdjustedBonus * 0.5f, AdjustedBonus);
+        float RandomBonus = RandomStream.FRandRange(AdjustedBonus * 0.5f, AdjustedBonus);
         ResultTalent.Toughness = FMath::Clamp(ResultTalent.Toughness + RandomBonus, 1.0f, 100.0f);
     }
     
     if (SpecialtyBonus.Intelligence > 0.0f)
     {
         float AdjustedBonus = SpecialtyBonus.Intelligence * SpecialtyBonusRangeMultiplier;
-        float RandomBonus = FMath::RandRange(AdjustedBonus * 0.5f, AdjustedBonus);
+        float RandomBonus = RandomStream.FRandRange(AdjustedBonus * 0.5f, AdjustedBonus);
         ResultTalent.Intelligence = FMath::Clamp(ResultTalent.Intelligence + RandomBonus, 1.0f, 100.0f);
     }
     
     if (SpecialtyBonus.Dexterity > 0.0f)
     {
         float AdjustedBonus = SpecialtyBonus.Dexterity * SpecialtyBonusRangeMultiplier;
-        float RandomBonus = FMath::RandRange(AdjustedBonus * 0.5f, AdjustedBonus);
+        float RandomBonus = RandomStream.FRandRange(AdjustedBonus * 0.5f, AdjustedBonus);
         ResultTalent.Dexterity = FMath::Clamp(ResultTalent.Dexterity + RandomBonus, 1.0f, 100.0f);
     }
     
     if (SpecialtyBonus.Agility > 0.0f)
     {
         float AdjustedBonus = SpecialtyBonus.Agility * SpecialtyBonusRangeMultiplier;
-        float RandomBonus = FMath::RandRange(AdjustedBonus * 0.5f, AdjustedBonus);
+        float RandomBonus = RandomStream.FRandRange(AdjustedBonus * 0.5f, AdjustedBonus);
         ResultTalent.Agility = FMath::Clamp(ResultTalent.Agility + RandomBonus, 1.0f, 100.0f);
     }
     
     if (SpecialtyBonus.Willpower > 0.0f)
     {
         float AdjustedBonus = SpecialtyBonus.Willpower * SpecialtyBonusRangeMultiplier;
-        float RandomBonus = FMath::RandRange(AdjustedBonus * 0.5f, AdjustedBonus);
+        float RandomBonus = RandomStream.FRandRange(AdjustedBonus * 0.5f, AdjustedBonus);
         ResultTalent.Willpower = FMath::Clamp(ResultTalent.Willpower + RandomBonus, 1.0f, 100.0f);
     }
     
@@ -115,7 +127,7 @@ FCharacterTalent UCharacterTalentGenerator::ApplySpecialtyBonus(const FCharacter
             if (ExistingSkill.SkillType == SkillBonus.SkillType)
             {
                 float AdjustedBonus = SkillBonus.Value * SpecialtyBonusRangeMultiplier;
-                float RandomBonus = FMath::RandRange(AdjustedBonus * 0.5f, AdjustedBonus);
+                float RandomBonus = RandomStream.FRandRange(AdjustedBonus * 0.5f, AdjustedBonus);
                 ExistingSkill.Value = FMath::Clamp(ExistingSkill.Value + RandomBonus, 1.0f, 100.0f);
                 bSkillFound = true;
                 break;
@@ -128,7 +140,7 @@ FCharacterTalent UCharacterTalentGenerator::ApplySpecialtyBonus(const FCharacter
             FSkillTalent NewSkill;
             NewSkill.SkillType = SkillBonus.SkillType;
             float AdjustedBonus = SkillBonus.Value * SpecialtyBonusRangeMultiplier;
-            NewSkill.Value = FMath::RandRange(AdjustedBonus * 0.5f, AdjustedBonus);
+            NewSkill.Value = RandomStream.FRandRange(AdjustedBonus * 0.5f, AdjustedBonus);
             ResultTalent.Skills.Add(NewSkill);
         }
     }
@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "Engine/Engine.h"
 #include "../Types/CharacterTypes.h"
+#include "../Types/SimulationRandomTypes.h"
 #include "CharacterTalent.generated.h"
 
 UCLASS()
@@ -17,6 +18,10 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Character Talent")
     static FCharacterTalent ApplySpecialtyBonus(const FCharacterTalent& BaseTalent, ESpecialtyType SpecialtyType);
 
+    // シミュレーション乱数ストリーム版（再現性が必要な生成用）
+    static FCharacterTalent GenerateRandomTalent(FIdleRandomStream& RandomStream);
+    static FCharacterTalent ApplySpecialtyBonus(const FCharacterTalent& BaseTalent, ESpecialtyType SpecialtyType, FIdleRandomStream& RandomStream);
+
     // バランス調整用係数設定（エディタで調整可能）
     UFUNCTION(BlueprintCallable, Category = "Character Talent")
     static void SetBalanceMultipliers(float BaseStatMultiplier, float SpecialtyBonusMultiplier);
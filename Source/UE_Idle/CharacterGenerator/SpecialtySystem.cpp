@@ -2,6 +2,12 @@
 #include "Engine/Engine.h"
 
 ESpecialtyType USpecialtySystem::GetRandomSpecialty()
+{
+    FIdleRandomStream RandomStream = FIdleRandomStream::MakeNondeterministic();
+    return GetRandomSpecialty(RandomStream);
+}
+
+ESpecialtyType USpecialtySystem::GetRandomSpecialty(FIdleRandomStream& RandomStream)
 {
     // 重み付き確率分布
     // 通常専門: 重み6
@@ -49,7 +55,7 @@ ESpecialtyType USpecialtySystem::GetRandomSpecialty()
     }
     
     // ランダム値を生成
-    int32 RandomValue = FMath::RandRange(0, TotalWeight - 1);
+    int32 RandomValue = RandomStream.RandRange(0, TotalWeight - 1);
     
     // 重み付き選択
     int32 AccumulatedWeight = 0;
@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "Engine/Engine.h"
 #include "../Types/CharacterTypes.h"
+#include "../Types/SimulationRandomTypes.h"
 #include "SpecialtySystem.generated.h"
 
 UCLASS()
@@ -13,4 +14,7 @@ class UE_IDLE_API USpecialtySystem : public UObject
 public:
     UFUNCTION(BlueprintCallable, Category = "Specialty System")
     static ESpecialtyType GetRandomSpecialty();
+
+    // シミュレーション乱数ストリーム版（再現性が必要な生成用）
+    static ESpecialtyType GetRandomSpecialty(FIdleRandomStream& RandomStream);
 };
\ No newline at end of file
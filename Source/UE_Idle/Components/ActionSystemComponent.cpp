@@ -1,8 +1,10 @@
 #include "ActionSystemComponent.h"
+#include "../UE_Idle.h"
 #include "../Actor/C_IdleCharacter.h"
 #include "../Components/CharacterStatusComponent.h"
 #include "../Components/InventoryComponent.h"
 #include "../Managers/CombatCalculator.h"
+#include "../Managers/SimulationRandomManager.h"
 #include "EventLogManager.h"
 #include "../C_PlayerController.h"
 #include "CombatComponent.h"
@@ -46,7 +48,7 @@ void UActionSystemComponent::StartActionSystem()
         if (ActionCheckInterval <= 0.0f)
         {
             // インターバルが0以下の場合は即座に実行
-            UE_LOG(LogTemp, Log, TEXT("Action system started - immediate processing mode"));
+            UE_LOG(LogIdleCombat, Log, TEXT("Action system started - immediate processing mode"));
             GetWorld()->GetTimerManager().SetTimer(
                 ActionTimerHandle,
                 this,
@@ -65,7 +67,7 @@ void UActionSystemComponent::StartActionSystem()
                 ActionCheckInterval,
                 true  // ループ
             );
-            UE_LOG(LogTemp, Log, TEXT("Action system started with interval %.2fs"), ActionCheckInterval);
+            UE_LOG(LogIdleCombat, Log, TEXT("Action system started with interval %.2fs"), ActionCheckInterval);
         }
     }
 }
@@ -83,13 +85,13 @@ void UActionSystemComponent::StopActionSystem()
     if (GetWorld())
     {
         GetWorld()->GetTimerManager().ClearTimer(ActionTimerHandle);
-        UE_LOG(LogTemp, Log, TEXT("Action system stopped"));
+        UE_LOG(LogIdleCombat, Log, TEXT("Action system stopped"));
     }
 
     // 即座にすべてのアクションをクリア
     AllyActions.Empty();
     EnemyActions.Empty();
-    UE_LOG(LogTemp, Log, TEXT("All actions cleared on system stop"));
+    UE_LOG(LogIdleCombat, Log, TEXT("All actions cleared on system stop"));
 }
 
 void UActionSystemComponent::RegisterCharacter(AC_IdleCharacter* Character, const TArray<AC_IdleCharacter*>& Enemies)
@@ -150,13 +152,13 @@ void UActionSystemComponent::RegisterCharacter(AC_IdleCharacter* Character, cons
     if (bIsEnemy)
     {
         EnemyActions.Add(NewAction);
-        UE_LOG(LogTemp, Log, TEXT("Registered enemy character: %s"), 
+        UE_LOG(LogIdleCombat, Log, TEXT("Registered enemy character: %s"), 
             *IIdleCharacterInterface::Execute_GetCharacterName(Character));
     }
     else
     {
         AllyActions.Add(NewAction);
-        UE_LOG(LogTemp, Log, TEXT("Registered ally character: %s"), 
+        UE_LOG(LogIdleCombat, Log, TEXT("Registered ally character: %s"), 
             *IIdleCharacterInterface::Execute_GetCharacterName(Character));
     }
 }
@@ -165,7 +167,7 @@ void UActionSystemComponent::UnregisterCharacter(AC_IdleCharacter* Character)
 {
     if (RemoveCharacterAction(Character))
     {
-        UE_LOG(LogTemp, Log, TEXT("Unregistered character: %s"), 
+        UE_LOG(LogIdleCombat, Log, TEXT("Unregistered character: %s"), 
             Character ? *IIdleCharacterInterface::Execute_GetCharacterName(Character) : TEXT("nullptr"));
     }
 }
@@ -193,7 +195,7 @@ void UActionSystemComponent::RegisterAlly(AC_IdleCharacter* Character)
     NewAction.NextActionTime = 0.0f;
     
     AllyActions.Add(NewAction);
-    UE_LOG(LogTemp, Log, TEXT("Registered ally character: %s"), 
+    UE_LOG(LogIdleCombat, Log, TEXT("Registered ally character: %s"), 
         *IIdleCharacterInterface::Execute_GetCharacterName(Character));
 }
 
@@ -220,14 +222,14 @@ void UActionSystemComponent::RegisterEnemy(AC_IdleCharacter* Character)
     NewAction.NextActionTime = 0.0f;
     
     EnemyActions.Add(NewAction);
-    UE_LOG(LogTemp, Log, TEXT("Registered enemy character: %s"), 
+    UE_LOG(LogIdleCombat, Log, TEXT("Registered enemy character: %s"), 
         *IIdleCharacterInterface::Execute_GetCharacterName(Character));
 }
 
 void UActionSystemComponent::RegisterTeam(const TArray<AC_IdleCharacter*>& AllyTeam, const TArray<AC_IdleCharacter*>& EnemyTeam)
 {
-    UE_LOG(LogTemp, Error, TEXT("*** ActionSystemComponent::RegisterTeam CALLED ***"));
-    UE_LOG(LogTemp, Error, TEXT("AllyTeam: %d, EnemyTeam: %d"), AllyTeam.Num(), EnemyTeam.Num());
+    UE_LOG(LogIdleCombat, Error, TEXT("*** ActionSystemComponent::RegisterTeam CALLED ***"));
+    UE_LOG(LogIdleCombat, Error, TEXT("AllyTeam: %d, EnemyTeam: %d"), AllyTeam.Num(), EnemyTeam.Num());
     
     // 味方チーム登録
     for (AC_IdleCharacter* Ally : AllyTeam)
@@ -254,17 +256,17 @@ void UActionSystemComponent::RegisterTeam(const TArray<AC_IdleCharacter*>& AllyT
         {
             if (PC->EventLogManager)
             {
-                UE_LOG(LogTemp, Error, TEXT("Calling LogCombatStart from ActionSystemComponent"));
+                UE_LOG(LogIdleCombat, Error, TEXT("Calling LogCombatStart from ActionSystemComponent"));
                 PC->EventLogManager->LogCombatStart(AllyTeam, EnemyTeam, TEXT("戦場"));
             }
             else
             {
-                UE_LOG(LogTemp, Error, TEXT("ActionSystemComponent: PlayerController has no EventLogManager"));
+                UE_LOG(LogIdleCombat, Error, TEXT("ActionSystemComponent: PlayerController has no EventLogManager"));
             }
         }
         else
         {
-            UE_LOG(LogTemp, Error, TEXT("ActionSystemComponent: No PlayerController found"));
+            UE_LOG(LogIdleCombat, Error, TEXT("ActionSystemComponent: No PlayerController found"));
         }
     }
     
@@ -288,7 +290,7 @@ void UActionSystemComponent::RegisterTeam(const TArray<AC_IdleCharacter*>& AllyT
         }
     }
     
-    UE_LOG(LogTemp, Log, TEXT("RegisterTeam: Initialized action gauges for %d allies and %d enemies"), 
+    UE_LOG(LogIdleCombat, Log, TEXT("RegisterTeam: Initialized action gauges for %d allies and %d enemies"), 
         AllyTeam.Num(), EnemyTeam.Num());
 }
 
@@ -296,7 +298,7 @@ void UActionSystemComponent::ClearAllCharacters()
 {
     AllyActions.Empty();
     EnemyActions.Empty();
-    UE_LOG(LogTemp, Log, TEXT("Cleared all registered characters"));
+    UE_LOG(LogIdleCombat, Log, TEXT("Cleared all registered characters"));
 }
 
 void UActionSystemComponent::HandleCharacterDeath(AC_IdleCharacter* Character)
@@ -314,7 +316,7 @@ void UActionSystemComponent::HandleCharacterDeath(AC_IdleCharacter* Character)
         EventLogManager->AddCombatLog(ECombatLogType::Death, Character);
     }
     
-    UE_LOG(LogTemp, Log, TEXT("Character died: %s"), 
+    UE_LOG(LogIdleCombat, Log, TEXT("Character died: %s"), 
         *IIdleCharacterInterface::Execute_GetCharacterName(Character));
 }
 
@@ -400,6 +402,9 @@ TArray<AC_IdleCharacter*> UActionSystemComponent::GetAllEnemies() const
 
 void UActionSystemComponent::ProcessActions()
 {
+    SCOPE_CYCLE_COUNTER(STAT_IdleSim_CombatActions);
+    TRACE_CPUPROFILER_EVENT_SCOPE(IdleSim_CombatActions);
+    
     if (!bSystemActive)
     {
         return;
@@ -411,7 +416,7 @@ void UActionSystemComponent::ProcessActions()
     // アクションが空の場合は処理を停止
     if (AllyActions.Num() == 0 && EnemyActions.Num() == 0)
     {
-        UE_LOG(LogTemp, Warning, TEXT("ProcessActions: No valid actions remaining, stopping system"));
+        UE_LOG(LogIdleCombat, Warning, TEXT("ProcessActions: No valid actions remaining, stopping system"));
         StopActionSystem();
         return;
     }
@@ -445,7 +450,7 @@ void UActionSystemComponent::ProcessActions()
     // 戦闘終了チェック（ログ記録継続のため復活、ただしActionSystem停止はしない）
     if (AreAllEnemiesDead() || AreAllAlliesDead())
     {
-        UE_LOG(LogTemp, Log, TEXT("ProcessActions: Combat ending detected, but continuing for log recording"));
+        UE_LOG(LogIdleCombat, Log, TEXT("ProcessActions: Combat ending detected, but continuing for log recording"));
         // CombatComponentに戦闘終了を通知するが、ActionSystemは停止しない
         if (UWorld* World = GetWorld())
         {
@@ -467,7 +472,7 @@ void UActionSystemComponent::ProcessCharacterAction(FCombatAction& Action)
     // システムが停止している場合は即座に終了
     if (!bSystemActive)
     {
-        UE_LOG(LogTemp, Warning, TEXT("ProcessCharacterAction: System not active, aborting"));
+        UE_LOG(LogIdleCombat, Warning, TEXT("ProcessCharacterAction: System not active, aborting"));
         return;
     }
 
@@ -475,7 +480,7 @@ void UActionSystemComponent::ProcessCharacterAction(FCombatAction& Action)
     TotalActionCount++;
     if (TotalActionCount >= 3000)
     {
-        UE_LOG(LogTemp, Warning, TEXT("Combat force-ended after %d character actions (failsafe)"), TotalActionCount);
+        UE_LOG(LogIdleCombat, Warning, TEXT("Combat force-ended after %d character actions (failsafe)"), TotalActionCount);
         StopActionSystem();
         // CombatComponentに戦闘終了を通知
         if (UWorld* World = GetWorld())
@@ -494,13 +499,13 @@ void UActionSystemComponent::ProcessCharacterAction(FCombatAction& Action)
     // 完全防御的チェック
     if (!Action.Character || !IsValid(Action.Character))
     {
-        UE_LOG(LogTemp, Error, TEXT("ProcessCharacterAction: Invalid character in action"));
+        UE_LOG(LogIdleCombat, Error, TEXT("ProcessCharacterAction: Invalid character in action"));
         return;
     }
     
     if (!IsCharacterAlive(Action.Character))
     {
-        UE_LOG(LogTemp, VeryVerbose, TEXT("ProcessCharacterAction: Character %s is dead"), *Action.Character->GetName());
+        UE_LOG(LogIdleCombat, VeryVerbose, TEXT("ProcessCharacterAction: Character %s is dead"), *Action.Character->GetName());
         return;
     }
     
@@ -512,13 +517,13 @@ void UActionSystemComponent::ProcessCharacterAction(FCombatAction& Action)
     }
     catch(...)
     {
-        UE_LOG(LogTemp, Error, TEXT("ProcessCharacterAction: Exception getting StatusComponent for %s"), *Action.Character->GetName());
+        UE_LOG(LogIdleCombat, Error, TEXT("ProcessCharacterAction: Exception getting StatusComponent for %s"), *Action.Character->GetName());
         return;
     }
     
     if (!StatusComp || !IsValid(StatusComp))
     {
-        UE_LOG(LogTemp, Error, TEXT("ProcessCharacterAction: Character %s has no valid StatusComponent"), *Action.Character->GetName());
+        UE_LOG(LogIdleCombat, Error, TEXT("ProcessCharacterAction: Character %s has no valid StatusComponent"), *Action.Character->GetName());
         return;
     }
 
@@ -553,9 +558,11 @@ void UActionSystemComponent::ProcessCharacterAction(FCombatAction& Action)
     // 武器選択
     FString WeaponId = SelectWeapon(Action.Character);
     
-    // 戦闘計算実行
+    // 戦闘計算実行（ターン・攻撃者・戦闘内の行動番号をキーにした乱数）
+    FIdleRandomStream RandomStream = USimulationRandomManager::MakeStreamForCurrentTurn(
+        this, EIdleRandomDomain::Combat, USimulationRandomManager::GetEntityKey(Action.Character), TotalActionCount);
     FCombatCalculationResult Result = UCombatCalculator::PerformCombatCalculation(
-        Action.Character, Target, WeaponId);
+        Action.Character, Target, WeaponId, RandomStream);
     
     // ログ記録
     if (UWorld* World = GetWorld())
@@ -564,7 +571,7 @@ void UActionSystemComponent::ProcessCharacterAction(FCombatAction& Action)
         {
             if (PC->EventLogManager)
             {
-                UE_LOG(LogTemp, Log, TEXT("About to call AddCombatCalculationLog: %s vs %s, damage %d, hit=%s"), 
+                UE_LOG(LogIdleCombat, Log, TEXT("About to call AddCombatCalculationLog: %s vs %s, damage %d, hit=%s"), 
                     Action.Character ? *Action.Character->GetName() : TEXT("Unknown"),
                     Target ? *Target->GetName() : TEXT("Unknown"),
                     Result.FinalDamage,
@@ -582,7 +589,7 @@ void UActionSystemComponent::ProcessCharacterAction(FCombatAction& Action)
                             FCharacterStatus Status = AttackerStatusComp->GetStatus();
                             AttackerHP = FMath::RoundToInt(Status.CurrentHealth);
                             AttackerMaxHP = FMath::RoundToInt(Status.MaxHealth);
-                            UE_LOG(LogTemp, Log, TEXT("ActionSystem: Attacker %s HP: %d/%d"), 
+                            UE_LOG(LogIdleCombat, Log, TEXT("ActionSystem: Attacker %s HP: %d/%d"), 
                                 *IIdleCharacterInterface::Execute_GetCharacterName(Action.Character), AttackerHP, AttackerMaxHP);
                         }
                     }
@@ -597,7 +604,7 @@ void UActionSystemComponent::ProcessCharacterAction(FCombatAction& Action)
                             FCharacterStatus Status = DefenderStatusComp->GetStatus();
                             DefenderHP = FMath::RoundToInt(Status.CurrentHealth);
                             DefenderMaxHP = FMath::RoundToInt(Status.MaxHealth);
-                            UE_LOG(LogTemp, Log, TEXT("ActionSystem: Defender %s HP: %d/%d"), 
+                            UE_LOG(LogIdleCombat, Log, TEXT("ActionSystem: Defender %s HP: %d/%d"), 
                                 *IIdleCharacterInterface::Execute_GetCharacterName(Target), DefenderHP, DefenderMaxHP);
                         }
                     }
@@ -613,18 +620,18 @@ void UActionSystemComponent::ProcessCharacterAction(FCombatAction& Action)
                 if (Action.Character) 
                 {
                     NewEntry.CombatData.AttackerName = IIdleCharacterInterface::Execute_GetCharacterName(Action.Character);
-                    UE_LOG(LogTemp, Warning, TEXT("Combat Log: AttackerName = '%s'"), *NewEntry.CombatData.AttackerName);
+                    UE_LOG(LogIdleCombat, Warning, TEXT("Combat Log: AttackerName = '%s'"), *NewEntry.CombatData.AttackerName);
                 }
                 if (Target) 
                 {
                     NewEntry.CombatData.DefenderName = IIdleCharacterInterface::Execute_GetCharacterName(Target);
-                    UE_LOG(LogTemp, Warning, TEXT("Combat Log: DefenderName = '%s'"), *NewEntry.CombatData.DefenderName);
+                    UE_LOG(LogIdleCombat, Warning, TEXT("Combat Log: DefenderName = '%s'"), *NewEntry.CombatData.DefenderName);
                 }
                 NewEntry.CombatData.WeaponName = WeaponId.IsEmpty() ? TEXT("素手") : WeaponId;
                 NewEntry.CombatData.Damage = Result.FinalDamage;
                 NewEntry.CombatData.bIsCritical = Result.bCritical;
                 
-                UE_LOG(LogTemp, Warning, TEXT("Combat Log: Damage = %d, Critical = %s"), 
+                UE_LOG(LogIdleCombat, Warning, TEXT("Combat Log: Damage = %d, Critical = %s"), 
                     Result.FinalDamage, Result.bCritical ? TEXT("true") : TEXT("false"));
                 
                 // 攻撃者が味方か敵かを判定
@@ -641,11 +648,11 @@ void UActionSystemComponent::ProcessCharacterAction(FCombatAction& Action)
                 
                 PC->EventLogManager->AddEventLog(NewEntry);
                 
-                UE_LOG(LogTemp, Log, TEXT("Combat log recorded successfully"));
+                UE_LOG(LogIdleCombat, Log, TEXT("Combat log recorded successfully"));
             }
             else
             {
-                UE_LOG(LogTemp, Error, TEXT("PlayerController has no EventLogManager for combat log"));
+                UE_LOG(LogIdleCombat, Error, TEXT("PlayerController has no EventLogManager for combat log"));
             }
         }
     }
@@ -659,14 +666,14 @@ void UActionSystemComponent::ProcessCharacterAction(FCombatAction& Action)
             float NewHP = FMath::Max(0.0f, CurrentHP - Result.FinalDamage);
             TargetStatus->SetCurrentHealth(NewHP);
             
-            UE_LOG(LogTemp, Log, TEXT("%s Health: %.1f -> %.1f (-%d damage)"), 
+            UE_LOG(LogIdleCombat, Log, TEXT("%s Health: %.1f -> %.1f (-%d damage)"), 
                 *IIdleCharacterInterface::Execute_GetCharacterName(Target),
                 CurrentHP, NewHP, Result.FinalDamage);
             
             // 死亡判定
             if (NewHP <= 0.0f)
             {
-                UE_LOG(LogTemp, Warning, TEXT("%s has died!"), 
+                UE_LOG(LogIdleCombat, Warning, TEXT("%s has died!"), 
                     *IIdleCharacterInterface::Execute_GetCharacterName(Target));
                 OnCharacterDeath.Broadcast(Target);
                 
@@ -721,7 +728,7 @@ FString UActionSystemComponent::SelectWeapon(AC_IdleCharacter* Character)
         return TEXT("素手");
     }
 
-    UE_LOG(LogTemp, VeryVerbose, TEXT("SelectWeapon for character: %s"), *Character->GetName());
+    UE_LOG(LogIdleCombat, VeryVerbose, TEXT("SelectWeapon for character: %s"), *Character->GetName());
 
     // 1. まず装備された武器をチェック
     if (UInventoryComponent* InventoryComp = Character->GetInventoryComponent())
@@ -730,7 +737,7 @@ FString UActionSystemComponent::SelectWeapon(AC_IdleCharacter* Character)
         if (InventoryComp->HasEquippedWeapon())
         {
             FString WeaponId = InventoryComp->GetEquippedWeaponId();
-            UE_LOG(LogTemp, VeryVerbose, TEXT("SelectWeapon: Using equipped weapon: %s"), *WeaponId);
+            UE_LOG(LogIdleCombat, VeryVerbose, TEXT("SelectWeapon: Using equipped weapon: %s"), *WeaponId);
             return WeaponId;
         }
     }
@@ -746,23 +753,23 @@ FString UActionSystemComponent::SelectWeapon(AC_IdleCharacter* Character)
         
         if (CharacterName.Contains(TEXT("ネズミ")))
         {
-            UE_LOG(LogTemp, Log, TEXT("SelectWeapon: Using natural weapon for %s: ネズミの歯"), *CharacterName);
+            UE_LOG(LogIdleCombat, Log, TEXT("SelectWeapon: Using natural weapon for %s: ネズミの歯"), *CharacterName);
             return TEXT("ネズミの歯");
         }
         else if (CharacterName.Contains(TEXT("ゴブリン")))
         {
-            UE_LOG(LogTemp, Log, TEXT("SelectWeapon: Using natural weapon for %s: ゴブリンの爪"), *CharacterName);
+            UE_LOG(LogIdleCombat, Log, TEXT("SelectWeapon: Using natural weapon for %s: ゴブリンの爪"), *CharacterName);
             return TEXT("ゴブリンの爪");
         }
         else if (CharacterName.Contains(TEXT("ガエル")))
         {
-            UE_LOG(LogTemp, Log, TEXT("SelectWeapon: Using natural weapon for %s: ガエルの毒舌"), *CharacterName);
+            UE_LOG(LogIdleCombat, Log, TEXT("SelectWeapon: Using natural weapon for %s: ガエルの毒舌"), *CharacterName);
             return TEXT("ガエルの毒舌");
         }
     }
 
     // 3. 装備武器も自然武器もない場合は素手戦闘
-    UE_LOG(LogTemp, VeryVerbose, TEXT("SelectWeapon: No equipped or natural weapon found, using unarmed combat"));
+    UE_LOG(LogIdleCombat, VeryVerbose, TEXT("SelectWeapon: No equipped or natural weapon found, using unarmed combat"));
     return TEXT("素手");
 }
 
@@ -771,14 +778,14 @@ void UActionSystemComponent::UpdateNextActionTime(FCombatAction& Action, const F
     // システムが停止している場合は即座に終了
     if (!bSystemActive)
     {
-        UE_LOG(LogTemp, Warning, TEXT("UpdateNextActionTime: System is not active, skipping"));
+        UE_LOG(LogIdleCombat, Warning, TEXT("UpdateNextActionTime: System is not active, skipping"));
         return;
     }
 
     // 完全防御的チェック
     if (!Action.Character || !IsValid(Action.Character))
     {
-        UE_LOG(LogTemp, Error, TEXT("UpdateNextActionTime: Invalid character"));
+        UE_LOG(LogIdleCombat, Error, TEXT("UpdateNextActionTime: Invalid character"));
         Action.NextActionTime = GetWorld() ? GetWorld()->GetTimeSeconds() + 1.0f : 1.0f;
         Action.AttackSpeed = 1.0f;
         return;
@@ -800,7 +807,7 @@ void UActionSystemComponent::UpdateNextActionTime(FCombatAction& Action, const F
         {
             CharName = IIdleCharacterInterface::Execute_GetCharacterName(Action.Character);
         }
-        UE_LOG(LogTemp, Warning, TEXT("UpdateNextActionTime: Character %s is not active"), *CharName);
+        UE_LOG(LogIdleCombat, Warning, TEXT("UpdateNextActionTime: Character %s is not active"), *CharName);
         Action.NextActionTime = GetWorld() ? GetWorld()->GetTimeSeconds() + 1.0f : 1.0f;
         Action.AttackSpeed = 1.0f;
         return;
@@ -815,7 +822,7 @@ void UActionSystemComponent::UpdateNextActionTime(FCombatAction& Action, const F
         {
             CharName = IIdleCharacterInterface::Execute_GetCharacterName(Action.Character);
         }
-        UE_LOG(LogTemp, Error, TEXT("UpdateNextActionTime: Character %s has no valid StatusComponent"), *CharName);
+        UE_LOG(LogIdleCombat, Error, TEXT("UpdateNextActionTime: Character %s has no valid StatusComponent"), *CharName);
         Action.NextActionTime = GetWorld() ? GetWorld()->GetTimeSeconds() + 1.0f : 1.0f;
         Action.AttackSpeed = 1.0f;
         return;
@@ -828,13 +835,13 @@ void UActionSystemComponent::UpdateNextActionTime(FCombatAction& Action, const F
         AttackSpeed = UCombatCalculator::CalculateAttackSpeed(Action.Character, WeaponId);
         if (AttackSpeed <= 0.0f || !FMath::IsFinite(AttackSpeed))
         {
-            UE_LOG(LogTemp, Warning, TEXT("UpdateNextActionTime: Invalid attack speed %.2f, using default"), AttackSpeed);
+            UE_LOG(LogIdleCombat, Warning, TEXT("UpdateNextActionTime: Invalid attack speed %.2f, using default"), AttackSpeed);
             AttackSpeed = 1.0f;
         }
     }
     catch(...)
     {
-        UE_LOG(LogTemp, Error, TEXT("UpdateNextActionTime: Exception calculating attack speed for %s"), *Action.Character->GetName());
+        UE_LOG(LogIdleCombat, Error, TEXT("UpdateNextActionTime: Exception calculating attack speed for %s"), *Action.Character->GetName());
         AttackSpeed = 1.0f;
     }
     
@@ -848,7 +855,7 @@ void UActionSystemComponent::UpdateNextActionTime(FCombatAction& Action, const F
     }
     else
     {
-        UE_LOG(LogTemp, Error, TEXT("UpdateNextActionTime: No valid world"));
+        UE_LOG(LogIdleCombat, Error, TEXT("UpdateNextActionTime: No valid world"));
         Action.NextActionTime = ActionInterval;
     }
 }
@@ -867,14 +874,14 @@ bool UActionSystemComponent::IsCharacterAlive(AC_IdleCharacter* Character) const
         {
             float CurrentHP = StatusComp->GetCurrentHealth();
             bool bIsAlive = CurrentHP > 0.0f;
-            UE_LOG(LogTemp, VeryVerbose, TEXT("IsCharacterAlive: %s HP=%.1f, alive=%s"), 
+            UE_LOG(LogIdleCombat, VeryVerbose, TEXT("IsCharacterAlive: %s HP=%.1f, alive=%s"), 
                 *Character->GetName(), CurrentHP, bIsAlive ? TEXT("true") : TEXT("false"));
             return bIsAlive;
         }
     }
 
     // StatusComponentがない場合は生存扱い（フォールバック）
-    UE_LOG(LogTemp, Warning, TEXT("IsCharacterAlive: %s has no StatusComponent, assuming alive"), *Character->GetName());
+    UE_LOG(LogIdleCombat, Warning, TEXT("IsCharacterAlive: %s has no StatusComponent, assuming alive"), *Character->GetName());
     return true;
 }
 
@@ -926,7 +933,7 @@ bool UActionSystemComponent::RemoveCharacterAction(AC_IdleCharacter* Character)
 
 void UActionSystemComponent::ClearAllActions()
 {
-    UE_LOG(LogTemp, Warning, TEXT("ClearAllActions: Clearing %d ally actions and %d enemy actions"), 
+    UE_LOG(LogIdleCombat, Warning, TEXT("ClearAllActions: Clearing %d ally actions and %d enemy actions"), 
            AllyActions.Num(), EnemyActions.Num());
     
     AllyActions.Empty();
@@ -939,7 +946,7 @@ void UActionSystemComponent::ClearAllActions()
         World->GetTimerManager().ClearTimer(ActionTimerHandle);
     }
     
-    UE_LOG(LogTemp, Log, TEXT("ClearAllActions: All actions cleared and timer stopped"));
+    UE_LOG(LogIdleCombat, Log, TEXT("ClearAllActions: All actions cleared and timer stopped"));
 }
 
 void UActionSystemComponent::CleanupInvalidCharacters()
@@ -951,7 +958,7 @@ void UActionSystemComponent::CleanupInvalidCharacters()
     RemovedAllies = AllyActions.RemoveAll([](const FCombatAction& Action) {
         if (!Action.Character || !IsValid(Action.Character))
         {
-            UE_LOG(LogTemp, Warning, TEXT("CleanupInvalidCharacters: Removing null/invalid ally character"));
+            UE_LOG(LogIdleCombat, Warning, TEXT("CleanupInvalidCharacters: Removing null/invalid ally character"));
             return true;
         }
         
@@ -964,7 +971,7 @@ void UActionSystemComponent::CleanupInvalidCharacters()
         
         if (!bCharacterActive)
         {
-            UE_LOG(LogTemp, Warning, TEXT("CleanupInvalidCharacters: Removing inactive ally character"));
+            UE_LOG(LogIdleCombat, Warning, TEXT("CleanupInvalidCharacters: Removing inactive ally character"));
             return true;
         }
         
@@ -975,7 +982,7 @@ void UActionSystemComponent::CleanupInvalidCharacters()
     RemovedEnemies = EnemyActions.RemoveAll([](const FCombatAction& Action) {
         if (!Action.Character || !IsValid(Action.Character))
         {
-            UE_LOG(LogTemp, Warning, TEXT("CleanupInvalidCharacters: Removing null/invalid enemy character"));
+            UE_LOG(LogIdleCombat, Warning, TEXT("CleanupInvalidCharacters: Removing null/invalid enemy character"));
             return true;
         }
         
@@ -988,7 +995,7 @@ void UActionSystemComponent::CleanupInvalidCharacters()
         
         if (!bCharacterActive)
         {
-            UE_LOG(LogTemp, Warning, TEXT("CleanupInvalidCharacters: Removing inactive enemy character"));
+            UE_LOG(LogIdleCombat, Warning, TEXT("CleanupInvalidCharacters: Removing inactive enemy character"));
             return true;
         }
         
@@ -997,7 +1004,7 @@ void UActionSystemComponent::CleanupInvalidCharacters()
     
     if (RemovedAllies > 0 || RemovedEnemies > 0)
     {
-        UE_LOG(LogTemp, Log, TEXT("CleanupInvalidCharacters: Removed %d allies and %d enemies"), 
+        UE_LOG(LogIdleCombat, Log, TEXT("CleanupInvalidCharacters: Removed %d allies and %d enemies"), 
                RemovedAllies, RemovedEnemies);
     }
 }
@@ -1053,7 +1060,7 @@ bool UActionSystemComponent::ProcessSingleTurn()
     AC_IdleCharacter* NextCharacter = GetNextActingCharacter();
     if (!NextCharacter)
     {
-        UE_LOG(LogTemp, VeryVerbose, TEXT("ProcessSingleTurn: No character ready to act"));
+        UE_LOG(LogIdleCombat, VeryVerbose, TEXT("ProcessSingleTurn: No character ready to act"));
         return false;
     }
     
@@ -1061,13 +1068,13 @@ bool UActionSystemComponent::ProcessSingleTurn()
     FCombatAction* CharacterAction = FindCharacterAction(NextCharacter);
     if (!CharacterAction)
     {
-        UE_LOG(LogTemp, Warning, TEXT("ProcessSingleTurn: Character action not found"));
+        UE_LOG(LogIdleCombat, Warning, TEXT("ProcessSingleTurn: Character action not found"));
         return false;
     }
     
     // 現在時刻をチェック（デバッグ情報として使用）
     float CurrentTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
-    UE_LOG(LogTemp, VeryVerbose, TEXT("ProcessSingleTurn: %s acting (NextActionTime: %f, CurrentTime: %f)"), 
+    UE_LOG(LogIdleCombat, VeryVerbose, TEXT("ProcessSingleTurn: %s acting (NextActionTime: %f, CurrentTime: %f)"), 
         *NextCharacter->GetName(), CharacterAction->NextActionTime, CurrentTime);
     
     // そのキャラクターのみ行動
@@ -1151,7 +1158,7 @@ void UActionSystemComponent::InitializeCharacterGauge(AC_IdleCharacter* Characte
     FCombatAction* CharacterAction = FindCharacterAction(Character);
     if (!CharacterAction)
     {
-        UE_LOG(LogTemp, Warning, TEXT("InitializeCharacterGauge: Character action not found for %s"), 
+        UE_LOG(LogIdleCombat, Warning, TEXT("InitializeCharacterGauge: Character action not found for %s"), 
             *Character->GetName());
         return;
     }
@@ -1163,7 +1170,7 @@ void UActionSystemComponent::InitializeCharacterGauge(AC_IdleCharacter* Characte
         CharacterAction->GaugeSpeed = FMath::Max(1.0f, AGI * 0.5f); // AGI値の半分、最低1.0
         CharacterAction->ActionPriority = FMath::RoundToInt(AGI);     // AGI値を優先度に
         
-        UE_LOG(LogTemp, VeryVerbose, TEXT("InitializeCharacterGauge: %s - AGI:%.1f, GaugeSpeed:%.1f, Priority:%d"), 
+        UE_LOG(LogIdleCombat, VeryVerbose, TEXT("InitializeCharacterGauge: %s - AGI:%.1f, GaugeSpeed:%.1f, Priority:%d"), 
             *Character->GetName(), AGI, CharacterAction->GaugeSpeed, CharacterAction->ActionPriority);
     }
     else
@@ -1172,7 +1179,7 @@ void UActionSystemComponent::InitializeCharacterGauge(AC_IdleCharacter* Characte
         CharacterAction->GaugeSpeed = 10.0f;
         CharacterAction->ActionPriority = 10;
         
-        UE_LOG(LogTemp, Warning, TEXT("InitializeCharacterGauge: %s has no StatusComponent, using defaults"), 
+        UE_LOG(LogIdleCombat, Warning, TEXT("InitializeCharacterGauge: %s has no StatusComponent, using defaults"), 
             *Character->GetName());
     }
     
@@ -1198,7 +1205,7 @@ bool UActionSystemComponent::ProcessSingleTurnWithGauge()
     AC_IdleCharacter* NextCharacter = GetNextActingCharacterWithGauge();
     if (!NextCharacter)
     {
-        UE_LOG(LogTemp, VeryVerbose, TEXT("ProcessSingleTurnWithGauge: No character ready to act"));
+        UE_LOG(LogIdleCombat, VeryVerbose, TEXT("ProcessSingleTurnWithGauge: No character ready to act"));
         return false;
     }
     
@@ -1206,11 +1213,11 @@ bool UActionSystemComponent::ProcessSingleTurnWithGauge()
     FCombatAction* CharacterAction = FindCharacterAction(NextCharacter);
     if (!CharacterAction)
     {
-        UE_LOG(LogTemp, Warning, TEXT("ProcessSingleTurnWithGauge: Character action not found"));
+        UE_LOG(LogIdleCombat, Warning, TEXT("ProcessSingleTurnWithGauge: Character action not found"));
         return false;
     }
     
-    UE_LOG(LogTemp, Log, TEXT("ProcessSingleTurnWithGauge: %s acting (Gauge: %.1f, Score: %.2f)"), 
+    UE_LOG(LogIdleCombat, Log, TEXT("ProcessSingleTurnWithGauge: %s acting (Gauge: %.1f, Score: %.2f)"), 
         *NextCharacter->GetName(), CharacterAction->ActionGauge, CharacterAction->GetActionScore());
     
     // そのキャラクターのみ行動
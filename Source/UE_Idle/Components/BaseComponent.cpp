@@ -1,6 +1,9 @@
 #include "BaseComponent.h"
+#include "UE_Idle/UE_Idle.h"
 #include "UE_Idle/Managers/FacilityManager.h"
 #include "UE_Idle/Managers/ItemDataTableManager.h"
+#include "UE_Idle/Managers/SimulationReplayManager.h"
+#include "UE_Idle/Managers/ResourceLedgerManager.h"
 #include "UE_Idle/Components/InventoryComponent.h"
 #include "UE_Idle/C_GameInstance.h"
 #include "Engine/World.h"
@@ -74,6 +77,14 @@ FGuid UBaseComponent::PlanFacility(const FString& FacilityId, const FVector& Loc
     FGuid InstanceId = FacilityManager->CreateFacility(FacilityId, Location);
     if (InstanceId.IsValid())
     {
+        // リプレイ記録（再生時は新しいインスタンスIDに読み替える）
+        FIdleReplayCommand Command;
+        Command.CommandType = EIdleReplayCommandType::PlanFacility;
+        Command.Name = FacilityId;
+        Command.Location = Location;
+        Command.FacilityInstanceId = InstanceId;
+        USimulationReplayManager::Record(this, Command);
+
         OnFacilityAdded.Broadcast(InstanceId, FacilityId);
     }
 
@@ -117,6 +128,12 @@ bool UBaseComponent::StartFacilityConstruction(const FGuid& InstanceId)
         return false;
     }
 
+    // リプレイ記録
+    FIdleReplayCommand Command;
+    Command.CommandType = EIdleReplayCommandType::StartFacilityConstruction;
+    Command.FacilityInstanceId = InstanceId;
+    USimulationReplayManager::Record(this, Command);
+
     return true;
 }
 
@@ -496,13 +513,16 @@ bool UBaseComponent::ConsumeResourcesForCost(const TMap<FString, int32>& Costs)
     }
 
     // 新採集システム：全てアイテムとして管理
-    // まず全てのコストが払えるか確認
+    // まず全てのコストが払えるか確認（拠点倉庫が資源台帳に登録済みなら台帳の在庫数で判定）
+    const UResourceLedgerManager* Ledger = UResourceLedgerManager::Get(this);
+    const bool bUseLedger = Ledger && Ledger->IsTracked(GlobalInventory);
     for (const auto& CostPair : Costs)
     {
-        if (!GlobalInventory->HasItem(CostPair.Key, CostPair.Value))
+        const int32 Available = bUseLedger ? Ledger->GetBaseAmount(CostPair.Key) : GlobalInventory->GetItemCount(CostPair.Key);
+        if (Available < CostPair.Value)
         {
             UE_LOG(LogTemp, Warning, TEXT("ConsumeResourcesForCost: Insufficient %s (needed: %d, have: %d)"), 
-                *CostPair.Key, CostPair.Value, GlobalInventory->GetItemCount(CostPair.Key));
+                *CostPair.Key, CostPair.Value, Available);
             return false;
         }
     }
@@ -557,7 +577,37 @@ void UBaseComponent::ProcessAutoProduction(float DeltaTime)
     }
 
     // 自動生産施設の処理
+    TMap<FString, int32> ProducedItems = CalculateAutoProduction(DeltaTime);
+    
+    for (const auto& Produced : ProducedItems)
+    {
+        if (Produced.Value > 0 && GlobalInventory)
+        {
+            // 新採集システム：全てアイテムとして追加
+            if (!GlobalInventory->AddItem(Produced.Key, Produced.Value))
+            {
+                UE_LOG(LogIdleTask, Error, TEXT("ProcessAutoProduction: Failed to add %s x%d"), 
+                    *Produced.Key, Produced.Value);
+            }
+            else
+            {
+                UE_LOG(LogIdleTask, Verbose, TEXT("ProcessAutoProduction: Produced %s x%d"), 
+                    *Produced.Key, Produced.Value);
+            }
+        }
+    }
+}
+
+TMap<FString, int32> UBaseComponent::CalculateAutoProduction(float DeltaTime) const
+{
+    TMap<FString, int32> ProducedItems;
+    if (!FacilityManager)
+    {
+        return ProducedItems;
+    }
+
     TArray<FFacilityInstance> ProductionFacilities = GetFacilitiesByType(EFacilityType::Production);
+    const float SpeedMultiplier = GetProductionSpeedMultiplier();
     
     for (const FFacilityInstance& Facility : ProductionFacilities)
     {
@@ -572,28 +622,20 @@ void UBaseComponent::ProcessAutoProduction(float DeltaTime)
         {
             if (Effect.EffectType == EFacilityEffectType::AutoProduction)
             {
-                // 生産速度を考慮した生産量
+                // 生産速度を考慮した生産量（施設・効果ごとに丸める）
                 float ProductionRate = FacilityManager->GetEffectValue(Facility.InstanceId, EFacilityEffectType::AutoProduction);
-                ProductionRate *= GetProductionSpeedMultiplier();
+                ProductionRate *= SpeedMultiplier;
                 
                 int32 ProducedAmount = FMath::RoundToInt(ProductionRate * DeltaTime);
-                if (ProducedAmount > 0 && GlobalInventory)
+                if (ProducedAmount > 0)
                 {
-                    // 新採集システム：全てアイテムとして追加
-                    if (!GlobalInventory->AddItem(Effect.TargetId, ProducedAmount))
-                    {
-                        UE_LOG(LogTemp, Error, TEXT("ProcessAutoProduction: Failed to add %s x%d"), 
-                            *Effect.TargetId, ProducedAmount);
-                    }
-                    else
-                    {
-                        UE_LOG(LogTemp, Log, TEXT("ProcessAutoProduction: Produced %s x%d"), 
-                            *Effect.TargetId, ProducedAmount);
-                    }
+                    ProducedItems.FindOrAdd(Effect.TargetId) += ProducedAmount;
                 }
             }
         }
     }
+
+    return ProducedItems;
 }
 
 void UBaseComponent::ProcessResourceConversion(float DeltaTime)
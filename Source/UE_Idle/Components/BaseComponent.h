@@ -103,6 +103,14 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Base Effects")
     float GetProductionSpeedMultiplier() const;
 
+    // 指定時間分の自動生産量（アイテムID → 数量）。生産速度倍率を含む
+    UFUNCTION(BlueprintCallable, Category = "Base Effects")
+    TMap<FString, int32> CalculateAutoProduction(float DeltaTime) const;
+
+    // 生産処理の間隔（秒）
+    UFUNCTION(BlueprintPure, Category = "Base Effects")
+    float GetProductionInterval() const { return PRODUCTION_INTERVAL; }
+
     UFUNCTION(BlueprintCallable, Category = "Base Effects")
     float GetResearchSpeedMultiplier() const;
 
@@ -1,4 +1,5 @@
 #include "CharacterBrain.h"
+#include "../UE_Idle.h"
 #include "TaskManagerComponent.h"
 #include "TeamComponent.h"
 #include "LocationMovementComponent.h"
@@ -37,18 +38,18 @@ void UCharacterBrain::InitializeReferences(UTaskManagerComponent* TaskManager, U
     
     if (bReferencesInitialized)
     {
-        UE_LOG(LogTemp, Log, TEXT("🧠 CharacterBrain references initialized successfully"));
+        UE_LOG(LogIdleAI, Log, TEXT("🧠 CharacterBrain references initialized successfully"));
     }
     else
     {
-        UE_LOG(LogTemp, Warning, TEXT("⚠️ CharacterBrain reference initialization failed"));
+        UE_LOG(LogIdleAI, Warning, TEXT("⚠️ CharacterBrain reference initialization failed"));
     }
 }
 
 void UCharacterBrain::SetCharacterReference(AC_IdleCharacter* Character)
 {
     CharacterRef = Character;
-    UE_LOG(LogTemp, Log, TEXT("🧠 CharacterBrain character reference set"));
+    UE_LOG(LogIdleAI, Log, TEXT("🧠 CharacterBrain character reference set"));
 }
 
 bool UCharacterBrain::AreReferencesValid() const
@@ -61,7 +62,7 @@ FCharacterAction UCharacterBrain::DecideOptimalAction(const FCharacterSituation&
     // 参照チェック
     if (!bReferencesInitialized || !AreReferencesValid())
     {
-        UE_LOG(LogTemp, Error, TEXT("🧠❌ CharacterBrain: References not initialized properly"));
+        UE_LOG(LogIdleAI, Error, TEXT("🧠❌ CharacterBrain: References not initialized properly"));
         return DecideWaitAction(Situation, TEXT("References not initialized"));
     }
 
@@ -81,12 +82,31 @@ FCharacterAction UCharacterBrain::DecideOptimalAction(const FCharacterSituation&
         case ETaskType::All:
             // 全てモード: TaskManagerから次の利用可能タスクを取得
             {
+                FCharacterSituation ModifiedSituation = Situation;
+                ModifiedSituation.TeamAssignedTask = ETaskType::Gathering;
+                
+                // 一括割り当てで決まった作業場所（割り当てがなければチームの採集場所）
+                const FString AllocatedLocation = GetTeamGatheringLocation(Situation.MyTeamIndex);
+                const FString AllocatedItem = AllocatedLocation.IsEmpty() ? FString() : GetTargetItemForTeam(Situation.MyTeamIndex, AllocatedLocation);
+                
                 FString TargetItem = GetTargetItemForTeam(Situation.MyTeamIndex, Situation.CurrentLocation);
                 if (!TargetItem.IsEmpty())
                 {
                     // 採集タスクとして処理
-                    FCharacterSituation ModifiedSituation = Situation;
-                    ModifiedSituation.TeamAssignedTask = ETaskType::Gathering;
+                    DecidedAction = DecideGatheringAction(ModifiedSituation);
+                }
+                else if (!AllocatedItem.IsEmpty() && Situation.CurrentLocation != TEXT("base") && !ShouldReturnToBase(Situation))
+                {
+                    // 割り当てられた場所へ直接移動
+                    DecidedAction.ActionType = ECharacterActionType::MoveToLocation;
+                    DecidedAction.TargetLocation = AllocatedLocation;
+                    DecidedAction.TargetItem = AllocatedItem;
+                    DecidedAction.ExpectedDuration = 2.0f;
+                    DecidedAction.ActionReason = FString::Printf(TEXT("Moving to allocated %s to gather %s"), *AllocatedLocation, *AllocatedItem);
+                }
+                else if (!AllocatedItem.IsEmpty())
+                {
+                    // 拠点では荷下ろし後に割り当て場所へ向かう
                     DecidedAction = DecideGatheringAction(ModifiedSituation);
                 }
                 else
@@ -110,7 +130,7 @@ FCharacterAction UCharacterBrain::DecideOptimalAction(const FCharacterSituation&
     
     // 決定されたアクションを明確にログ出力
     FString CharName = CharacterRef ? CharacterRef->GetName() : TEXT("Unknown");
-    UE_LOG(LogTemp, Warning, TEXT("🧠✅ %s: DECIDED ACTION = %d (%s) at %s targeting %s"), 
+    UE_LOG(LogIdleAI, Verbose, TEXT("🧠✅ %s: DECIDED ACTION = %d (%s) at %s targeting %s"), 
         *CharName, 
         (int32)DecidedAction.ActionType, 
         *DecidedAction.ActionReason,
@@ -120,6 +140,112 @@ FCharacterAction UCharacterBrain::DecideOptimalAction(const FCharacterSituation&
     return DecidedAction;
 }
 
+FCharacterAction UCharacterBrain::DecideOptimalActionFromSnapshot(const FCharacterSituation& Situation, const FBrainDecisionSnapshot& Snapshot)
+{
+    // 判断中は全ての共有状態参照をスナップショットに切り替える
+    // ブレインは1キャラクターにつき1つなので、ワーカー間で競合しない
+    ActiveSnapshot = &Snapshot;
+    FCharacterAction DecidedAction = DecideOptimalAction(Situation);
+    ActiveSnapshot = nullptr;
+    
+    return DecidedAction;
+}
+
+void UCharacterBrain::BuildDecisionSnapshot(const UTaskManagerComponent* TaskManager, const UTeamComponent* TeamComp,
+    const ULocationDataTableManager* LocationManager, const TArray<AC_IdleCharacter*>& Characters,
+    FBrainDecisionSnapshot& OutSnapshot)
+{
+    OutSnapshot.Reset();
+    
+    if (!TaskManager || !TeamComp)
+    {
+        UE_LOG(LogIdleAI, Warning, TEXT("🧠⚠️ BuildDecisionSnapshot: TaskManager or TeamComponent unavailable"));
+        return;
+    }
+    
+    // 判断ロジックが参照しうる場所（DecideGatheringActionと同じ候補を使う）
+    GetGatheringCandidateLocations(LocationManager, OutSnapshot.GatheringCandidateLocations);
+    TArray<FString> CandidateLocations;
+    CandidateLocations.Reserve(OutSnapshot.GatheringCandidateLocations.Num() + 1);
+    CandidateLocations.Add(TEXT("base"));
+    CandidateLocations.Append(OutSnapshot.GatheringCandidateLocations);
+    
+    for (AC_IdleCharacter* Character : Characters)
+    {
+        if (!IsValid(Character))
+        {
+            continue;
+        }
+        
+        // 所持アイテム総数
+        int32 TotalItems = 0;
+        if (UInventoryComponent* Inventory = Character->GetInventoryComponent())
+        {
+            for (const auto& Item : Inventory->GetAllItems())
+            {
+                TotalItems += Item.Value;
+            }
+        }
+        OutSnapshot.CarriedItemCounts.Add(Character, TotalItems);
+        
+        const FCharacterSituation Situation = Character->GetCurrentSituation();
+        const int32 TeamIndex = Situation.MyTeamIndex;
+        if (TeamIndex < 0)
+        {
+            continue;
+        }
+        
+        FTeamDecisionSnapshot* TeamSnapshot = OutSnapshot.Teams.Find(TeamIndex);
+        if (!TeamSnapshot)
+        {
+            TeamSnapshot = &OutSnapshot.Teams.Add(TeamIndex);
+            if (TeamComp->IsValidTeamIndex(TeamIndex))
+            {
+                const FTeam& Team = TeamComp->GetTeams()[TeamIndex];
+                TeamSnapshot->GatheringLocationId = Team.GatheringLocationId;
+                TeamSnapshot->AdventureLocationId = Team.AdventureLocationId;
+                
+                // 「全て」モードは一括割り当てで決まった作業場所を使う
+                const FTeamTaskAllocation* Allocation = Team.AssignedTask == ETaskType::All ? TaskManager->FindAllModeAllocation(TeamIndex) : nullptr;
+                if (Allocation && !Allocation->LocationId.IsEmpty())
+                {
+                    TeamSnapshot->GatheringLocationId = Allocation->LocationId;
+                }
+            }
+            
+            for (const FString& LocationId : CandidateLocations)
+            {
+                TeamSnapshot->TargetItemByLocation.Add(LocationId, TaskManager->GetTargetItemForTeam(TeamIndex, LocationId));
+            }
+            if (!TeamSnapshot->GatheringLocationId.IsEmpty() && !TeamSnapshot->TargetItemByLocation.Contains(TeamSnapshot->GatheringLocationId))
+            {
+                TeamSnapshot->TargetItemByLocation.Add(TeamSnapshot->GatheringLocationId,
+                    TaskManager->GetTargetItemForTeam(TeamIndex, TeamSnapshot->GatheringLocationId));
+            }
+        }
+        
+        // メンバーの現在地
+        if (!TeamSnapshot->TargetItemByLocation.Contains(Situation.CurrentLocation))
+        {
+            TeamSnapshot->TargetItemByLocation.Add(Situation.CurrentLocation,
+                TaskManager->GetTargetItemForTeam(TeamIndex, Situation.CurrentLocation));
+        }
+    }
+    
+    // 目標アイテムごとの採集場所
+    for (const auto& TeamPair : OutSnapshot.Teams)
+    {
+        for (const auto& LocationPair : TeamPair.Value.TargetItemByLocation)
+        {
+            const FString& TargetItem = LocationPair.Value;
+            if (!TargetItem.IsEmpty() && !OutSnapshot.GatheringLocationByItem.Contains(TargetItem))
+            {
+                OutSnapshot.GatheringLocationByItem.Add(TargetItem, ResolveGatheringLocation(LocationManager, TargetItem));
+            }
+        }
+    }
+}
+
 FCharacterAction UCharacterBrain::DecideGatheringAction(const FCharacterSituation& Situation)
 {
     FString CharName = CharacterRef ? CharacterRef->GetName() : TEXT("Unknown");
@@ -127,12 +253,12 @@ FCharacterAction UCharacterBrain::DecideGatheringAction(const FCharacterSituatio
     // 拠点にいる場合の完全処理
     if (Situation.CurrentLocation == TEXT("base"))
     {
-        UE_LOG(LogTemp, Warning, TEXT("🧠🏠 %s: At base, checking for unload"), *CharName);
+        UE_LOG(LogIdleAI, Verbose, TEXT("🧠🏠 %s: At base, checking for unload"), *CharName);
         
         // インベントリにアイテムがある場合は荷下ろし
         if (HasItemsToUnload(Situation))
         {
-            UE_LOG(LogTemp, Warning, TEXT("🧠📦 %s: Has items to unload, executing unload action"), *CharName);
+            UE_LOG(LogIdleAI, Verbose, TEXT("🧠📦 %s: Has items to unload, executing unload action"), *CharName);
             FCharacterAction UnloadAction;
             UnloadAction.ActionType = ECharacterActionType::UnloadItems;
             UnloadAction.TargetLocation = TEXT("base");
@@ -142,27 +268,27 @@ FCharacterAction UCharacterBrain::DecideGatheringAction(const FCharacterSituatio
         }
         else
         {
-            UE_LOG(LogTemp, Warning, TEXT("🧠📦 %s: No items to unload at base"), *CharName);
+            UE_LOG(LogIdleAI, Verbose, TEXT("🧠📦 %s: No items to unload at base"), *CharName);
             
             // 拠点で実行可能なタスクがあるかチェック
             FString TargetItemAtBase = GetTargetItemForTeam(Situation.MyTeamIndex, TEXT("base"));
             if (!TargetItemAtBase.IsEmpty())
             {
-                UE_LOG(LogTemp, Warning, TEXT("🧠🎯 %s: Found new task %s at base"), *CharName, *TargetItemAtBase);
+                UE_LOG(LogIdleAI, Verbose, TEXT("🧠🎯 %s: Found new task %s at base"), *CharName, *TargetItemAtBase);
                 // 拠点でのタスクがある場合は、以降の採集ロジックで処理
             }
             else
             {
-                UE_LOG(LogTemp, Warning, TEXT("🧠🔍 %s: No tasks at base, checking other locations"), *CharName);
+                UE_LOG(LogIdleAI, Verbose, TEXT("🧠🔍 %s: No tasks at base, checking other locations"), *CharName);
                 
                 // 他の場所でタスクがあるかチェック
-                TArray<FString> LocationsToCheck = {TEXT("plains"), TEXT("forest"), TEXT("mountain"), TEXT("swamp")};
+                const TArray<FString> LocationsToCheck = GetGatheringCandidateLocations();
                 for (const FString& LocationToCheck : LocationsToCheck)
                 {
                     FString TargetItemAtLocation = GetTargetItemForTeam(Situation.MyTeamIndex, LocationToCheck);
                     if (!TargetItemAtLocation.IsEmpty())
                     {
-                        UE_LOG(LogTemp, Warning, TEXT("🧠🚶 %s: Found task %s at %s, moving there"), 
+                        UE_LOG(LogIdleAI, Verbose, TEXT("🧠🚶 %s: Found task %s at %s, moving there"), 
                             *CharName, *TargetItemAtLocation, *LocationToCheck);
                         
                         // 移動アクションを返す
@@ -177,7 +303,7 @@ FCharacterAction UCharacterBrain::DecideGatheringAction(const FCharacterSituatio
                     }
                 }
                 
-                UE_LOG(LogTemp, Warning, TEXT("🧠😴 %s: No tasks available anywhere, waiting at base"), *CharName);
+                UE_LOG(LogIdleAI, Verbose, TEXT("🧠😴 %s: No tasks available anywhere, waiting at base"), *CharName);
                 return DecideWaitAction(Situation, TEXT("No tasks available anywhere"));
             }
         }
@@ -189,7 +315,7 @@ FCharacterAction UCharacterBrain::DecideGatheringAction(const FCharacterSituatio
         // 拠点帰還判定（既存ロジックの移植）
         if (ShouldReturnToBase(Situation))
         {
-            UE_LOG(LogTemp, Warning, TEXT("🧠🏠 %s: Should return to base from %s"), *CharName, *Situation.CurrentLocation);
+            UE_LOG(LogIdleAI, Verbose, TEXT("🧠🏠 %s: Should return to base from %s"), *CharName, *Situation.CurrentLocation);
             FCharacterAction ReturnAction;
             ReturnAction.ActionType = ECharacterActionType::ReturnToBase;
             ReturnAction.TargetLocation = TEXT("base");
@@ -202,13 +328,13 @@ FCharacterAction UCharacterBrain::DecideGatheringAction(const FCharacterSituatio
     // 現在地でのターゲットアイテムチェック（直接アプローチ）
     FString TargetItem = GetTargetItemForTeam(Situation.MyTeamIndex, Situation.CurrentLocation);
     
-    UE_LOG(LogTemp, Warning, TEXT("🧠🎯 %s: At %s, found target item: %s"), 
+    UE_LOG(LogIdleAI, Verbose, TEXT("🧠🎯 %s: At %s, found target item: %s"), 
         *CharName, *Situation.CurrentLocation, *TargetItem);
     
     if (!TargetItem.IsEmpty())
     {
         // 現在地でタスクがある場合は即座に採集実行
-        UE_LOG(LogTemp, Warning, TEXT("🧠🌱 %s: Executing gathering for %s at current location %s"), 
+        UE_LOG(LogIdleAI, Verbose, TEXT("🧠🌱 %s: Executing gathering for %s at current location %s"), 
             *CharName, *TargetItem, *Situation.CurrentLocation);
         
         FCharacterAction GatherAction;
@@ -224,11 +350,11 @@ FCharacterAction UCharacterBrain::DecideGatheringAction(const FCharacterSituatio
     FString TeamGatheringLocation = GetTeamGatheringLocation(Situation.MyTeamIndex);
     if (TeamGatheringLocation.IsEmpty())
     {
-        UE_LOG(LogTemp, Warning, TEXT("🧠⚠️ No gathering location set for team %d"), Situation.MyTeamIndex);
+        UE_LOG(LogIdleAI, Warning, TEXT("🧠⚠️ No gathering location set for team %d"), Situation.MyTeamIndex);
         return DecideWaitAction(Situation, TEXT("No gathering location set for team"));
     }
     
-    UE_LOG(LogTemp, VeryVerbose, TEXT("🧠🌱 Using team gathering location: %s"), *TeamGatheringLocation);
+    UE_LOG(LogIdleAI, VeryVerbose, TEXT("🧠🌱 Using team gathering location: %s"), *TeamGatheringLocation);
     TargetItem = GetTargetItemForTeam(Situation.MyTeamIndex, TeamGatheringLocation);
     
     if (TargetItem.IsEmpty())
@@ -289,8 +415,19 @@ FCharacterAction UCharacterBrain::DecideAdventureAction(const FCharacterSituatio
     }
     
     // チームの冒険先を取得
-    FTeam Team = TeamComponentRef->GetTeam(Situation.MyTeamIndex);
-    FString AdventureLocation = Team.AdventureLocationId;
+    FString AdventureLocation;
+    if (ActiveSnapshot)
+    {
+        if (const FTeamDecisionSnapshot* TeamSnapshot = ActiveSnapshot->FindTeam(Situation.MyTeamIndex))
+        {
+            AdventureLocation = TeamSnapshot->AdventureLocationId;
+        }
+    }
+    else
+    {
+        FTeam Team = TeamComponentRef->GetTeam(Situation.MyTeamIndex);
+        AdventureLocation = Team.AdventureLocationId;
+    }
     
     if (AdventureLocation.IsEmpty())
     {
@@ -332,6 +469,13 @@ FCharacterAction UCharacterBrain::DecideWaitAction(const FCharacterSituation& Si
 
 FString UCharacterBrain::FindGatheringLocation(const FString& TargetItem)
 {
+    // 判断フェーズ中はスナップショットから取得
+    if (ActiveSnapshot)
+    {
+        const FString* Location = ActiveSnapshot->GatheringLocationByItem.Find(TargetItem);
+        return Location ? *Location : FString();
+    }
+    
     // 既存のLocationDataTableManagerを使用した場所検索（TimeManagerロジックの移植）
     if (!IsValid(GetWorld()))
     {
@@ -341,36 +485,101 @@ FString UCharacterBrain::FindGatheringLocation(const FString& TargetItem)
     ULocationDataTableManager* LocationManager = GetWorld()->GetGameInstance()->GetSubsystem<ULocationDataTableManager>();
     if (!LocationManager)
     {
-        UE_LOG(LogTemp, Warning, TEXT("🧠 CharacterBrain: LocationDataTableManager not found"));
+        UE_LOG(LogIdleAI, Warning, TEXT("🧠 CharacterBrain: LocationDataTableManager not found"));
+        return TEXT("");
+    }
+    
+    return ResolveGatheringLocation(LocationManager, TargetItem);
+}
+
+FString UCharacterBrain::ResolveGatheringLocation(const ULocationDataTableManager* LocationManager, const FString& TargetItem)
+{
+    if (!LocationManager)
+    {
         return TEXT("");
     }
     
     // 平野での採集を優先（既存ロジックと同じ）
-    TArray<FString> GatherableItems;
-    FLocationDataRow PlainsData;
-    if (LocationManager->GetLocationData(TEXT("plains"), PlainsData))
+    if (LocationManager->CanGatherItemAt(TEXT("plains"), TargetItem))
     {
-        PlainsData.GetGatherableItemIds(GatherableItems);
-        if (GatherableItems.Contains(TargetItem))
-        {
-            return TEXT("plains");
-        }
+        return TEXT("plains");
     }
     
     // 拠点での採集もチェック
-    FLocationDataRow BaseData;
-    if (LocationManager->GetLocationData(TEXT("base"), BaseData))
+    if (LocationManager->CanGatherItemAt(TEXT("base"), TargetItem))
+    {
+        return TEXT("base");
+    }
+    
+    // それ以外はDataTableの行順で最初に採集できる場所
+    const TArray<FString>& Locations = LocationManager->GetLocationsForItem(TargetItem);
+    if (Locations.Num() > 0)
     {
-        GatherableItems.Empty();
-        BaseData.GetGatherableItemIds(GatherableItems);
-        if (GatherableItems.Contains(TargetItem))
+        return Locations[0];
+    }
+    
+    UE_LOG(LogIdleAI, VeryVerbose, TEXT("🧠 CharacterBrain: No gathering location found for item: %s"), *TargetItem);
+    return TEXT("");
+}
+
+void UCharacterBrain::GetGatheringCandidateLocations(const ULocationDataTableManager* LocationManager, TArray<FString>& OutLocations)
+{
+    OutLocations.Reset();
+    
+    if (!LocationManager)
+    {
+        return;
+    }
+    
+    for (const FString& LocationId : LocationManager->GetGatherableLocationIds())
+    {
+        if (LocationId != TEXT("base"))
         {
-            return TEXT("base");
+            OutLocations.Add(LocationId);
         }
     }
+}
+
+TArray<FString> UCharacterBrain::GetGatheringCandidateLocations() const
+{
+    // 判断フェーズ中はスナップショットから取得
+    if (ActiveSnapshot)
+    {
+        return ActiveSnapshot->GatheringCandidateLocations;
+    }
     
-    UE_LOG(LogTemp, VeryVerbose, TEXT("🧠 CharacterBrain: No gathering location found for item: %s"), *TargetItem);
-    return TEXT("");
+    TArray<FString> Locations;
+    UWorld* World = GetWorld();
+    UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+    if (GameInstance)
+    {
+        GetGatheringCandidateLocations(GameInstance->GetSubsystem<ULocationDataTableManager>(), Locations);
+    }
+    return Locations;
+}
+
+int32 UCharacterBrain::GetCarriedItemCount() const
+{
+    if (!CharacterRef)
+    {
+        return 0;
+    }
+    
+    if (ActiveSnapshot)
+    {
+        const int32* Count = ActiveSnapshot->CarriedItemCounts.Find(CharacterRef);
+        return Count ? *Count : 0;
+    }
+    
+    int32 TotalItems = 0;
+    if (UInventoryComponent* Inventory = CharacterRef->GetInventoryComponent())
+    {
+        for (const auto& Item : Inventory->GetAllItems())
+        {
+            TotalItems += Item.Value;
+        }
+    }
+    return TotalItems;
 }
 
 bool UCharacterBrain::ShouldReturnToBase(const FCharacterSituation& Situation)
@@ -385,25 +594,20 @@ bool UCharacterBrain::ShouldReturnToBase(const FCharacterSituation& Situation)
     FString TargetItem = GetTargetItemForTeam(Situation.MyTeamIndex, Situation.CurrentLocation);
     if (TargetItem.IsEmpty())
     {
-        UE_LOG(LogTemp, VeryVerbose, TEXT("🧠🏠 %s: No target item at current location, should return to base"), 
+        UE_LOG(LogIdleAI, VeryVerbose, TEXT("🧠🏠 %s: No target item at current location, should return to base"), 
             CharacterRef ? *CharacterRef->GetName() : TEXT("Unknown"));
         return true;
     }
     
     // 2. インベントリ容量チェック
-    if (CharacterRef && CharacterRef->GetInventoryComponent())
+    if (CharacterRef)
     {
-        TMap<FString, int32> AllItems = CharacterRef->GetInventoryComponent()->GetAllItems();
-        int32 TotalItems = 0;
-        for (const auto& Item : AllItems)
-        {
-            TotalItems += Item.Value;
-        }
+        const int32 TotalItems = GetCarriedItemCount();
         
         // 20個以上持っている場合は帰還
         if (TotalItems >= 20)
         {
-            UE_LOG(LogTemp, VeryVerbose, TEXT("🧠🏠 %s: Inventory full (%d items), should return to base"), 
+            UE_LOG(LogIdleAI, VeryVerbose, TEXT("🧠🏠 %s: Inventory full (%d items), should return to base"), 
                 CharacterRef ? *CharacterRef->GetName() : TEXT("Unknown"), TotalItems);
             return true;
         }
@@ -435,10 +639,16 @@ bool UCharacterBrain::HasItemsToUnload(const FCharacterSituation& Situation)
         return false;
     }
     
+    // 判断フェーズ中はスナップショットの所持数のみで判定
+    if (ActiveSnapshot)
+    {
+        return GetCarriedItemCount() > 0;
+    }
+    
     UInventoryComponent* Inventory = CharacterRef->GetInventoryComponent();
     if (!Inventory)
     {
-        UE_LOG(LogTemp, Warning, TEXT("🧠📦 Character %s: No inventory component"), 
+        UE_LOG(LogIdleAI, Warning, TEXT("🧠📦 Character %s: No inventory component"), 
             CharacterRef ? *CharacterRef->GetName() : TEXT("Unknown"));
         return false;
     }
@@ -452,48 +662,69 @@ bool UCharacterBrain::HasItemsToUnload(const FCharacterSituation& Situation)
         for (const auto& Item : AllItems)
         {
             TotalItems += Item.Value;
-            UE_LOG(LogTemp, Warning, TEXT("🧠📦 Character %s has item: %s x%d"), 
+            UE_LOG(LogIdleAI, Verbose, TEXT("🧠📦 Character %s has item: %s x%d"), 
                 *CharacterName, *Item.Key, Item.Value);
         }
-        UE_LOG(LogTemp, Warning, TEXT("🧠📦 Character %s has %d total items to unload"), 
+        UE_LOG(LogIdleAI, Verbose, TEXT("🧠📦 Character %s has %d total items to unload"), 
             *CharacterName, TotalItems);
         return true;
     }
     else
     {
-        UE_LOG(LogTemp, Warning, TEXT("🧠📦 Character %s has no items to unload"), *CharacterName);
+        UE_LOG(LogIdleAI, Verbose, TEXT("🧠📦 Character %s has no items to unload"), *CharacterName);
         return false;
     }
 }
 
 FString UCharacterBrain::GetTargetItemForTeam(int32 TeamIndex, const FString& LocationId)
 {
+    // 判断フェーズ中はスナップショットから取得
+    if (ActiveSnapshot)
+    {
+        const FTeamDecisionSnapshot* TeamSnapshot = ActiveSnapshot->FindTeam(TeamIndex);
+        const FString* TargetItem = TeamSnapshot ? TeamSnapshot->TargetItemByLocation.Find(LocationId) : nullptr;
+        return TargetItem ? *TargetItem : FString();
+    }
+    
     // TaskManagerの既存ロジックを使用
     if (!TaskManagerRef)
     {
-        UE_LOG(LogTemp, Warning, TEXT("🧠 CharacterBrain: TaskManager reference not available"));
+        UE_LOG(LogIdleAI, Warning, TEXT("🧠 CharacterBrain: TaskManager reference not available"));
         return TEXT("");
     }
     
-    UE_LOG(LogTemp, VeryVerbose, TEXT("🧠🎯 CharacterBrain: Requesting target item for Team %d at location %s"), TeamIndex, *LocationId);
+    UE_LOG(LogIdleAI, VeryVerbose, TEXT("🧠🎯 CharacterBrain: Requesting target item for Team %d at location %s"), TeamIndex, *LocationId);
     FString TargetItem = TaskManagerRef->GetTargetItemForTeam(TeamIndex, LocationId);
-    UE_LOG(LogTemp, VeryVerbose, TEXT("🧠📦 CharacterBrain: TaskManager returned target item: '%s'"), *TargetItem);
+    UE_LOG(LogIdleAI, VeryVerbose, TEXT("🧠📦 CharacterBrain: TaskManager returned target item: '%s'"), *TargetItem);
     
     return TargetItem;
 }
 
 FString UCharacterBrain::GetTeamGatheringLocation(int32 TeamIndex)
 {
+    if (ActiveSnapshot)
+    {
+        const FTeamDecisionSnapshot* TeamSnapshot = ActiveSnapshot->FindTeam(TeamIndex);
+        return TeamSnapshot ? TeamSnapshot->GatheringLocationId : FString();
+    }
+    
     if (!TeamComponentRef)
     {
-        UE_LOG(LogTemp, Warning, TEXT("🧠⚠️ CharacterBrain: TeamComponent reference not available"));
+        UE_LOG(LogIdleAI, Warning, TEXT("🧠⚠️ CharacterBrain: TeamComponent reference not available"));
         return TEXT("");
     }
     
     FTeam Team = TeamComponentRef->GetTeam(TeamIndex);
     FString GatheringLocation = Team.GatheringLocationId;
     
-    UE_LOG(LogTemp, VeryVerbose, TEXT("🧠🌱 GetTeamGatheringLocation: Team %d gathering location: %s"), 
+    // 「全て」モードは一括割り当てで決まった作業場所を使う
+    const FTeamTaskAllocation* Allocation = (Team.AssignedTask == ETaskType::All && TaskManagerRef) ? TaskManagerRef->FindAllModeAllocation(TeamIndex) : nullptr;
+    if (Allocation && !Allocation->LocationId.IsEmpty())
+    {
+        GatheringLocation = Allocation->LocationId;
+    }
+    
+    UE_LOG(LogIdleAI, VeryVerbose, TEXT("🧠🌱 GetTeamGatheringLocation: Team %d gathering location: %s"), 
         TeamIndex, *GatheringLocation);
     
     return GatheringLocation;
@@ -547,14 +778,14 @@ FCharacterAction UCharacterBrain::ApplyPersonalityModifiers(const FCharacterActi
 void UCharacterBrain::SetPersonality(ECharacterPersonality NewPersonality)
 {
     MyPersonality = NewPersonality;
-    UE_LOG(LogTemp, Log, TEXT("🧠 CharacterBrain: Personality set to %d"), (int32)NewPersonality);
+    UE_LOG(LogIdleAI, Log, TEXT("🧠 CharacterBrain: Personality set to %d"), (int32)NewPersonality);
 }
 
 void UCharacterBrain::LogDecisionProcess(const FCharacterSituation& Situation, const FCharacterAction& Decision)
 {
-    if (UE_LOG_ACTIVE(LogTemp, VeryVerbose))
+    if (UE_LOG_ACTIVE(LogIdleAI, VeryVerbose))
     {
-        UE_LOG(LogTemp, VeryVerbose, 
+        UE_LOG(LogIdleAI, VeryVerbose, 
             TEXT("🧠 CharacterBrain Decision: Team=%d, Location=%s, Task=%d -> Action=%d (%s)"),
             Situation.MyTeamIndex,
             *Situation.CurrentLocation,
@@ -616,6 +847,6 @@ void UCharacterBrain::InitializePersonalityPreferences()
         }
     }
     
-    UE_LOG(LogTemp, Log, TEXT("🧠 CharacterBrain: Action preferences initialized for personality %d"), (int32)MyPersonality);
+    UE_LOG(LogIdleAI, Log, TEXT("🧠 CharacterBrain: Action preferences initialized for personality %d"), (int32)MyPersonality);
 }
 
@@ -12,6 +12,49 @@
 // Forward declarations
 class AC_IdleCharacter;
 class UTaskManagerComponent;
+class ULocationDataTableManager;
+
+/**
+ * 判断フェーズ用のチーム別スナップショット
+ */
+struct FTeamDecisionSnapshot
+{
+    // 場所ID → 目標アイテムID（GetTargetItemForTeamの結果）
+    TMap<FString, FString> TargetItemByLocation;
+
+    FString GatheringLocationId;
+    FString AdventureLocationId;
+};
+
+/**
+ * ターン判断フェーズ用の読み取り専用スナップショット
+ * スナップショットフェーズ（ゲームスレッド）で構築し、
+ * 判断フェーズではParallelForの各ワーカーから読み取りのみ行う
+ */
+struct UE_IDLE_API FBrainDecisionSnapshot
+{
+    // チームインデックス → チーム情報
+    TMap<int32, FTeamDecisionSnapshot> Teams;
+
+    // アイテムID → 採集場所ID
+    TMap<FString, FString> GatheringLocationByItem;
+
+    // 拠点以外の採集可能な場所（DecideGatheringActionの探索順）
+    TArray<FString> GatheringCandidateLocations;
+
+    // キャラクター → 所持アイテム総数
+    TMap<const AC_IdleCharacter*, int32> CarriedItemCounts;
+
+    void Reset()
+    {
+        Teams.Reset();
+        GatheringLocationByItem.Reset();
+        GatheringCandidateLocations.Reset();
+        CarriedItemCounts.Reset();
+    }
+
+    const FTeamDecisionSnapshot* FindTeam(int32 TeamIndex) const { return Teams.Find(TeamIndex); }
+};
 
 /**
  * キャラクター自律判断システムの基底クラス
@@ -37,6 +80,35 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Decision")
     FCharacterAction DecideOptimalAction(const FCharacterSituation& Situation);
 
+    /**
+     * スナップショットのみを参照して最適な行動を決定する（ワーカースレッドから呼び出し可能）
+     * 共有状態へのアクセスは全てSnapshotに置き換えられ、ワールドの変更は行わない
+     * @param Situation 現在のキャラクター状況
+     * @param Snapshot 判断フェーズ用スナップショット
+     * @return 決定された行動
+     */
+    FCharacterAction DecideOptimalActionFromSnapshot(const FCharacterSituation& Situation, const FBrainDecisionSnapshot& Snapshot);
+
+    /**
+     * 判断フェーズ用スナップショットを構築する（ゲームスレッド専用）
+     * @param TaskManager タスクマネージャー
+     * @param TeamComp チームコンポーネント
+     * @param LocationManager 場所データマネージャー
+     * @param Characters 判断対象キャラクター（状況分析済み）
+     * @param OutSnapshot 構築結果
+     */
+    static void BuildDecisionSnapshot(const UTaskManagerComponent* TaskManager, const UTeamComponent* TeamComp,
+        const ULocationDataTableManager* LocationManager, const TArray<AC_IdleCharacter*>& Characters,
+        FBrainDecisionSnapshot& OutSnapshot);
+
+    /**
+     * 拠点以外で採集可能な場所をDataTableの行順で取得
+     * 判断フェーズの探索とスナップショット構築の双方が同じ候補を使う
+     * @param LocationManager 場所データマネージャー
+     * @param OutLocations 採集可能な場所ID
+     */
+    static void GetGatheringCandidateLocations(const ULocationDataTableManager* LocationManager, TArray<FString>& OutLocations);
+
     /**
      * キャラクターの性格を設定
      * @param NewPersonality 新しい性格タイプ
@@ -108,6 +180,24 @@ protected:
      */
     FString FindGatheringLocation(const FString& TargetItem);
 
+    /**
+     * LocationDataTableManagerから採集場所を解決（平野→拠点の順）
+     * @param LocationManager 場所データマネージャー
+     * @param TargetItem 採集対象アイテム
+     * @return 採集場所ID
+     */
+    static FString ResolveGatheringLocation(const ULocationDataTableManager* LocationManager, const FString& TargetItem);
+
+    /**
+     * 判断で参照する拠点以外の採集候補地（スナップショット優先）
+     */
+    TArray<FString> GetGatheringCandidateLocations() const;
+
+    /**
+     * 所有キャラクターの所持アイテム総数（スナップショット優先）
+     */
+    int32 GetCarriedItemCount() const;
+
     /**
      * 拠点に帰還すべきかの判定（TimeManagerからの移植）
      * @param Situation 現在の状況
@@ -211,6 +301,12 @@ private:
      */
     bool bReferencesInitialized;
 
+    /**
+     * 判断フェーズ中のみ有効なスナップショット
+     * 設定中は共有コンポーネントへ直接アクセスしない
+     */
+    const FBrainDecisionSnapshot* ActiveSnapshot = nullptr;
+
     // ===========================================
     // 内部ヘルパー関数
     // ===========================================
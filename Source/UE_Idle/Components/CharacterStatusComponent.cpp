@@ -2,6 +2,8 @@
 #include "../Actor/C_IdleCharacter.h"
 #include "../Components/InventoryComponent.h"
 #include "../Managers/ItemDataTableManager.h"
+#include "../Managers/CharacterRosterManager.h"
+#include "TimeManagerComponent.h"
 #include "Engine/World.h"
 
 UCharacterStatusComponent::UCharacterStatusComponent()
@@ -26,6 +28,8 @@ void UCharacterStatusComponent::BeginPlay()
 void UCharacterStatusComponent::SetStatus(const FCharacterStatus& NewStatus)
 {
 	Status = NewStatus;
+	PushCarryingCapacityToInventory();
+	MarkRosterStatusChanged();
 	
 	// イベント通知
 	OnStatusChanged.Broadcast(NewStatus);
@@ -81,6 +85,17 @@ void UCharacterStatusComponent::RecalculateDerivedStats()
 	CalculateCraftingPower();
 	CalculateCombatStats();
 	CalculateDisplayStats();
+
+	PushCarryingCapacityToInventory();
+	MarkRosterStatusChanged();
+}
+
+void UCharacterStatusComponent::MarkRosterStatusChanged() const
+{
+	if (UCharacterRosterManager* Roster = UCharacterRosterManager::Get(this))
+	{
+		Roster->MarkStatusChanged();
+	}
 }
 
 void UCharacterStatusComponent::OnEquipmentChanged()
@@ -634,6 +649,7 @@ void UCharacterStatusComponent::RemoveModifier(const FString& ModifierId)
 		{
 			GetWorld()->GetTimerManager().ClearTimer(TimedModifiers[TimedIndex].TimerHandle);
 		}
+		CancelTimedModifierEvent(TimedModifiers[TimedIndex]);
 		
 		TimedModifiers.RemoveAt(TimedIndex);
 		UE_LOG(LogTemp, Log, TEXT("CharacterStatusComponent::RemoveModifier - Removed timed modifier %s"), *ModifierId);
@@ -672,12 +688,31 @@ void UCharacterStatusComponent::AddTimedModifier(const FAttributeModifier& Modif
 	// タイマー設定
 	FTimedModifier NewTimedModifier(TimedModifier);
 	
-	GetWorld()->GetTimerManager().SetTimer(
-		NewTimedModifier.TimerHandle,
-		FTimerDelegate::CreateUFunction(this, FName("OnTimedModifierExpired"), Modifier.ModifierId),
-		Duration,
-		false // 繰り返しなし
-	);
+	// ターン時計が動いていればイベントとして予約（1ターン = ゲーム内1秒、ポーズとゲーム速度に追従）
+	UTimeManagerComponent* TimeManager = UTimeManagerComponent::Get(this);
+	if (TimeManager && TimeManager->IsTimeSystemActive())
+	{
+		TWeakObjectPtr<UCharacterStatusComponent> WeakThis(this);
+		const FString ModifierId = Modifier.ModifierId;
+		NewTimedModifier.ScheduledEventId = TimeManager->ScheduleTurnEvent(
+			EIdleTimeEventType::ModifierExpiry, FMath::CeilToInt(Duration),
+			[WeakThis, ModifierId]()
+			{
+				if (WeakThis.IsValid())
+				{
+					WeakThis->OnTimedModifierExpired(ModifierId);
+				}
+			});
+	}
+	else
+	{
+		GetWorld()->GetTimerManager().SetTimer(
+			NewTimedModifier.TimerHandle,
+			FTimerDelegate::CreateUFunction(this, FName("OnTimedModifierExpired"), Modifier.ModifierId),
+			Duration,
+			false // 繰り返しなし
+		);
+	}
 
 	TimedModifiers.Add(NewTimedModifier);
 
@@ -704,6 +739,10 @@ void UCharacterStatusComponent::ClearAllModifiers()
 			}
 		}
 	}
+	for (const FTimedModifier& TimedMod : TimedModifiers)
+	{
+		CancelTimedModifierEvent(TimedMod);
+	}
 
 	// 配列クリア
 	ActiveModifiers.Empty();
@@ -933,6 +972,19 @@ int32 UCharacterStatusComponent::FindModifierIndex(const FString& ModifierId) co
 	return INDEX_NONE;
 }
 
+void UCharacterStatusComponent::CancelTimedModifierEvent(const FTimedModifier& TimedModifier)
+{
+	if (TimedModifier.ScheduledEventId == 0)
+	{
+		return;
+	}
+
+	if (UTimeManagerComponent* TimeManager = UTimeManagerComponent::Get(this))
+	{
+		TimeManager->CancelTurnEvent(TimedModifier.ScheduledEventId);
+	}
+}
+
 int32 UCharacterStatusComponent::FindTimedModifierIndex(const FString& ModifierId) const
 {
 	for (int32 i = 0; i < TimedModifiers.Num(); i++)
@@ -943,4 +995,18 @@ int32 UCharacterStatusComponent::FindTimedModifierIndex(const FString& ModifierI
 		}
 	}
 	return INDEX_NONE;
-}
\ No newline at end of file
+}
+
+void UCharacterStatusComponent::PushCarryingCapacityToInventory() const
+{
+	AC_IdleCharacter* Character = Cast<AC_IdleCharacter>(GetOwner());
+	if (!Character)
+	{
+		return;
+	}
+
+	if (UInventoryComponent* InventoryComp = Character->GetInventoryComponent())
+	{
+		InventoryComp->SetMaxCarryingCapacity(GetCarryingCapacity());
+	}
+}
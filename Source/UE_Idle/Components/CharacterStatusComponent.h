@@ -262,6 +262,9 @@ private:
 	UFUNCTION()
 	void OnTimedModifierExpired(FString ModifierId);
 
+	// ターン時計上の期限イベントを取り消す
+	void CancelTimedModifierEvent(const FTimedModifier& TimedModifier);
+
 	// Modifier統合処理
 	void RecalculateStatsWithModifiers();
 
@@ -271,4 +274,10 @@ private:
 	// Modifier検索ヘルパー
 	int32 FindModifierIndex(const FString& ModifierId) const;
 	int32 FindTimedModifierIndex(const FString& ModifierId) const;
+
+	// 積載量を所有キャラクターのインベントリへ反映（ステータス・才能・Modifier・装備の変更時）
+	void PushCarryingCapacityToInventory() const;
+
+	// ワールドの名簿に能力値の変更を知らせる（能力値に依存するキャッシュの無効化用）
+	void MarkRosterStatusChanged() const;
 };
\ No newline at end of file
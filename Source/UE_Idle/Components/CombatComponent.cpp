@@ -1,4 +1,5 @@
 #include "CombatComponent.h"
+#include "../UE_Idle.h"
 #include "../Actor/C_IdleCharacter.h"
 #include "../C_PlayerController.h"
 #include "EventLogManager.h"
@@ -33,27 +34,27 @@ bool UCombatComponent::StartCombat(const FTeam& AllyTeam, const TArray<AC_IdleCh
 {
     if (CurrentState != ECombatState::Inactive)
     {
-        UE_LOG(LogTemp, Warning, TEXT("Combat already active, cannot start new combat"));
+        UE_LOG(LogIdleCombat, Warning, TEXT("Combat already active, cannot start new combat"));
         return false;
     }
 
     if (AllyTeam.Members.Num() == 0)
     {
-        UE_LOG(LogTemp, Error, TEXT("Cannot start combat with empty ally team"));
+        UE_LOG(LogIdleCombat, Error, TEXT("Cannot start combat with empty ally team"));
         return false;
     }
 
     if (EnemyTeam.Num() == 0)
     {
-        UE_LOG(LogTemp, Error, TEXT("Cannot start combat with empty enemy team"));
+        UE_LOG(LogIdleCombat, Error, TEXT("Cannot start combat with empty enemy team"));
         return false;
     }
 
-    UE_LOG(LogTemp, Log, TEXT("Starting combat with %d allies vs %d enemies at location %s"), 
+    UE_LOG(LogIdleCombat, Log, TEXT("Starting combat with %d allies vs %d enemies at location %s"), 
         AllyTeam.Members.Num(), EnemyTeam.Num(), *LocationId);
     
     // 全キャラクターのHP状態をログ出力（安全チェック付き）
-    UE_LOG(LogTemp, Log, TEXT("=== ALLY TEAM HP STATUS ==="));
+    UE_LOG(LogIdleCombat, Log, TEXT("=== ALLY TEAM HP STATUS ==="));
     if (AllyTeam.Members.IsValidIndex(0))
     {
         for (int32 i = 0; i < AllyTeam.Members.Num(); i++)
@@ -64,27 +65,27 @@ bool UCombatComponent::StartCombat(const FTeam& AllyTeam, const TArray<AC_IdleCh
                 {
                     float CurrentHP = StatusComp->GetCurrentHealth();
                     float MaxHP = StatusComp->GetMaxHealth();
-                    UE_LOG(LogTemp, Log, TEXT("Ally %d: %s - HP: %f/%f"), i, 
+                    UE_LOG(LogIdleCombat, Log, TEXT("Ally %d: %s - HP: %f/%f"), i, 
                         *AllyTeam.Members[i]->GetName(), CurrentHP, MaxHP);
                 }
                 else
                 {
-                    UE_LOG(LogTemp, Warning, TEXT("Ally %d: %s - NO STATUS COMPONENT"), i, 
+                    UE_LOG(LogIdleCombat, Warning, TEXT("Ally %d: %s - NO STATUS COMPONENT"), i, 
                         *AllyTeam.Members[i]->GetName());
                 }
             }
             else
             {
-                UE_LOG(LogTemp, Warning, TEXT("Ally %d: INVALID CHARACTER"), i);
+                UE_LOG(LogIdleCombat, Warning, TEXT("Ally %d: INVALID CHARACTER"), i);
             }
         }
     }
     else
     {
-        UE_LOG(LogTemp, Log, TEXT("Ally team is empty"));
+        UE_LOG(LogIdleCombat, Log, TEXT("Ally team is empty"));
     }
     
-    UE_LOG(LogTemp, Log, TEXT("=== ENEMY TEAM HP STATUS ==="));
+    UE_LOG(LogIdleCombat, Log, TEXT("=== ENEMY TEAM HP STATUS ==="));
     if (EnemyTeam.IsValidIndex(0))
     {
         for (int32 i = 0; i < EnemyTeam.Num(); i++)
@@ -95,24 +96,24 @@ bool UCombatComponent::StartCombat(const FTeam& AllyTeam, const TArray<AC_IdleCh
                 {
                     float CurrentHP = StatusComp->GetCurrentHealth();
                     float MaxHP = StatusComp->GetMaxHealth();
-                    UE_LOG(LogTemp, Log, TEXT("Enemy %d: %s - HP: %f/%f"), i, 
+                    UE_LOG(LogIdleCombat, Log, TEXT("Enemy %d: %s - HP: %f/%f"), i, 
                         *EnemyTeam[i]->GetName(), CurrentHP, MaxHP);
                 }
                 else
                 {
-                    UE_LOG(LogTemp, Warning, TEXT("Enemy %d: %s - NO STATUS COMPONENT"), i, 
+                    UE_LOG(LogIdleCombat, Warning, TEXT("Enemy %d: %s - NO STATUS COMPONENT"), i, 
                         *EnemyTeam[i]->GetName());
                 }
             }
             else
             {
-                UE_LOG(LogTemp, Warning, TEXT("Enemy %d: INVALID CHARACTER"), i);
+                UE_LOG(LogIdleCombat, Warning, TEXT("Enemy %d: INVALID CHARACTER"), i);
             }
         }
     }
     else
     {
-        UE_LOG(LogTemp, Log, TEXT("Enemy team is empty"));
+        UE_LOG(LogIdleCombat, Log, TEXT("Enemy team is empty"));
     }
 
     // チーム設定
@@ -159,7 +160,7 @@ void UCombatComponent::ForceEndCombat()
         return;
     }
 
-    UE_LOG(LogTemp, Log, TEXT("Force ending combat"));
+    UE_LOG(LogIdleCombat, Log, TEXT("Force ending combat"));
     
     SetCombatState(ECombatState::Completed, TEXT("戦闘が強制終了されました"));
     CleanupAfterCombat();
@@ -200,7 +201,7 @@ void UCombatComponent::SetCombatState(ECombatState NewState, const FString& Stat
     ECombatState OldState = CurrentState;
     CurrentState = NewState;
 
-    UE_LOG(LogTemp, Log, TEXT("Combat state changed: %s -> %s (%s)"), 
+    UE_LOG(LogIdleCombat, Log, TEXT("Combat state changed: %s -> %s (%s)"), 
         *UEnum::GetValueAsString(OldState), 
         *UEnum::GetValueAsString(NewState), 
         *StateInfo);
@@ -212,7 +213,7 @@ bool UCombatComponent::SpawnEnemiesAtLocation(const FString& LocationId)
 {
     // 非推奨: 敵のスポーンはLocationEventManagerで処理される
     // このメソッドは互換性のために残しているが、使用しない
-    UE_LOG(LogTemp, Warning, TEXT("SpawnEnemiesAtLocation is deprecated. Use LocationEventManager instead."));
+    UE_LOG(LogIdleCombat, Warning, TEXT("SpawnEnemiesAtLocation is deprecated. Use LocationEventManager instead."));
     return false;
 }
 
@@ -234,20 +235,20 @@ void UCombatComponent::CheckCombatCompletion()
 
     if (AliveAllies.Num() == 0 || AliveEnemies.Num() == 0)
     {
-        UE_LOG(LogTemp, Log, TEXT("Combat ending - One side has no alive members"));
+        UE_LOG(LogIdleCombat, Log, TEXT("Combat ending - One side has no alive members"));
         
         // 戦闘終了処理を順序制御で実行
         ExecuteCombatEndSequence(AliveAllies, AliveEnemies);
     }
     else
     {
-        UE_LOG(LogTemp, VeryVerbose, TEXT("Combat continues - Both sides have alive members"));
+        UE_LOG(LogIdleCombat, VeryVerbose, TEXT("Combat continues - Both sides have alive members"));
     }
 }
 
 void UCombatComponent::ExecuteCombatEndSequence(const TArray<AC_IdleCharacter*>& AliveAllies, const TArray<AC_IdleCharacter*>& AliveEnemies)
 {
-    UE_LOG(LogTemp, Log, TEXT("=== Starting Combat End Sequence ==="));
+    UE_LOG(LogIdleCombat, Log, TEXT("=== Starting Combat End Sequence ==="));
     
     // Step 1: 勝者・敗者を決定（ActionSystemはまだ動作中）
     TArray<AC_IdleCharacter*> Winners = (AliveAllies.Num() > 0) ? AliveAllies : AliveEnemies;
@@ -266,19 +267,19 @@ void UCombatComponent::ExecuteCombatEndSequence(const TArray<AC_IdleCharacter*>&
         {
             if (PC->EventLogManager)
             {
-                UE_LOG(LogTemp, Log, TEXT("Recording combat end log - Winners: %d, Losers: %d"), 
+                UE_LOG(LogIdleCombat, Log, TEXT("Recording combat end log - Winners: %d, Losers: %d"), 
                     Winners.Num(), Losers.Num());
-                UE_LOG(LogTemp, Error, TEXT("CombatComponent using PC->EventLogManager: %p"), (void*)PC->EventLogManager);
+                UE_LOG(LogIdleCombat, Error, TEXT("CombatComponent using PC->EventLogManager: %p"), (void*)PC->EventLogManager);
                 PC->EventLogManager->LogCombatEnd(Winners, Losers, Duration);
             }
             else
             {
-                UE_LOG(LogTemp, Error, TEXT("PC->EventLogManager is NULL"));
+                UE_LOG(LogIdleCombat, Error, TEXT("PC->EventLogManager is NULL"));
             }
         }
         else
         {
-            UE_LOG(LogTemp, Error, TEXT("PlayerController not found"));
+            UE_LOG(LogIdleCombat, Error, TEXT("PlayerController not found"));
         }
     }
     
@@ -288,7 +289,7 @@ void UCombatComponent::ExecuteCombatEndSequence(const TArray<AC_IdleCharacter*>&
         FTimerHandle ActionStopTimerHandle;
         GetWorld()->GetTimerManager().SetTimer(ActionStopTimerHandle, [this]()
         {
-            UE_LOG(LogTemp, Log, TEXT("Stopping ActionSystem after log recording"));
+            UE_LOG(LogIdleCombat, Log, TEXT("Stopping ActionSystem after log recording"));
             StopActionSystemSafely();
         }, 0.1f, false);
     }
@@ -305,7 +306,7 @@ void UCombatComponent::ExecuteCombatEndSequence(const TArray<AC_IdleCharacter*>&
             // 最終クリーンアップ（キャラクター削除を含む）
             CleanupAfterCombat();
             
-            UE_LOG(LogTemp, Log, TEXT("=== Combat End Sequence Completed ==="));
+            UE_LOG(LogIdleCombat, Log, TEXT("=== Combat End Sequence Completed ==="));
         }, 0.2f, false);
     }
 }
@@ -314,7 +315,7 @@ void UCombatComponent::StopActionSystemSafely()
 {
     if (ActionSystemComponent && ActionSystemComponent->IsSystemActive())
     {
-        UE_LOG(LogTemp, Log, TEXT("Stopping ActionSystem from CombatComponent"));
+        UE_LOG(LogIdleCombat, Log, TEXT("Stopping ActionSystem from CombatComponent"));
         ActionSystemComponent->StopActionSystem();
     }
 }
@@ -349,7 +350,7 @@ void UCombatComponent::StartCombatAfterPreparation()
 
     if (!IsCombatReadyToStart())
     {
-        UE_LOG(LogTemp, Error, TEXT("Combat not ready to start"));
+        UE_LOG(LogIdleCombat, Error, TEXT("Combat not ready to start"));
         SetCombatState(ECombatState::Inactive);
         return;
     }
@@ -371,11 +372,11 @@ void UCombatComponent::InitializeSubComponents()
     if (AC_PlayerController* PC = Cast<AC_PlayerController>(GetOwner()))
     {
         EventLogManager = PC->EventLogManager;
-        UE_LOG(LogTemp, Log, TEXT("CombatComponent: Using PlayerController EventLogManager: %p"), (void*)EventLogManager);
+        UE_LOG(LogIdleCombat, Log, TEXT("CombatComponent: Using PlayerController EventLogManager: %p"), (void*)EventLogManager);
     }
     else
     {
-        UE_LOG(LogTemp, Error, TEXT("CombatComponent: Owner is not AC_PlayerController, creating new EventLogManager"));
+        UE_LOG(LogIdleCombat, Error, TEXT("CombatComponent: Owner is not AC_PlayerController, creating new EventLogManager"));
         EventLogManager = NewObject<UEventLogManager>(GetOwner());
         if (EventLogManager)
         {
@@ -431,7 +432,7 @@ TArray<AC_IdleCharacter*> UCombatComponent::GetAliveMembers(const TArray<AC_Idle
     // 配列の安全性チェック
     if (Team.Num() == 0)
     {
-        UE_LOG(LogTemp, VeryVerbose, TEXT("GetAliveMembers: Empty team"));
+        UE_LOG(LogIdleCombat, VeryVerbose, TEXT("GetAliveMembers: Empty team"));
         return AliveMembers;
     }
     
@@ -439,7 +440,7 @@ TArray<AC_IdleCharacter*> UCombatComponent::GetAliveMembers(const TArray<AC_Idle
     {
         if (!Team.IsValidIndex(i))
         {
-            UE_LOG(LogTemp, Error, TEXT("GetAliveMembers: Invalid index %d"), i);
+            UE_LOG(LogIdleCombat, Error, TEXT("GetAliveMembers: Invalid index %d"), i);
             continue;
         }
         
@@ -453,25 +454,25 @@ TArray<AC_IdleCharacter*> UCombatComponent::GetAliveMembers(const TArray<AC_Idle
                 if (CurrentHP > 0.0f)
                 {
                     AliveMembers.Add(Member);
-                    UE_LOG(LogTemp, VeryVerbose, TEXT("Character %s is alive with %f HP"), 
+                    UE_LOG(LogIdleCombat, VeryVerbose, TEXT("Character %s is alive with %f HP"), 
                         *Member->GetName(), CurrentHP);
                 }
                 else
                 {
-                    UE_LOG(LogTemp, Log, TEXT("Character %s is dead (0 HP)"), *Member->GetName());
+                    UE_LOG(LogIdleCombat, Log, TEXT("Character %s is dead (0 HP)"), *Member->GetName());
                 }
             }
             else
             {
                 // StatusComponentがない場合は生存とみなす（フォールバック）
                 AliveMembers.Add(Member);
-                UE_LOG(LogTemp, Warning, TEXT("Character %s has no StatusComponent, assuming alive"), 
+                UE_LOG(LogIdleCombat, Warning, TEXT("Character %s has no StatusComponent, assuming alive"), 
                     *Member->GetName());
             }
         }
         else
         {
-            UE_LOG(LogTemp, Warning, TEXT("GetAliveMembers: Invalid character at index %d"), i);
+            UE_LOG(LogIdleCombat, Warning, TEXT("GetAliveMembers: Invalid character at index %d"), i);
         }
     }
     
@@ -501,7 +502,7 @@ void UCombatComponent::ProcessCombat(float DeltaTime)
                 bool bCharacterActed = ActionSystemComponent->ProcessSingleTurnWithGauge();
                 if (bCharacterActed)
                 {
-                    UE_LOG(LogTemp, VeryVerbose, TEXT("ProcessCombat: Character action processed with gauge system"));
+                    UE_LOG(LogIdleCombat, VeryVerbose, TEXT("ProcessCombat: Character action processed with gauge system"));
                 }
             }
             
@@ -529,19 +530,19 @@ bool UCombatComponent::StartCombatSimple(const TArray<AC_IdleCharacter*>& AllyTe
 {
     if (CurrentState != ECombatState::Inactive)
     {
-        UE_LOG(LogTemp, Warning, TEXT("Combat already active, cannot start new combat"));
+        UE_LOG(LogIdleCombat, Warning, TEXT("Combat already active, cannot start new combat"));
         return false;
     }
 
     if (AllyTeam.Num() == 0)
     {
-        UE_LOG(LogTemp, Error, TEXT("Cannot start combat with empty ally team"));
+        UE_LOG(LogIdleCombat, Error, TEXT("Cannot start combat with empty ally team"));
         return false;
     }
 
     if (EnemyTeam.Num() == 0)
     {
-        UE_LOG(LogTemp, Error, TEXT("Cannot start combat with empty enemy team"));
+        UE_LOG(LogIdleCombat, Error, TEXT("Cannot start combat with empty enemy team"));
         return false;
     }
 
@@ -554,7 +555,7 @@ bool UCombatComponent::StartCombatSimple(const TArray<AC_IdleCharacter*>& AllyTe
     SetCombatState(ECombatState::Preparing, TEXT("Combat starting"));
     CombatStartTime = GetWorld()->GetTimeSeconds();
     
-    UE_LOG(LogTemp, Warning, TEXT("⚔️ COMBAT INITIALIZED: %d allies vs %d enemies"), 
+    UE_LOG(LogIdleCombat, Warning, TEXT("⚔️ COMBAT INITIALIZED: %d allies vs %d enemies"), 
         AllyTeam.Num(), EnemyTeam.Num());
     
     // 準備時間後に戦闘開始
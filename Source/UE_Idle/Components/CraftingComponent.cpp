@@ -1,4 +1,8 @@
 #include "CraftingComponent.h"
+#include "../UE_Idle.h"
+#include "../Managers/FacilityManager.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
 
 UCraftingComponent::UCraftingComponent()
 {
@@ -82,28 +86,86 @@ TArray<FString> UCraftingComponent::GetDisplayNamesForCategory(ETaskType TaskTyp
     return DisplayNames;
 }
 
+void UCraftingComponent::RegisterRecipe(ETaskType TaskType, const FCraftableRecipe& Recipe)
+{
+    if (Recipe.RecipeId.IsEmpty())
+    {
+        return;
+    }
+
+    CraftableRecipes.FindOrAdd(TaskType).Add(Recipe);
+
+    // 材料のないもの（採集対象など）は原材料としてグラフに載せない
+    if (Recipe.Ingredients.Num() > 0)
+    {
+        RecipeGraph.AddRecipe(Recipe.RecipeId, Recipe.RecipeId, Recipe.OutputQuantity, Recipe.Ingredients, Recipe.bRequiresUnlock);
+    }
+}
+
+TMap<FString, int32> UCraftingComponent::GetRawMaterialRequirements(const FString& ItemId, int32 Quantity)
+{
+    SyncUnlockedRecipes();
+
+    TMap<FString, int32> Requirements;
+    for (const FRecipeMaterial& Material : RecipeGraph.Expand(FSimItemId::Intern(ItemId), Quantity))
+    {
+        Requirements.Add(Material.Key.ToString(), Material.Value);
+    }
+
+    return Requirements;
+}
+
+void UCraftingComponent::SyncUnlockedRecipes()
+{
+    UWorld* World = GetWorld();
+    UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+    UFacilityManager* FacilityManager = GameInstance ? GameInstance->GetSubsystem<UFacilityManager>() : nullptr;
+    if (!FacilityManager)
+    {
+        return;
+    }
+
+    // 施設構成が変わったときだけ全施設を走査する
+    const uint32 FacilityStateVersion = FacilityManager->GetFacilityStateVersion();
+    if (FacilityStateVersion == SyncedFacilityStateVersion)
+    {
+        return;
+    }
+
+    SyncedFacilityStateVersion = FacilityStateVersion;
+    if (RecipeGraph.SetUnlockedRecipes(FacilityManager->GetUnlockedRecipes()))
+    {
+        UE_LOG(LogIdleTask, Verbose, TEXT("UCraftingComponent: Unlocked recipes changed, recipe expansions invalidated"));
+    }
+}
+
 void UCraftingComponent::InitializeDefaultRecipes()
 {
+    // カテゴリ共通の材料（建築は木材と石材、料理は食材、製作は素材）
+    const TMap<FString, int32> ConstructionIngredients = { { TEXT("wood"), 10 }, { TEXT("stone"), 5 } };
+    const TMap<FString, int32> CookingIngredients = { { TEXT("ingredient"), 1 } };
+    const TMap<FString, int32> CraftingIngredients = { { TEXT("material"), 1 } };
+
     // 料理カテゴリ
-    AddRecipeToCategory(ETaskType::Cooking, TEXT("cooking_soup"), TEXT("スープ"));
-    AddRecipeToCategory(ETaskType::Cooking, TEXT("cooking_bread"), TEXT("パン"));
-    AddRecipeToCategory(ETaskType::Cooking, TEXT("cooking_stew"), TEXT("シチュー"));
-    AddRecipeToCategory(ETaskType::Cooking, TEXT("cooking_roasted_meat"), TEXT("焼き肉"));
-    AddRecipeToCategory(ETaskType::Cooking, TEXT("cooking_fish_dish"), TEXT("魚料理"));
+    AddRecipeToCategory(ETaskType::Cooking, TEXT("cooking_soup"), TEXT("スープ"), CookingIngredients);
+    AddRecipeToCategory(ETaskType::Cooking, TEXT("cooking_bread"), TEXT("パン"), CookingIngredients);
+    AddRecipeToCategory(ETaskType::Cooking, TEXT("cooking_stew"), TEXT("シチュー"), CookingIngredients);
+    AddRecipeToCategory(ETaskType::Cooking, TEXT("cooking_roasted_meat"), TEXT("焼き肉"), CookingIngredients);
+    AddRecipeToCategory(ETaskType::Cooking, TEXT("cooking_fish_dish"), TEXT("魚料理"), CookingIngredients);
 
     // 建築カテゴリ
-    AddRecipeToCategory(ETaskType::Construction, TEXT("construction_wooden_wall"), TEXT("木の壁"));
-    AddRecipeToCategory(ETaskType::Construction, TEXT("construction_stone_foundation"), TEXT("石の基礎"));
-    AddRecipeToCategory(ETaskType::Construction, TEXT("construction_wooden_door"), TEXT("木のドア"));
-    AddRecipeToCategory(ETaskType::Construction, TEXT("construction_roof_tile"), TEXT("屋根瓦"));
-    AddRecipeToCategory(ETaskType::Construction, TEXT("construction_wooden_floor"), TEXT("木の床"));
+    AddRecipeToCategory(ETaskType::Construction, TEXT("construction_wooden_wall"), TEXT("木の壁"), ConstructionIngredients);
+    AddRecipeToCategory(ETaskType::Construction, TEXT("construction_stone_foundation"), TEXT("石の基礎"), ConstructionIngredients);
+    AddRecipeToCategory(ETaskType::Construction, TEXT("construction_wooden_door"), TEXT("木のドア"), ConstructionIngredients);
+    AddRecipeToCategory(ETaskType::Construction, TEXT("construction_roof_tile"), TEXT("屋根瓦"), ConstructionIngredients);
+    AddRecipeToCategory(ETaskType::Construction, TEXT("construction_wooden_floor"), TEXT("木の床"), ConstructionIngredients);
 
     // 製作カテゴリ
-    AddRecipeToCategory(ETaskType::Crafting, TEXT("crafting_iron_sword"), TEXT("鉄の剣"));
-    AddRecipeToCategory(ETaskType::Crafting, TEXT("crafting_leather_armor"), TEXT("革の鎧"));
-    AddRecipeToCategory(ETaskType::Crafting, TEXT("crafting_wooden_bow"), TEXT("木の弓"));
-    AddRecipeToCategory(ETaskType::Crafting, TEXT("crafting_iron_helmet"), TEXT("鉄の兜"));
-    AddRecipeToCategory(ETaskType::Crafting, TEXT("crafting_wooden_shield"), TEXT("木の盾"));
+    AddRecipeToCategory(ETaskType::Crafting, TEXT("crafting_iron_sword"), TEXT("鉄の剣"), CraftingIngredients);
+    AddRecipeToCategory(ETaskType::Crafting, TEXT("crafting_leather_armor"), TEXT("革の鎧"), CraftingIngredients);
+    AddRecipeToCategory(ETaskType::Crafting, TEXT("crafting_wooden_bow"), TEXT("木の弓"), CraftingIngredients);
+    AddRecipeToCategory(ETaskType::Crafting, TEXT("crafting_iron_helmet"), TEXT("鉄の兜"), CraftingIngredients);
+    AddRecipeToCategory(ETaskType::Crafting, TEXT("crafting_wooden_shield"), TEXT("木の盾"), CraftingIngredients);
 
     // 採集カテゴリ（採集対象アイテム）
     AddRecipeToCategory(ETaskType::Gathering, TEXT("wood"), TEXT("木材"));
@@ -119,12 +181,10 @@ void UCraftingComponent::InitializeDefaultRecipes()
     UE_LOG(LogTemp, Log, TEXT("  - Gathering: %d items"), CraftableRecipes[ETaskType::Gathering].Num());
 }
 
-void UCraftingComponent::AddRecipeToCategory(ETaskType TaskType, const FString& RecipeId, const FString& DisplayName)
+void UCraftingComponent::AddRecipeToCategory(ETaskType TaskType, const FString& RecipeId, const FString& DisplayName,
+                                             const TMap<FString, int32>& Ingredients)
 {
-    if (!CraftableRecipes.Contains(TaskType))
-    {
-        CraftableRecipes.Add(TaskType, TArray<FCraftableRecipe>());
-    }
-    
-    CraftableRecipes[TaskType].Add(FCraftableRecipe(RecipeId, DisplayName));
+    FCraftableRecipe Recipe(RecipeId, DisplayName);
+    Recipe.Ingredients = Ingredients;
+    RegisterRecipe(TaskType, Recipe);
 }
\ No newline at end of file
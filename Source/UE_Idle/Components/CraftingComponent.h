@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "../Types/TaskTypes.h"
+#include "../Types/RecipeGraphTypes.h"
 #include "CraftingComponent.generated.h"
 
 // レシピ情報構造体
@@ -19,6 +20,18 @@ struct UE_IDLE_API FCraftableRecipe
     UPROPERTY(BlueprintReadWrite, Category = "Recipe")
     FString DisplayName;
 
+    // 1回の製作に使う材料（アイテムID → 個数）。中間素材のレシピIDも指定できる
+    UPROPERTY(BlueprintReadWrite, Category = "Recipe")
+    TMap<FString, int32> Ingredients;
+
+    // 1回の製作でできる個数
+    UPROPERTY(BlueprintReadWrite, Category = "Recipe")
+    int32 OutputQuantity = 1;
+
+    // 施設のUnlockRecipe効果でアンロックされるまで使えない
+    UPROPERTY(BlueprintReadWrite, Category = "Recipe")
+    bool bRequiresUnlock = false;
+
     FCraftableRecipe()
     {
         RecipeId = TEXT("");
@@ -66,10 +79,31 @@ public:
     UFUNCTION(BlueprintPure, Category = "Crafting")
     TArray<FString> GetDisplayNamesForCategory(ETaskType TaskType) const;
 
+    // レシピを追加（材料があればレシピグラフにも登録）
+    UFUNCTION(BlueprintCallable, Category = "Crafting")
+    void RegisterRecipe(ETaskType TaskType, const FCraftableRecipe& Recipe);
+
+    // 完成品Quantity個に必要な原材料（中間素材のレシピも展開）
+    UFUNCTION(BlueprintCallable, Category = "Crafting")
+    TMap<FString, int32> GetRawMaterialRequirements(const FString& ItemId, int32 Quantity);
+
+    // レシピグラフ（施設のアンロック状態はSyncUnlockedRecipesを呼んだ時点のもの）
+    const FRecipeGraph& GetRecipeGraph() const { return RecipeGraph; }
+
+    // 施設構成が変わっていればアンロック済みレシピを取り直す（ゲームスレッドでターン開始時などに呼ぶ）
+    void SyncUnlockedRecipes();
+
 private:
     // 初期レシピデータの設定
     void InitializeDefaultRecipes();
 
     // カテゴリ別にレシピを追加
-    void AddRecipeToCategory(ETaskType TaskType, const FString& RecipeId, const FString& DisplayName);
+    void AddRecipeToCategory(ETaskType TaskType, const FString& RecipeId, const FString& DisplayName,
+                             const TMap<FString, int32>& Ingredients = TMap<FString, int32>());
+
+    // 材料つきレシピの依存関係
+    FRecipeGraph RecipeGraph;
+
+    // アンロック済みレシピを取得した時点の施設構成の変更番号
+    uint32 SyncedFacilityStateVersion = 0;
 };
\ No newline at end of file
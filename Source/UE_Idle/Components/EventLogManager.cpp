@@ -1,4 +1,5 @@
 #include "EventLogManager.h"
+#include "../UE_Idle.h"
 #include "../Actor/C_IdleCharacter.h"
 #include "../Interfaces/IdleCharacterInterface.h"
 #include "../Types/CombatTypes.h"  // 実装で必要
@@ -27,6 +28,10 @@ void UEventLogManager::BeginPlay()
 void UEventLogManager::AddCombatLog(ECombatLogType CombatLogType, AC_IdleCharacter* Actor, AC_IdleCharacter* Target, 
                                    const FString& WeaponOrItemName, int32 DamageValue, const FString& AdditionalInfo)
 {
+    SCOPE_CYCLE_COUNTER(STAT_IdleSim_EventLogAppend);
+    TRACE_CPUPROFILER_EVENT_SCOPE(IdleSim_EventLogAppend);
+    INC_DWORD_STAT(STAT_IdleSim_LogEntries);
+    
     // 既存のインターフェースを新しい構造に変換
     FEventLogEntry NewEntry = ConvertLegacyCombatLog(CombatLogType, Actor, Target, WeaponOrItemName, DamageValue, AdditionalInfo);
     
@@ -255,6 +260,10 @@ void UEventLogManager::LogCombatEnd(const TArray<AC_IdleCharacter*>& Winners, co
 
 void UEventLogManager::AddEventLog(const FEventLogEntry& EventEntry)
 {
+    SCOPE_CYCLE_COUNTER(STAT_IdleSim_EventLogAppend);
+    TRACE_CPUPROFILER_EVENT_SCOPE(IdleSim_EventLogAppend);
+    INC_DWORD_STAT(STAT_IdleSim_LogEntries);
+    
     FEventLogEntry NewEntry = EventEntry;
     NewEntry.Timestamp = GetCurrentEventTime();
     
@@ -1,6 +1,8 @@
 #include "GridMapComponent.h"
+#include "../UE_Idle.h"
 #include "Engine/World.h"
 #include "Kismet/GameplayStatics.h"
+#include "../Managers/SimulationRandomManager.h"
 
 UGridMapComponent::UGridMapComponent()
 {
@@ -87,6 +89,10 @@ bool UGridMapComponent::IsValidGridPosition(const FIntPoint& GridPos) const
 
 TArray<FIntPoint> UGridMapComponent::FindPath(const FIntPoint& Start, const FIntPoint& Goal)
 {
+	SCOPE_CYCLE_COUNTER(STAT_IdleSim_FindPath);
+	TRACE_CPUPROFILER_EVENT_SCOPE(IdleSim_FindPath);
+	INC_DWORD_STAT(STAT_IdleSim_PathsComputed);
+
 	TArray<FIntPoint> Path;
 	
 	if (!IsValidGridPosition(Start) || !IsValidGridPosition(Goal))
@@ -251,6 +257,10 @@ void UGridMapComponent::CreateTestGrid()
 		CreateSimpleTestGrid();
 		return;
 	}
+
+	// 地形の割り当てはシードから決まる乱数で行う
+	FIdleRandomStream RandomStream = USimulationRandomManager::MakeStreamForCurrentTurn(
+		this, EIdleRandomDomain::MapGeneration, USimulationRandomManager::GetEntityKey(GetOwner()));
 	
 	for (int32 Y = 0; Y < GridHeight; Y++)
 	{
@@ -273,7 +283,7 @@ void UGridMapComponent::CreateTestGrid()
 			// ランダムで森と平原
 			else
 			{
-				if (FMath::RandRange(0, 100) < 30)
+				if (RandomStream.RandRange(0, 100) < 30)
 				{
 					CellData.LocationType = ForestTag;
 					// 森には木材リソース
@@ -1,10 +1,11 @@
 #include "InventoryComponent.h"
+#include "../UE_Idle.h"
 #include "../Managers/ItemDataTableManager.h"
+#include "../Managers/ResourceLedgerManager.h"
 #include "Engine/World.h"
 #include "GameFramework/PlayerController.h"
 #include "TeamComponent.h"
 #include "../Actor/C_IdleCharacter.h"
-#include "../Components/CharacterStatusComponent.h"
 
 UInventoryComponent::UInventoryComponent()
 {
@@ -28,17 +29,48 @@ void UInventoryComponent::BeginPlay()
         ItemManager = GameInstance->GetSubsystem<UItemDataTableManager>();
         if (!ItemManager)
         {
-            UE_LOG(LogTemp, Error, TEXT("InventoryComponent: ItemDataTableManager not found!"));
+            UE_LOG(LogIdleInventory, Error, TEXT("InventoryComponent: ItemDataTableManager not found!"));
         }
     }
     
-    UE_LOG(LogTemp, Log, TEXT("InventoryComponent: Initialized for %s"), *OwnerId);
+    LedgerManager = UResourceLedgerManager::Get(this);
+
+    // PlayerController = 拠点の倉庫。積載量は無制限
+    // キャラクターは既定値（20kg）からステータスの反映を待つ。それ以外の所有者は従来通り積載できない
+    AActor* Owner = GetOwner();
+    if (Owner && Owner->IsA<APlayerController>())
+    {
+        bUnboundedCapacity = true;
+    }
+    else if (!Owner || !Owner->IsA<AC_IdleCharacter>())
+    {
+        MaxCarryingCapacity = 0.0f;
+        UE_LOG(LogIdleInventory, Warning, TEXT("InventoryComponent: Unknown owner type %s, carrying capacity is 0"),
+            Owner ? *Owner->GetClass()->GetName() : TEXT("(none)"));
+    }
+    
+    UE_LOG(LogIdleInventory, Log, TEXT("InventoryComponent: Initialized for %s%s"), *OwnerId,
+        bUnboundedCapacity ? TEXT(" (unbounded capacity)") : TEXT(""));
+}
+
+void UInventoryComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    // 破棄されるインベントリの所持品を台帳から外す
+    if (LedgerManager)
+    {
+        LedgerManager->UnassignInventory(this);
+    }
+    
+    Super::EndPlay(EndPlayReason);
 }
 
 // ========== Core Inventory Operations ==========
 
 bool UInventoryComponent::AddItem(const FString& ItemId, int32 Quantity)
 {
+    SCOPE_CYCLE_COUNTER(STAT_IdleSim_InventoryAdd);
+    TRACE_CPUPROFILER_EVENT_SCOPE(IdleSim_InventoryAdd);
+    
     if (!ItemManager || Quantity <= 0)
     {
         return false;
@@ -47,7 +79,7 @@ bool UInventoryComponent::AddItem(const FString& ItemId, int32 Quantity)
     // 重量チェック
     if (!CanAddItemByWeight(ItemId, Quantity))
     {
-        UE_LOG(LogTemp, Warning, TEXT("InventoryComponent: Cannot add item %s x%d - would exceed carrying capacity"), *ItemId, Quantity);
+        UE_LOG(LogIdleInventory, Warning, TEXT("InventoryComponent: Cannot add item %s x%d - would exceed carrying capacity"), *ItemId, Quantity);
         return false;
     }
 
@@ -55,14 +87,99 @@ bool UInventoryComponent::AddItem(const FString& ItemId, int32 Quantity)
     
     if (bSuccess)
     {
+        if (LedgerManager)
+        {
+            LedgerManager->ApplyDelta(this, ItemId, Quantity);
+        }
+        
         OnInventoryChanged.Broadcast(ItemId, GetItemCount(ItemId));
     }
     
     return bSuccess;
 }
 
+int32 UInventoryComponent::AddItems(const TMap<FString, int32>& ItemsToAdd, TMap<FString, int32>& OutAdded)
+{
+    SCOPE_CYCLE_COUNTER(STAT_IdleSim_InventoryAdd);
+    TRACE_CPUPROFILER_EVENT_SCOPE(IdleSim_InventoryAdd);
+    
+    OutAdded.Reset();
+    
+    if (!ItemManager)
+    {
+        return 0;
+    }
+    
+    // 積載量と現在重量はまとめて1回だけ計算
+    const float MaxCapacity = GetMaxCarryingCapacity();
+    const bool bUnlimitedCapacity = MaxCapacity == FLT_MAX;
+    float CurrentWeight = bUnlimitedCapacity ? 0.0f : GetTotalWeight();
+    
+    int32 TotalAdded = 0;
+    FString LastAddedItemId;
+    
+    for (const TPair<FString, int32>& Entry : ItemsToAdd)
+    {
+        int32 Quantity = Entry.Value;
+        if (Quantity <= 0)
+        {
+            continue;
+        }
+        
+        float ItemWeight = 0.0f;
+        if (!bUnlimitedCapacity)
+        {
+            FItemDataRow ItemData;
+            if (!ItemManager->GetItemData(Entry.Key, ItemData))
+            {
+                continue;
+            }
+            
+            // 入りきらない分は切り詰める
+            ItemWeight = ItemData.Weight;
+            if (ItemWeight > 0.0f)
+            {
+                Quantity = FMath::Min(Quantity, FMath::FloorToInt((MaxCapacity - CurrentWeight) / ItemWeight));
+            }
+            
+            if (Quantity <= 0)
+            {
+                UE_LOG(LogIdleInventory, Verbose, TEXT("InventoryComponent: Cannot add item %s x%d - would exceed carrying capacity"), *Entry.Key, Entry.Value);
+                continue;
+            }
+        }
+        
+        if (!Inventory.AddItem(Entry.Key, Quantity, ItemManager))
+        {
+            continue;
+        }
+        
+        CurrentWeight += ItemWeight * Quantity;
+        
+        if (LedgerManager)
+        {
+            LedgerManager->ApplyDelta(this, Entry.Key, Quantity);
+        }
+        
+        OutAdded.Add(Entry.Key, Quantity);
+        TotalAdded += Quantity;
+        LastAddedItemId = Entry.Key;
+    }
+    
+    // 変更通知は1回（受け手は一覧全体を更新する）
+    if (TotalAdded > 0)
+    {
+        OnInventoryChanged.Broadcast(LastAddedItemId, GetItemCount(LastAddedItemId));
+    }
+    
+    return TotalAdded;
+}
+
 bool UInventoryComponent::RemoveItem(const FString& ItemId, int32 Quantity)
 {
+    SCOPE_CYCLE_COUNTER(STAT_IdleSim_InventoryRemove);
+    TRACE_CPUPROFILER_EVENT_SCOPE(IdleSim_InventoryRemove);
+    
     if (Quantity <= 0 || !HasItem(ItemId, Quantity))
     {
         return false;
@@ -72,6 +189,11 @@ bool UInventoryComponent::RemoveItem(const FString& ItemId, int32 Quantity)
     
     if (bSuccess)
     {
+        if (LedgerManager)
+        {
+            LedgerManager->ApplyDelta(this, ItemId, -Quantity);
+        }
+        
         OnInventoryChanged.Broadcast(ItemId, GetItemCount(ItemId));
     }
     
@@ -90,29 +212,116 @@ int32 UInventoryComponent::GetItemCount(const FString& ItemId) const
 
 bool UInventoryComponent::TransferTo(UInventoryComponent* TargetInventory, const FString& ItemId, int32 Quantity)
 {
-    if (!TargetInventory || !HasItem(ItemId, Quantity))
+    if (Quantity <= 0)
     {
         return false;
     }
 
-    // Remove from source
-    if (!RemoveItem(ItemId, Quantity))
+    TMap<FString, int32> Manifest;
+    Manifest.Add(ItemId, Quantity);
+    return TransferMany(TargetInventory, Manifest);
+}
+
+bool UInventoryComponent::TransferMany(UInventoryComponent* TargetInventory, const TMap<FString, int32>& Manifest)
+{
+    SCOPE_CYCLE_COUNTER(STAT_IdleSim_InventoryTransfer);
+    TRACE_CPUPROFILER_EVENT_SCOPE(IdleSim_InventoryTransfer);
+    
+    if (!TargetInventory || TargetInventory == this || !ItemManager || !TargetInventory->ItemManager)
     {
         return false;
     }
 
-    // Add to target
-    if (!TargetInventory->AddItem(ItemId, Quantity))
+    // 1. 検証：所持数・移動先の積載量・移動先のスロット数と重量上限（適用フェーズが失敗しないよう全て先に確かめる）
+    float ManifestWeight = 0.0f;
+    int32 TotalQuantity = 0;
+    for (const TPair<FString, int32>& Entry : Manifest)
     {
-        // Rollback: add back to source
-        AddItem(ItemId, Quantity);
+        if (Entry.Value <= 0)
+        {
+            continue;
+        }
+
+        // 装備中の個体は移さない
+        FItemDataRow ItemData;
+        if (Inventory.GetUnequippedItemCount(Entry.Key) < Entry.Value || !ItemManager->GetItemData(Entry.Key, ItemData))
+        {
+            return false;
+        }
+
+        ManifestWeight += ItemData.Weight * Entry.Value;
+        TotalQuantity += Entry.Value;
+    }
+
+    if (TotalQuantity == 0)
+    {
+        return false;
+    }
+
+    const float TargetCapacity = TargetInventory->GetMaxCarryingCapacity();
+    if (TargetCapacity != FLT_MAX && TargetInventory->GetTotalWeight() + ManifestWeight > TargetCapacity)
+    {
+        UE_LOG(LogIdleInventory, Verbose, TEXT("InventoryComponent: Cannot transfer %d items to %s - would exceed carrying capacity"),
+            TotalQuantity, *TargetInventory->OwnerId);
+        return false;
+    }
+
+    if (!TargetInventory->Inventory.HasSpaceForAll(Manifest, TargetInventory->ItemManager))
+    {
+        UE_LOG(LogIdleInventory, Verbose, TEXT("InventoryComponent: Cannot transfer %d items to %s - no slot or weight space"),
+            TotalQuantity, *TargetInventory->OwnerId);
         return false;
     }
 
-    UE_LOG(LogTemp, Log, TEXT("Transferred %d %s from %s to %s"), 
-           Quantity, *ItemId, *OwnerId, *TargetInventory->OwnerId);
+    // 2. 適用（検証済みなので失敗しない。万一失敗した品目は台帳に反映しない）
+    bool bAllApplied = true;
+    FString LastItemId;
+    for (const TPair<FString, int32>& Entry : Manifest)
+    {
+        if (Entry.Value <= 0)
+        {
+            continue;
+        }
+
+        const bool bRemoved = Inventory.RemoveItem(Entry.Key, Entry.Value);
+        const bool bAdded = bRemoved && TargetInventory->Inventory.AddItem(Entry.Key, Entry.Value, TargetInventory->ItemManager);
+        if (!ensureMsgf(bAdded, TEXT("InventoryComponent: Transfer of %s x%d from %s to %s failed after validation"),
+            *Entry.Key, Entry.Value, *OwnerId, *TargetInventory->OwnerId))
+        {
+            bAllApplied = false;
+            if (bRemoved && LedgerManager)
+            {
+                LedgerManager->ApplyDelta(this, Entry.Key, -Entry.Value);
+            }
+            continue;
+        }
+
+        LastItemId = Entry.Key;
+
+        // 3. 台帳
+        if (LedgerManager)
+        {
+            LedgerManager->ApplyDelta(this, Entry.Key, -Entry.Value);
+        }
+        if (TargetInventory->LedgerManager)
+        {
+            TargetInventory->LedgerManager->ApplyDelta(TargetInventory, Entry.Key, Entry.Value);
+        }
+    }
+
+    // 変更通知（受け手は一覧全体を更新する）
+    OnInventoryChanged.Broadcast(LastItemId, GetItemCount(LastItemId));
+    TargetInventory->OnInventoryChanged.Broadcast(LastItemId, TargetInventory->GetItemCount(LastItemId));
+
+    UE_LOG(LogIdleInventory, Log, TEXT("Transferred %d items (%d kinds) from %s to %s"),
+           TotalQuantity, Manifest.Num(), *OwnerId, *TargetInventory->OwnerId);
     
-    return true;
+    return bAllApplied;
+}
+
+bool UInventoryComponent::TransferAll(UInventoryComponent* TargetInventory)
+{
+    return TransferMany(TargetInventory, GetTransferableItems());
 }
 
 TArray<FInventorySlot> UInventoryComponent::GetAllSlots() const
@@ -122,7 +331,11 @@ TArray<FInventorySlot> UInventoryComponent::GetAllSlots() const
     {
         if (Slot.Quantity > 0)
         {
-            Result.Add(Slot);
+            FInventorySlot& View = Result.Add_GetRef(Slot);
+            if (Slot.HasInstances())
+            {
+                View.ItemInstances = Inventory.MakeInstanceViews(Slot);
+            }
         }
     }
     return Result;
@@ -141,8 +354,64 @@ TMap<FString, int32> UInventoryComponent::GetAllItems() const
     return Result;
 }
 
+TMap<FString, int32> UInventoryComponent::GetTransferableItems() const
+{
+    TMap<FString, int32> Result;
+    for (const FInventorySlot& Slot : Inventory.Slots)
+    {
+        const int32 Quantity = Inventory.GetUnequippedItemCount(Slot.ItemId);
+        if (Quantity > 0)
+        {
+            Result.Add(Slot.ItemId, Quantity);
+        }
+    }
+    return Result;
+}
+
+TMap<EEquipmentSlot, FString> UInventoryComponent::GetEquippedItems() const
+{
+    TMap<EEquipmentSlot, FString> Result;
+    for (uint8 SlotValue = static_cast<uint8>(EEquipmentSlot::Weapon); SlotValue <= static_cast<uint8>(EEquipmentSlot::Accessory); ++SlotValue)
+    {
+        const EEquipmentSlot Slot = static_cast<EEquipmentSlot>(SlotValue);
+        const FEquipmentReference* SlotRef = const_cast<FEquipmentSlots&>(Equipment).GetSlot(Slot);
+        if (SlotRef && !SlotRef->IsEmpty())
+        {
+            Result.Add(Slot, SlotRef->ItemId);
+        }
+    }
+    return Result;
+}
+
+void UInventoryComponent::RestoreContents(const TMap<FString, int32>& Items, const TMap<EEquipmentSlot, FString>& EquippedItems, int32 NewMoney)
+{
+    // 装備を外してから所持品を入れ替える（削除・追加は台帳に差分で反映される）
+    for (const TPair<EEquipmentSlot, FString>& Equipped : GetEquippedItems())
+    {
+        UnequipFromSlot(Equipped.Key);
+    }
+
+    for (const TPair<FString, int32>& Item : GetAllItems())
+    {
+        RemoveItem(Item.Key, Item.Value);
+    }
+
+    TMap<FString, int32> Added;
+    AddItems(Items, Added);
+
+    for (const TPair<EEquipmentSlot, FString>& Equipped : EquippedItems)
+    {
+        EquipToSlot(Equipped.Value, Equipped.Key);
+    }
+
+    Money = NewMoney;
+}
+
 float UInventoryComponent::GetTotalWeight() const
 {
+    SCOPE_CYCLE_COUNTER(STAT_IdleSim_InventoryWeight);
+    TRACE_CPUPROFILER_EVENT_SCOPE(IdleSim_InventoryWeight);
+    
     if (!ItemManager)
     {
         return 0.0f;
@@ -198,32 +467,15 @@ bool UInventoryComponent::EquipWeapon(const FString& WeaponId)
     }
 
     // Find unequipped instance
-    FItemInstance* InstanceToEquip = nullptr;
-    for (FInventorySlot& Slot : Inventory.Slots)
-    {
-        if (Slot.ItemId == WeaponId)
-        {
-            for (FItemInstance& Instance : Slot.ItemInstances)
-            {
-                if (!Instance.bIsEquipped)
-                {
-                    InstanceToEquip = &Instance;
-                    break;
-                }
-            }
-            if (InstanceToEquip) break;
-        }
-    }
-
-    if (!InstanceToEquip)
+    const FItemInstanceHandle InstanceToEquip = Inventory.FindUnequippedInstance(WeaponId);
+    if (!InstanceToEquip.IsValid())
     {
         return false;
     }
 
     // Equip the item
-    InstanceToEquip->bIsEquipped = true;
-    InstanceToEquip->EquippedSlot = EEquipmentSlot::Weapon;
-    Equipment.Weapon = FEquipmentReference(WeaponId, InstanceToEquip->InstanceId);
+    Inventory.SetInstanceEquippedSlot(InstanceToEquip, EEquipmentSlot::Weapon);
+    Equipment.Weapon = FEquipmentReference(WeaponId, InstanceToEquip);
     
     OnItemEquipped.Broadcast(WeaponId, EEquipmentSlot::Weapon);
     return true;
@@ -243,32 +495,15 @@ bool UInventoryComponent::EquipShield(const FString& ShieldId)
     }
 
     // Find unequipped instance
-    FItemInstance* InstanceToEquip = nullptr;
-    for (FInventorySlot& Slot : Inventory.Slots)
-    {
-        if (Slot.ItemId == ShieldId)
-        {
-            for (FItemInstance& Instance : Slot.ItemInstances)
-            {
-                if (!Instance.bIsEquipped)
-                {
-                    InstanceToEquip = &Instance;
-                    break;
-                }
-            }
-            if (InstanceToEquip) break;
-        }
-    }
-
-    if (!InstanceToEquip)
+    const FItemInstanceHandle InstanceToEquip = Inventory.FindUnequippedInstance(ShieldId);
+    if (!InstanceToEquip.IsValid())
     {
         return false;
     }
 
     // Equip the item
-    InstanceToEquip->bIsEquipped = true;
-    InstanceToEquip->EquippedSlot = EEquipmentSlot::Shield;
-    Equipment.Shield = FEquipmentReference(ShieldId, InstanceToEquip->InstanceId);
+    Inventory.SetInstanceEquippedSlot(InstanceToEquip, EEquipmentSlot::Shield);
+    Equipment.Shield = FEquipmentReference(ShieldId, InstanceToEquip);
     
     OnItemEquipped.Broadcast(ShieldId, EEquipmentSlot::Shield);
     return true;
@@ -311,32 +546,15 @@ bool UInventoryComponent::EquipToSlot(const FString& ItemId, EEquipmentSlot Slot
     }
 
     // Find unequipped instance
-    FItemInstance* InstanceToEquip = nullptr;
-    for (FInventorySlot& InventorySlot : Inventory.Slots)
-    {
-        if (InventorySlot.ItemId == ItemId)
-        {
-            for (FItemInstance& Instance : InventorySlot.ItemInstances)
-            {
-                if (!Instance.bIsEquipped)
-                {
-                    InstanceToEquip = &Instance;
-                    break;
-                }
-            }
-            if (InstanceToEquip) break;
-        }
-    }
-
-    if (!InstanceToEquip)
+    const FItemInstanceHandle InstanceToEquip = Inventory.FindUnequippedInstance(ItemId);
+    if (!InstanceToEquip.IsValid())
     {
         return false;
     }
 
     // Equip the item
-    InstanceToEquip->bIsEquipped = true;
-    InstanceToEquip->EquippedSlot = Slot;
-    *TargetSlot = FEquipmentReference(ItemId, InstanceToEquip->InstanceId);
+    Inventory.SetInstanceEquippedSlot(InstanceToEquip, Slot);
+    *TargetSlot = FEquipmentReference(ItemId, InstanceToEquip);
 
     OnItemEquipped.Broadcast(ItemId, Slot);
     return true;
@@ -352,12 +570,7 @@ bool UInventoryComponent::UnequipWeapon()
     FString WeaponId = Equipment.Weapon.ItemId;
     
     // Find and unequip instance
-    FItemInstance* EquippedInstance = Inventory.FindInstance(Equipment.Weapon.InstanceId);
-    if (EquippedInstance)
-    {
-        EquippedInstance->bIsEquipped = false;
-        EquippedInstance->EquippedSlot = EEquipmentSlot::None;
-    }
+    Inventory.SetInstanceEquippedSlot(Equipment.Weapon.InstanceHandle, EEquipmentSlot::None);
 
     Equipment.Weapon.Clear();
     OnItemUnequipped.Broadcast(WeaponId, EEquipmentSlot::Weapon);
@@ -375,12 +588,7 @@ bool UInventoryComponent::UnequipShield()
     FString ShieldId = Equipment.Shield.ItemId;
     
     // Find and unequip instance
-    FItemInstance* EquippedInstance = Inventory.FindInstance(Equipment.Shield.InstanceId);
-    if (EquippedInstance)
-    {
-        EquippedInstance->bIsEquipped = false;
-        EquippedInstance->EquippedSlot = EEquipmentSlot::None;
-    }
+    Inventory.SetInstanceEquippedSlot(Equipment.Shield.InstanceHandle, EEquipmentSlot::None);
 
     Equipment.Shield.Clear();
     OnItemUnequipped.Broadcast(ShieldId, EEquipmentSlot::Shield);
@@ -404,12 +612,7 @@ bool UInventoryComponent::UnequipFromSlot(EEquipmentSlot Slot)
     FString ItemId = SlotRef->ItemId;
     
     // Find and unequip instance
-    FItemInstance* EquippedInstance = Inventory.FindInstance(SlotRef->InstanceId);
-    if (EquippedInstance)
-    {
-        EquippedInstance->bIsEquipped = false;
-        EquippedInstance->EquippedSlot = EEquipmentSlot::None;
-    }
+    Inventory.SetInstanceEquippedSlot(SlotRef->InstanceHandle, EEquipmentSlot::None);
 
     SlotRef->Clear();
     OnItemUnequipped.Broadcast(ItemId, Slot);
@@ -444,16 +647,12 @@ float UInventoryComponent::GetTotalEquipmentWeight() const
     
     auto AddWeightFromSlot = [&](const FEquipmentReference& SlotRef)
     {
-        if (!SlotRef.IsEmpty())
+        if (!SlotRef.IsEmpty() && Inventory.ContainsInstance(SlotRef.InstanceHandle))
         {
-            FItemInstance* Instance = const_cast<FInventory&>(Inventory).FindInstance(SlotRef.InstanceId);
-            if (Instance)
+            FItemDataRow ItemData;
+            if (ItemManager->GetItemData(SlotRef.ItemId, ItemData))
             {
-                FItemDataRow ItemData;
-                if (ItemManager->GetItemData(Instance->ItemId, ItemData))
-                {
-                    TotalWeight += ItemData.Weight;
-                }
+                TotalWeight += ItemData.Weight;
             }
         }
     };
@@ -482,16 +681,12 @@ int32 UInventoryComponent::GetTotalDefense() const
     
     auto AddDefenseFromSlot = [&](const FEquipmentReference& SlotRef)
     {
-        if (!SlotRef.IsEmpty())
+        if (!SlotRef.IsEmpty() && Inventory.ContainsInstance(SlotRef.InstanceHandle))
         {
-            FItemInstance* Instance = const_cast<FInventory&>(Inventory).FindInstance(SlotRef.InstanceId);
-            if (Instance)
+            FItemDataRow ItemData;
+            if (ItemManager->GetItemData(SlotRef.ItemId, ItemData))
             {
-                FItemDataRow ItemData;
-                if (ItemManager->GetItemData(Instance->ItemId, ItemData))
-                {
-                    TotalDefense += ItemData.Defense;
-                }
+                TotalDefense += ItemData.Defense;
             }
         }
     };
@@ -585,37 +780,14 @@ bool UInventoryComponent::SellItem(const FString& ItemId, int32 Quantity)
 
 // ========== Carrying Capacity Functions ==========
 
-float UInventoryComponent::GetMaxCarryingCapacity() const
+void UInventoryComponent::SetMaxCarryingCapacity(float NewCapacity)
 {
-    AActor* Owner = GetOwner();
-    if (!Owner)
+    NewCapacity = FMath::Max(0.0f, NewCapacity);
+    if (MaxCarryingCapacity != NewCapacity)
     {
-        return 0.0f;
+        MaxCarryingCapacity = NewCapacity;
+        UE_LOG(LogIdleInventory, Verbose, TEXT("InventoryComponent: %s carrying capacity set to %.1fkg"), *OwnerId, NewCapacity);
     }
-
-    // TeamInventory削除 - 新採集システムでは使用しない
-
-    // PlayerController = 無限積載量（拠点の倉庫）
-    if (Owner->IsA<APlayerController>())
-    {
-        UE_LOG(LogTemp, Log, TEXT("InventoryComponent::GetMaxCarryingCapacity - PlayerController (Base storage): Infinite"));
-        return FLT_MAX; // 実質無限
-    }
-
-    // Character = そのキャラクターのCarryingCapacity
-    if (AC_IdleCharacter* Character = Cast<AC_IdleCharacter>(Owner))
-    {
-        if (UCharacterStatusComponent* StatusComp = Character->FindComponentByClass<UCharacterStatusComponent>())
-        {
-            float CharacterCapacity = StatusComp->GetCarryingCapacity();
-            UE_LOG(LogTemp, VeryVerbose, TEXT("InventoryComponent::GetMaxCarryingCapacity - Character capacity: %.1fkg"), CharacterCapacity);
-            return CharacterCapacity;
-        }
-        return 20.0f; // デフォルト値
-    }
-
-    UE_LOG(LogTemp, Warning, TEXT("InventoryComponent::GetMaxCarryingCapacity - Unknown owner type: %s"), *Owner->GetClass()->GetName());
-    return 0.0f;
 }
 
 float UInventoryComponent::GetLoadRatio() const
@@ -664,4 +836,144 @@ bool UInventoryComponent::CanAddItemByWeight(const FString& ItemId, int32 Quanti
     float CurrentWeight = GetTotalWeight();
     
     return (CurrentWeight + ItemWeight) <= MaxCapacity;
-}
\ No newline at end of file
+}
+
+float UInventoryComponent::GetItemUnitWeight(const FString& ItemId) const
+{
+    FItemDataRow ItemData;
+    if (!ItemManager || !ItemManager->GetItemData(ItemId, ItemData))
+    {
+        return -1.0f;
+    }
+    return ItemData.Weight;
+}
+
+float UInventoryComponent::GetRemainingCarryingCapacity() const
+{
+    const float MaxCapacity = GetMaxCarryingCapacity();
+    if (MaxCapacity == FLT_MAX)
+    {
+        return FLT_MAX;
+    }
+    return FMath::Max(0.0f, MaxCapacity - GetTotalWeight());
+}
+
+FInventorySlotBenchmarkResult UInventoryComponent::RunSlotIndexBenchmark(int32 NumItemTypes, int32 Seed)
+{
+    FInventorySlotBenchmarkResult Result;
+    Result.ItemTypeCount = FMath::Max(NumItemTypes, 1);
+
+    // 合成データ：スタック可能なアイテムをItemTypeCount種類。検索順はシャッフルする
+    TArray<FString> ItemIds;
+    ItemIds.Reserve(Result.ItemTypeCount);
+    for (int32 Index = 0; Index < Result.ItemTypeCount; ++Index)
+    {
+        ItemIds.Add(FString::Printf(TEXT("bench_item_%d"), Index));
+    }
+
+    FRandomStream Stream(Seed);
+    TArray<int32> Order;
+    Order.Reserve(ItemIds.Num());
+    for (int32 Index = 0; Index < ItemIds.Num(); ++Index)
+    {
+        Order.Add(Index);
+    }
+    for (int32 Index = Order.Num() - 1; Index > 0; --Index)
+    {
+        Order.Swap(Index, Stream.RandRange(0, Index));
+    }
+
+    FInventory Indexed;
+    Indexed.MaxSlots = Result.ItemTypeCount;
+    for (const FString& ItemId : ItemIds)
+    {
+        FInventorySlot NewSlot(ItemId);
+        NewSlot.AddStackableItem(10);
+        Indexed.AddSlot(NewSlot);
+    }
+    TArray<FInventorySlot> Linear = Indexed.Slots;
+
+    // 種類数によらず総回数がおおむね揃うように周回数を決める
+    const int32 Rounds = FMath::Max(1, 100000 / Result.ItemTypeCount);
+    Result.OperationCount = Rounds * Order.Num();
+
+    int64 Checksum = 0;
+
+    const double LinearLookupStart = FPlatformTime::Seconds();
+    for (int32 Round = 0; Round < Rounds; ++Round)
+    {
+        for (int32 ItemIndex : Order)
+        {
+            const FString& ItemId = ItemIds[ItemIndex];
+            for (const FInventorySlot& Slot : Linear)
+            {
+                if (Slot.ItemId == ItemId)
+                {
+                    Checksum += Slot.Quantity;
+                    break;
+                }
+            }
+        }
+    }
+    Result.LinearLookupMs = static_cast<float>((FPlatformTime::Seconds() - LinearLookupStart) * 1000.0);
+
+    const double IndexedLookupStart = FPlatformTime::Seconds();
+    for (int32 Round = 0; Round < Rounds; ++Round)
+    {
+        for (int32 ItemIndex : Order)
+        {
+            Checksum -= Indexed.GetItemCount(ItemIds[ItemIndex]);
+        }
+    }
+    Result.IndexedLookupMs = static_cast<float>((FPlatformTime::Seconds() - IndexedLookupStart) * 1000.0);
+
+    // 削除と再追加：全数を取り出してスロットを消し、すぐ戻す（採集・荷降ろしで在庫が空になる経路）
+    const double LinearChurnStart = FPlatformTime::Seconds();
+    for (int32 Round = 0; Round < Rounds; ++Round)
+    {
+        for (int32 ItemIndex : Order)
+        {
+            const FString& ItemId = ItemIds[ItemIndex];
+            for (FInventorySlot& Slot : Linear)
+            {
+                if (Slot.ItemId == ItemId)
+                {
+                    Slot.RemoveStackableItem(Slot.Quantity);
+                    break;
+                }
+            }
+            Linear.RemoveAll([&ItemId](const FInventorySlot& InSlot)
+            {
+                return InSlot.ItemId == ItemId;
+            });
+
+            FInventorySlot NewSlot(ItemId);
+            NewSlot.AddStackableItem(10);
+            Linear.Add(NewSlot);
+        }
+    }
+    Result.LinearChurnMs = static_cast<float>((FPlatformTime::Seconds() - LinearChurnStart) * 1000.0);
+
+    const double IndexedChurnStart = FPlatformTime::Seconds();
+    for (int32 Round = 0; Round < Rounds; ++Round)
+    {
+        for (int32 ItemIndex : Order)
+        {
+            const FString& ItemId = ItemIds[ItemIndex];
+            Indexed.RemoveItem(ItemId, Indexed.GetItemCount(ItemId));
+
+            FInventorySlot NewSlot(ItemId);
+            NewSlot.AddStackableItem(10);
+            Indexed.AddSlot(NewSlot);
+        }
+    }
+    Result.IndexedChurnMs = static_cast<float>((FPlatformTime::Seconds() - IndexedChurnStart) * 1000.0);
+
+    ensureMsgf(Checksum == 0 && Linear.Num() == Indexed.Slots.Num(), TEXT("Inventory slot benchmark: layouts diverged"));
+
+    UE_LOG(LogIdleInventory, Log, TEXT("Inventory slot benchmark: %d item types x %d ops, lookup linear %.3f ms / indexed %.3f ms, churn linear %.3f ms / indexed %.3f ms"),
+        Result.ItemTypeCount, Result.OperationCount, Result.LinearLookupMs, Result.IndexedLookupMs,
+        Result.LinearChurnMs, Result.IndexedChurnMs);
+
+    return Result;
+}
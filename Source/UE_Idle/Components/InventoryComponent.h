@@ -8,6 +8,7 @@
 #include "InventoryComponent.generated.h"
 
 class UItemDataTableManager;
+class UResourceLedgerManager;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnInventoryItemChanged, const FString&, ItemId, int32, NewQuantity);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnInventoryItemEquipped, const FString&, ItemId, EEquipmentSlot, Slot);
@@ -25,6 +26,7 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
     // Core inventory data
     UPROPERTY(BlueprintReadOnly, Category = "Inventory")
@@ -34,6 +36,10 @@ protected:
     UPROPERTY()
     UItemDataTableManager* ItemManager;
 
+    // 資源台帳（増減を差分で通知）
+    UPROPERTY()
+    UResourceLedgerManager* LedgerManager;
+
     // Optional features (use as needed)
     UPROPERTY(BlueprintReadOnly, Category = "Equipment")
     FEquipmentSlots Equipment;
@@ -41,6 +47,14 @@ protected:
     UPROPERTY(BlueprintReadOnly, Category = "Money")
     int32 Money = 0;
 
+    // 最大積載量（キャラクターはUCharacterStatusComponentから変更時に反映される。キャラクター・PlayerController以外の所有者は0）
+    UPROPERTY(BlueprintReadOnly, Category = "Carrying Capacity")
+    float MaxCarryingCapacity = 20.0f;
+
+    // 拠点の倉庫（PlayerController所有）は積載量無制限
+    UPROPERTY(BlueprintReadOnly, Category = "Carrying Capacity")
+    bool bUnboundedCapacity = false;
+
     // Resources削除 - 新採集システムではResourceカテゴリのItemとして管理
 
 public:
@@ -56,6 +70,10 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Inventory")
     bool RemoveItem(const FString& ItemId, int32 Quantity = 1);
 
+    // 複数アイテムをまとめて追加（重量計算と変更通知は1回のみ）
+    // 積載量を超える分は入る数まで切り詰める。OutAddedに実際に追加した数を返す
+    int32 AddItems(const TMap<FString, int32>& ItemsToAdd, TMap<FString, int32>& OutAdded);
+
     UFUNCTION(BlueprintCallable, Category = "Inventory")
     bool HasItem(const FString& ItemId, int32 Quantity = 1) const;
 
@@ -65,20 +83,47 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Inventory")
     bool TransferTo(UInventoryComponent* TargetInventory, const FString& ItemId, int32 Quantity);
 
+    // 複数アイテムをまとめて移す。全量を移せる場合のみ実行し、失敗時はどちらのインベントリも変更しない
+    // 積載量・スロット数・重量上限を先にまとめて検証するので、コピーによる巻き戻しは行わない。変更通知はインベントリごとに1回
+    UFUNCTION(BlueprintCallable, Category = "Inventory")
+    bool TransferMany(UInventoryComponent* TargetInventory, const TMap<FString, int32>& Manifest);
+
+    // 装備中の個体を除く全所持品をまとめて移す（拠点での荷下ろし用）
+    UFUNCTION(BlueprintCallable, Category = "Inventory")
+    bool TransferAll(UInventoryComponent* TargetInventory);
+
     UFUNCTION(BlueprintCallable, Category = "Inventory")
     TArray<FInventorySlot> GetAllSlots() const;
 
     UFUNCTION(BlueprintCallable, Category = "Inventory")
     TMap<FString, int32> GetAllItems() const;
 
+    // 装備中の個体を除いた所持品（荷下ろしなど、まとめて移すときの移送リスト）
+    UFUNCTION(BlueprintCallable, Category = "Inventory")
+    TMap<FString, int32> GetTransferableItems() const;
+
+    // 装備中のアイテム（スロット → アイテムID）
+    TMap<EEquipmentSlot, FString> GetEquippedItems() const;
+
+    // 所持品・装備・所持金を置き換える（リプレイの開始状態復元用）
+    void RestoreContents(const TMap<FString, int32>& Items, const TMap<EEquipmentSlot, FString>& EquippedItems, int32 NewMoney);
+
     UFUNCTION(BlueprintCallable, Category = "Inventory")
     float GetTotalWeight() const;
 
     // ========== Carrying Capacity Functions ==========
 
-    // 最大積載量取得（所有者に応じて自動計算）
+    // 最大積載量取得（無制限の場合はFLT_MAX）
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Carrying Capacity")
+    float GetMaxCarryingCapacity() const { return bUnboundedCapacity ? FLT_MAX : MaxCarryingCapacity; }
+
+    // 最大積載量を設定（所有キャラクターのステータス変更時に呼ばれる）
+    UFUNCTION(BlueprintCallable, Category = "Carrying Capacity")
+    void SetMaxCarryingCapacity(float NewCapacity);
+
+    // 積載量無制限かどうか（拠点の倉庫）
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Carrying Capacity")
-    float GetMaxCarryingCapacity() const;
+    bool IsCapacityUnbounded() const { return bUnboundedCapacity; }
 
     // 現在の積載率取得（0.0-1.0）
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Carrying Capacity")
@@ -92,6 +137,12 @@ public:
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Carrying Capacity")
     bool CanAddItemByWeight(const FString& ItemId, int32 Quantity = 1) const;
 
+    // アイテム1個あたりの重量（DataTableにない場合は負の値）
+    float GetItemUnitWeight(const FString& ItemId) const;
+
+    // 残りの積載量（無制限の場合はFLT_MAX）
+    float GetRemainingCarryingCapacity() const;
+
     // ========== Equipment Functions (for Characters) ==========
     
     UFUNCTION(BlueprintCallable, Category = "Equipment")
@@ -168,6 +219,12 @@ public:
 
     // Resource Events削除 - 新採集システムではItem Eventsを使用
 
+    // ========== Benchmark ==========
+
+    /** 合成データでのスロット検索・削除の計測（従来の線形探索との比較） */
+    UFUNCTION(BlueprintCallable, Category = "Inventory")
+    static FInventorySlotBenchmarkResult RunSlotIndexBenchmark(int32 NumItemTypes = 100, int32 Seed = 12345);
+
     // ========== Backward Compatibility ==========
     
     // For old CharacterInventoryComponent users
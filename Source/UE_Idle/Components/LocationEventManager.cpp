@@ -1,6 +1,7 @@
 #include "LocationEventManager.h"
 #include "../Actor/C_IdleCharacter.h"
 #include "../Managers/CharacterPresetManager.h"
+#include "../Managers/SimulationRandomManager.h"
 #include "CombatComponent.h"
 #include "ActionSystemComponent.h"
 #include "Engine/World.h"
@@ -125,10 +126,14 @@ TArray<AC_IdleCharacter*> ULocationEventManager::CreateEnemyTeamForLocation(
         return EnemyTeam;
     }
 
+    // 敵の選択はターン・場所・生成番号をキーにした乱数で決める
+    FIdleRandomStream RandomStream = USimulationRandomManager::MakeStreamForCurrentTurn(
+        this, EIdleRandomDomain::EnemySpawn, USimulationRandomManager::GetStringKey(LocationId), EnemyTeamSpawnCount++);
+
     for (int32 i = 0; i < EnemyCount; i++)
     {
         // 場所からランダムな敵を選択
-        FString EnemyPresetId = SelectRandomEnemyForLocation(LocationId);
+        FString EnemyPresetId = SelectRandomEnemyForLocation(LocationId, RandomStream);
         
         if (EnemyPresetId.IsEmpty())
         {
@@ -137,8 +142,8 @@ TArray<AC_IdleCharacter*> ULocationEventManager::CreateEnemyTeamForLocation(
         }
 
         // スポーン位置計算
-        FVector EnemySpawnLocation = CalculateEnemySpawnPosition(SpawnLocation, EnemySpawnRadius, i);
-        FRotator EnemySpawnRotation = FRotator(0.0f, FMath::RandRange(0.0f, 360.0f), 0.0f);
+        FVector EnemySpawnLocation = CalculateEnemySpawnPosition(SpawnLocation, EnemySpawnRadius, i, RandomStream);
+        FRotator EnemySpawnRotation = FRotator(0.0f, RandomStream.FRandRange(0.0f, 360.0f), 0.0f);
 
         // 敵をスポーン
         AC_IdleCharacter* Enemy = PresetManager->SpawnCharacterFromPreset(
@@ -311,11 +316,11 @@ void ULocationEventManager::ClearAllEnemyTeams()
     UE_LOG(LogTemp, Log, TEXT("Cleared all enemy teams"));
 }
 
-FVector ULocationEventManager::CalculateEnemySpawnPosition(const FVector& CenterLocation, float Radius, int32 Index) const
+FVector ULocationEventManager::CalculateEnemySpawnPosition(const FVector& CenterLocation, float Radius, int32 Index, FIdleRandomStream& RandomStream) const
 {
     // 敵を円形に配置
     float Angle = (360.0f / MaxEnemiesPerTeam) * Index * (PI / 180.0f);
-    float Distance = FMath::RandRange(Radius * 0.5f, Radius);
+    float Distance = RandomStream.FRandRange(Radius * 0.5f, Radius);
     
     FVector Offset(
         Distance * FMath::Cos(Angle),
@@ -326,11 +331,11 @@ FVector ULocationEventManager::CalculateEnemySpawnPosition(const FVector& Center
     return CenterLocation + Offset;
 }
 
-FString ULocationEventManager::SelectRandomEnemyForLocation(const FString& LocationId) const
+FString ULocationEventManager::SelectRandomEnemyForLocation(const FString& LocationId, FIdleRandomStream& RandomStream) const
 {
     if (PresetManager)
     {
-        return PresetManager->GetRandomEnemyFromLocation(LocationId);
+        return PresetManager->GetRandomEnemyFromLocation(LocationId, RandomStream);
     }
     
     return TEXT("");
@@ -4,6 +4,7 @@
 #include "Components/ActorComponent.h"
 #include "../Types/LocationTypes.h"
 #include "../Types/TeamTypes.h"
+#include "../Types/SimulationRandomTypes.h"
 #include "LocationEventManager.generated.h"
 
 class AC_IdleCharacter;
@@ -110,8 +111,11 @@ protected:
 
 private:
     // 敵スポーン位置の計算
-    FVector CalculateEnemySpawnPosition(const FVector& CenterLocation, float Radius, int32 Index) const;
+    FVector CalculateEnemySpawnPosition(const FVector& CenterLocation, float Radius, int32 Index, FIdleRandomStream& RandomStream) const;
     
     // 場所からランダムな敵選択
-    FString SelectRandomEnemyForLocation(const FString& LocationId) const;
+    FString SelectRandomEnemyForLocation(const FString& LocationId, FIdleRandomStream& RandomStream) const;
+
+    // 敵チーム生成の通し番号（同じターン・同じ場所での生成を区別する乱数キー）
+    int32 EnemyTeamSpawnCount = 0;
 };
\ No newline at end of file
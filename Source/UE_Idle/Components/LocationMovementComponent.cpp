@@ -1,11 +1,32 @@
 #include "LocationMovementComponent.h"
+#include "../UE_Idle.h"
 #include "TeamComponent.h"
 #include "../Managers/LocationDataTableManager.h"
 #include "../Types/LocationTypes.h"
 #include "../Actor/C_IdleCharacter.h"
 #include "../Components/CharacterStatusComponent.h"
+#include "TimeManagerComponent.h"
 #include "Engine/World.h"
 
+namespace
+{
+    /** チーム番号をキーにした表から削除されたチームを除き、後ろの番号を1つずつ詰める */
+    template <typename ValueType>
+    void RemoveTeamKey(TMap<int32, ValueType>& Map, int32 TeamIndex)
+    {
+        TMap<int32, ValueType> Shifted;
+        Shifted.Reserve(Map.Num());
+        for (TPair<int32, ValueType>& Entry : Map)
+        {
+            if (Entry.Key != TeamIndex)
+            {
+                Shifted.Add(Entry.Key > TeamIndex ? Entry.Key - 1 : Entry.Key, MoveTemp(Entry.Value));
+            }
+        }
+        Map = MoveTemp(Shifted);
+    }
+}
+
 ULocationMovementComponent::ULocationMovementComponent()
 {
     PrimaryComponentTick.bCanEverTick = false;
@@ -22,11 +43,11 @@ void ULocationMovementComponent::BeginPlay()
         LocationManager = GameInstance->GetSubsystem<ULocationDataTableManager>();
         if (!LocationManager)
         {
-            UE_LOG(LogTemp, Error, TEXT("MovementComponent: LocationDataTableManager not found!"));
+            UE_LOG(LogIdleAI, Error, TEXT("MovementComponent: LocationDataTableManager not found!"));
         }
     }
     
-    UE_LOG(LogTemp, Log, TEXT("MovementComponent: Initialized"));
+    UE_LOG(LogIdleAI, Log, TEXT("MovementComponent: Initialized"));
 }
 
 void ULocationMovementComponent::BeginDestroy()
@@ -35,7 +56,7 @@ void ULocationMovementComponent::BeginDestroy()
     TeamMovementInfos.Empty();
     TeamCurrentDistanceFromBase.Empty();
     
-    UE_LOG(LogTemp, Log, TEXT("MovementComponent: Destroyed"));
+    UE_LOG(LogIdleAI, Log, TEXT("MovementComponent: Destroyed"));
     
     Super::BeginDestroy();
 }
@@ -50,6 +71,16 @@ bool ULocationMovementComponent::StartMovement(int32 TeamIndex, const FString& F
         return false;
     }
     
+    // 同じ目的地へ移動中なら継続（毎ターンの移動指示で進捗がリセットされないように）
+    if (const FMovementInfo* ExistingInfo = TeamMovementInfos.Find(TeamIndex))
+    {
+        if ((ExistingInfo->State == EMovementState::MovingToDestination || ExistingInfo->State == EMovementState::MovingToBase) &&
+            ExistingInfo->ToLocation == ToLocation)
+        {
+            return true;
+        }
+    }
+    
     // 移動速度を計算
     float Speed = CalculateTeamMovementSpeed(TeamIndex);
     if (Speed <= 0.0f)
@@ -95,9 +126,12 @@ bool ULocationMovementComponent::StartMovement(int32 TeamIndex, const FString& F
         MovementInfo.State = EMovementState::MovingToDestination;
     }
     
-    UE_LOG(LogTemp, Warning, TEXT("MovementComponent: Started movement for team %d from %s (%.1fm) to %s (%.1fm) - Distance: %.1f, Speed: %.1f, Time: %.1fs"), 
+    UE_LOG(LogIdleAI, Verbose, TEXT("MovementComponent: Started movement for team %d from %s (%.1fm) to %s (%.1fm) - Distance: %.1f, Speed: %.1f, Time: %.1fs"), 
         TeamIndex, *FromLocation, FromDistance, *ToLocation, ToDistance, MovementInfo.Distance, Speed, MovementInfo.TotalTime);
     
+    // 到着をターン時計上に予約
+    ScheduleArrivalEvent(TeamIndex);
+    
     // イベント発行
     OnMovementStarted.Broadcast(TeamIndex);
     OnMovementProgressUpdated.Broadcast(TeamIndex, MovementInfo);
@@ -114,8 +148,9 @@ bool ULocationMovementComponent::StopMovement(int32 TeamIndex)
     
     // 移動情報をクリア
     TeamMovementInfos.Remove(TeamIndex);
+    CancelArrivalEvent(TeamIndex);
     
-    UE_LOG(LogTemp, Log, TEXT("MovementComponent: Stopped movement for team %d"), TeamIndex);
+    UE_LOG(LogIdleAI, Verbose, TEXT("MovementComponent: Stopped movement for team %d"), TeamIndex);
     return true;
 }
 
@@ -148,11 +183,11 @@ void ULocationMovementComponent::ProcessMovement(int32 TeamIndex)
 {
     if (!TeamMovementInfos.Contains(TeamIndex))
     {
-        UE_LOG(LogTemp, VeryVerbose, TEXT("ProcessMovement: No movement info for team %d"), TeamIndex);
+        UE_LOG(LogIdleAI, VeryVerbose, TEXT("ProcessMovement: No movement info for team %d"), TeamIndex);
         return;
     }
     
-    UE_LOG(LogTemp, VeryVerbose, TEXT("ProcessMovement: Processing movement for team %d"), TeamIndex);
+    UE_LOG(LogIdleAI, VeryVerbose, TEXT("ProcessMovement: Processing movement for team %d"), TeamIndex);
     
     // 1秒分の移動処理
     UpdateMovementInfo(TeamIndex, 1.0f);
@@ -240,7 +275,7 @@ void ULocationMovementComponent::SetCurrentDistanceFromBase(int32 TeamIndex, flo
     // 永続化された距離も更新
     TeamCurrentDistanceFromBase.Add(TeamIndex, Distance);
     
-    UE_LOG(LogTemp, VeryVerbose, TEXT("MovementComponent: Team %d distance set to %.1fm"), TeamIndex, Distance);
+    UE_LOG(LogIdleAI, VeryVerbose, TEXT("MovementComponent: Team %d distance set to %.1fm"), TeamIndex, Distance);
 }
 
 // === ヘルパー関数 ===
@@ -260,7 +295,7 @@ float ULocationMovementComponent::GetDistanceBetweenLocations(const FString& Fro
 {
     if (!LocationManager)
     {
-        UE_LOG(LogTemp, Error, TEXT("MovementComponent::GetDistanceBetweenLocations - LocationManager is null"));
+        UE_LOG(LogIdleAI, Error, TEXT("MovementComponent::GetDistanceBetweenLocations - LocationManager is null"));
         return -1.0f;
     }
     
@@ -282,13 +317,13 @@ float ULocationMovementComponent::GetDistanceBetweenLocations(const FString& Fro
         }
         else
         {
-            UE_LOG(LogTemp, Warning, TEXT("MovementComponent::GetDistanceBetweenLocations - Location %s not found"), *LocationId);
+            UE_LOG(LogIdleAI, Warning, TEXT("MovementComponent::GetDistanceBetweenLocations - Location %s not found"), *LocationId);
             return -1.0f;
         }
     }
     
     // 場所間の移動（将来的に実装）
-    UE_LOG(LogTemp, Warning, TEXT("MovementComponent::GetDistanceBetweenLocations - Location-to-location movement not yet implemented"));
+    UE_LOG(LogIdleAI, Warning, TEXT("MovementComponent::GetDistanceBetweenLocations - Location-to-location movement not yet implemented"));
     return -1.0f;
 }
 
@@ -296,7 +331,7 @@ float ULocationMovementComponent::GetLocationDistanceFromBase(const FString& Loc
 {
     if (!LocationManager)
     {
-        UE_LOG(LogTemp, Error, TEXT("MovementComponent::GetLocationDistanceFromBase - LocationManager is null"));
+        UE_LOG(LogIdleAI, Error, TEXT("MovementComponent::GetLocationDistanceFromBase - LocationManager is null"));
         return -1.0f;
     }
     
@@ -314,7 +349,7 @@ float ULocationMovementComponent::GetLocationDistanceFromBase(const FString& Loc
     }
     else
     {
-        UE_LOG(LogTemp, Warning, TEXT("MovementComponent::GetLocationDistanceFromBase - Location %s not found"), *LocationId);
+        UE_LOG(LogIdleAI, Warning, TEXT("MovementComponent::GetLocationDistanceFromBase - Location %s not found"), *LocationId);
         return -1.0f;
     }
 }
@@ -324,14 +359,50 @@ float ULocationMovementComponent::GetLocationDistanceFromBase(const FString& Loc
 void ULocationMovementComponent::RegisterTeamComponent(UTeamComponent* InTeamComponent)
 {
     TeamComponent = InTeamComponent;
-    UE_LOG(LogTemp, Log, TEXT("MovementComponent: Registered TeamComponent"));
+    UE_LOG(LogIdleAI, Log, TEXT("MovementComponent: Registered TeamComponent"));
 }
 
 void ULocationMovementComponent::InitializeTeamAtBase(int32 TeamIndex)
 {
     // チームを拠点（距離0）に初期化
     TeamCurrentDistanceFromBase.Add(TeamIndex, 0.0f);
-    UE_LOG(LogTemp, Log, TEXT("MovementComponent: Initialized team %d at base (distance 0)"), TeamIndex);
+    UE_LOG(LogIdleAI, Log, TEXT("MovementComponent: Initialized team %d at base (distance 0)"), TeamIndex);
+}
+
+bool ULocationMovementComponent::PlaceTeamAtLocation(int32 TeamIndex, const FString& LocationId)
+{
+    if (!IsValidTeam(TeamIndex))
+    {
+        LogMovementError(FString::Printf(TEXT("PlaceTeamAtLocation: Invalid team index %d"), TeamIndex));
+        return false;
+    }
+    
+    float Distance = GetLocationDistanceFromBase(LocationId);
+    if (Distance < 0.0f)
+    {
+        LogMovementError(FString::Printf(TEXT("PlaceTeamAtLocation: Invalid location %s"), *LocationId));
+        return false;
+    }
+    
+    TeamMovementInfos.Remove(TeamIndex);
+    CancelArrivalEvent(TeamIndex);
+    TeamCurrentDistanceFromBase.Add(TeamIndex, Distance);
+    
+    // 拠点以外は到着状態として保持（現在地の判定に使用される）
+    if (LocationId != TEXT("base"))
+    {
+        FMovementInfo& MovementInfo = TeamMovementInfos.Add(TeamIndex);
+        MovementInfo.FromLocation = LocationId;
+        MovementInfo.ToLocation = LocationId;
+        MovementInfo.State = EMovementState::Arrived;
+        MovementInfo.Progress = 1.0f;
+        MovementInfo.CurrentDistanceFromBase = Distance;
+        MovementInfo.TargetDistanceFromBase = Distance;
+        OnMovementProgressUpdated.Broadcast(TeamIndex, MovementInfo);
+    }
+    
+    UE_LOG(LogIdleAI, Log, TEXT("MovementComponent: Team %d placed at %s (%.1fm)"), TeamIndex, *LocationId, Distance);
+    return true;
 }
 
 // === 内部ヘルパー ===
@@ -344,7 +415,7 @@ void ULocationMovementComponent::UpdateMovementInfo(int32 TeamIndex, float Delta
         return;
     }
     
-    UE_LOG(LogTemp, VeryVerbose, TEXT("🔍 UpdateMovementInfo: Team %d - Current: %.1f, Target: %.1f, Remaining: %.1f"), 
+    UE_LOG(LogIdleAI, VeryVerbose, TEXT("🔍 UpdateMovementInfo: Team %d - Current: %.1f, Target: %.1f, Remaining: %.1f"), 
         TeamIndex, MovementInfo->CurrentDistanceFromBase, MovementInfo->TargetDistanceFromBase, MovementInfo->RemainingTime);
     
     // 即座移動の場合
@@ -404,7 +475,7 @@ void ULocationMovementComponent::UpdateMovementInfo(int32 TeamIndex, float Delta
         ((MovementInfo->Distance - RemainingDistance) / MovementInfo->Distance) : 1.0f;
     MovementInfo->RemainingTime = (MovementInfo->Speed > 0.0f) ? (RemainingDistance / MovementInfo->Speed) : 0.0f;
     
-    UE_LOG(LogTemp, VeryVerbose, TEXT("MovementComponent: Team %d at %.1fm/%.1fm, progress %.2f, remaining %.1fs (speed: %.1f, delta: %.1f)"), 
+    UE_LOG(LogIdleAI, VeryVerbose, TEXT("MovementComponent: Team %d at %.1fm/%.1fm, progress %.2f, remaining %.1fs (speed: %.1f, delta: %.1f)"), 
         TeamIndex, MovementInfo->CurrentDistanceFromBase, MovementInfo->TargetDistanceFromBase, MovementInfo->Progress, MovementInfo->RemainingTime, MovementInfo->Speed, DeltaTime);
     
     // UI更新イベント発行
@@ -419,6 +490,9 @@ void ULocationMovementComponent::CompleteMovement(int32 TeamIndex)
         return;
     }
     
+    // ProcessMovement経由で先に到着した場合は予約を破棄
+    CancelArrivalEvent(TeamIndex);
+    
     FString ArrivedLocation = MovementInfo->ToLocation;
     float FinalDistance = MovementInfo->CurrentDistanceFromBase;
     MovementInfo->State = EMovementState::Arrived;
@@ -428,7 +502,7 @@ void ULocationMovementComponent::CompleteMovement(int32 TeamIndex)
     // 現在距離を永続化
     TeamCurrentDistanceFromBase.Add(TeamIndex, FinalDistance);
     
-    UE_LOG(LogTemp, Warning, TEXT("MovementComponent: Team %d completed movement to %s at distance %.1fm"), TeamIndex, *ArrivedLocation, FinalDistance);
+    UE_LOG(LogIdleAI, Verbose, TEXT("MovementComponent: Team %d completed movement to %s at distance %.1fm"), TeamIndex, *ArrivedLocation, FinalDistance);
     
     // 移動完了イベント発行
     OnMovementCompleted.Broadcast(TeamIndex, ArrivedLocation);
@@ -436,7 +510,77 @@ void ULocationMovementComponent::CompleteMovement(int32 TeamIndex)
     // 移動情報をクリア（静止状態に戻す）
     TeamMovementInfos.Remove(TeamIndex);
     
-    UE_LOG(LogTemp, Warning, TEXT("MovementComponent: Team %d arrived at %s - movement info cleared"), TeamIndex, *ArrivedLocation);
+    UE_LOG(LogIdleAI, Verbose, TEXT("MovementComponent: Team %d arrived at %s - movement info cleared"), TeamIndex, *ArrivedLocation);
+}
+
+void ULocationMovementComponent::ScheduleArrivalEvent(int32 TeamIndex)
+{
+    CancelArrivalEvent(TeamIndex);
+    
+    UTimeManagerComponent* TimeManager = UTimeManagerComponent::Get(this);
+    const FMovementInfo* MovementInfo = TeamMovementInfos.Find(TeamIndex);
+    if (!TimeManager || !MovementInfo)
+    {
+        return;
+    }
+    
+    // ProcessMovementと同じく1ターンで1秒分進む
+    const int32 TurnsToArrive = FMath::Max(1, FMath::CeilToInt(MovementInfo->TotalTime));
+    // 発火時のチーム番号は予約時と異なりうるので、イベントIDから引き直す
+    TWeakObjectPtr<ULocationMovementComponent> WeakThis(this);
+    TSharedRef<int64> ScheduledEventId = MakeShared<int64>(0);
+    const int64 EventId = TimeManager->ScheduleTurnEvent(EIdleTimeEventType::MovementArrival, TurnsToArrive,
+        [WeakThis, ScheduledEventId]()
+        {
+            if (!WeakThis.IsValid())
+            {
+                return;
+            }
+            if (const int32* CurrentTeamIndex = WeakThis->TeamArrivalEvents.FindKey(*ScheduledEventId))
+            {
+                WeakThis->OnArrivalEvent(*CurrentTeamIndex);
+            }
+        });
+    *ScheduledEventId = EventId;
+    TeamArrivalEvents.Add(TeamIndex, EventId);
+}
+
+void ULocationMovementComponent::RemoveTeam(int32 TeamIndex)
+{
+    CancelArrivalEvent(TeamIndex);
+    
+    RemoveTeamKey(TeamMovementInfos, TeamIndex);
+    RemoveTeamKey(TeamCurrentDistanceFromBase, TeamIndex);
+    RemoveTeamKey(TeamArrivalEvents, TeamIndex);
+}
+
+void ULocationMovementComponent::CancelArrivalEvent(int32 TeamIndex)
+{
+    int64 EventId = 0;
+    if (TeamArrivalEvents.RemoveAndCopyValue(TeamIndex, EventId))
+    {
+        if (UTimeManagerComponent* TimeManager = UTimeManagerComponent::Get(this))
+        {
+            TimeManager->CancelTurnEvent(EventId);
+        }
+    }
+}
+
+void ULocationMovementComponent::OnArrivalEvent(int32 TeamIndex)
+{
+    TeamArrivalEvents.Remove(TeamIndex);
+    
+    FMovementInfo* MovementInfo = TeamMovementInfos.Find(TeamIndex);
+    if (!MovementInfo || 
+        (MovementInfo->State != EMovementState::MovingToDestination && MovementInfo->State != EMovementState::MovingToBase))
+    {
+        return;
+    }
+    
+    MovementInfo->CurrentDistanceFromBase = MovementInfo->TargetDistanceFromBase;
+    MovementInfo->Progress = 1.0f;
+    MovementInfo->RemainingTime = 0.0f;
+    CompleteMovement(TeamIndex);
 }
 
 bool ULocationMovementComponent::IsValidTeam(int32 TeamIndex) const
@@ -446,5 +590,5 @@ bool ULocationMovementComponent::IsValidTeam(int32 TeamIndex) const
 
 void ULocationMovementComponent::LogMovementError(const FString& ErrorMessage) const
 {
-    UE_LOG(LogTemp, Error, TEXT("MovementComponent: %s"), *ErrorMessage);
+    UE_LOG(LogIdleAI, Error, TEXT("MovementComponent: %s"), *ErrorMessage);
 }
\ No newline at end of file
@@ -111,6 +111,10 @@ protected:
     UPROPERTY()
     TMap<int32, float> TeamCurrentDistanceFromBase;
     
+    // チーム別の到着イベントID（TimeManagerのターン時計上に予約）
+    // イベントはIDからチーム番号を引き直すので、チーム削除で番号が詰められても正しいチームに届く
+    TMap<int32, int64> TeamArrivalEvents;
+    
     // === 参照コンポーネント ===
     
     UPROPERTY()
@@ -194,6 +198,13 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Setup")
     void InitializeTeamAtBase(int32 TeamIndex);
 
+    // チームを指定場所に直接配置（移動中の情報は破棄、オフライン進行の反映用）
+    UFUNCTION(BlueprintCallable, Category = "Setup")
+    bool PlaceTeamAtLocation(int32 TeamIndex, const FString& LocationId);
+
+    // 削除されたチームの移動情報・到着イベントを破棄し、後ろのチーム番号を1つずつ詰める（TeamComponent::DeleteTeamから）
+    void RemoveTeam(int32 TeamIndex);
+
     // === イベントディスパッチャー ===
     
     UPROPERTY(BlueprintAssignable, Category = "Movement Events")
@@ -214,6 +225,11 @@ private:
     // 移動完了処理
     void CompleteMovement(int32 TeamIndex);
     
+    // 到着イベントの予約・取り消し・実行
+    void ScheduleArrivalEvent(int32 TeamIndex);
+    void CancelArrivalEvent(int32 TeamIndex);
+    void OnArrivalEvent(int32 TeamIndex);
+    
     // 有効性チェック
     bool IsValidTeam(int32 TeamIndex) const;
     
@@ -1,24 +1,71 @@
 #include "TaskManagerComponent.h"
+#include "../UE_Idle.h"
 #include "../Components/InventoryComponent.h"
 #include "../Components/TeamComponent.h"
+#include "../Components/CraftingComponent.h"
+#include "../Managers/ResourceLedgerManager.h"
 #include "../Components/CharacterStatusComponent.h"
+#include "../Managers/CharacterRosterManager.h"
+#include "../Components/CharacterBrain.h"
 #include "../Actor/C_IdleCharacter.h"
 #include "../Managers/LocationDataTableManager.h"
+#include "../Managers/SimulationRandomManager.h"
+#include "../Managers/SimulationReplayManager.h"
+#include "../Managers/TaskAllocationSolver.h"
+#include "../Managers/OfflineProgressCalculator.h"
+#include "../Components/TimeManagerComponent.h"
+#include "../C_PlayerController.h"
+#include "../Components/LocationMovementComponent.h"
 #include "../Types/LocationTypes.h"
 #include "Engine/World.h"
 
+namespace
+{
+    // タスクタイプ別の既定の資源要件。対象アイテムのレシピがレシピグラフにない場合に使う
+    const TArray<FRecipeMaterial>& GetTaskTypeResourceRequirements(ETaskType TaskType)
+    {
+        static const TArray<FRecipeMaterial> NoRequirements;
+        
+        // 建築タスクは木材と石材が必要
+        static const TArray<FRecipeMaterial> ConstructionRequirements = {
+            FRecipeMaterial(FSimItemId::Intern(TEXT("wood")), 10), FRecipeMaterial(FSimItemId::Intern(TEXT("stone")), 5) };
+        
+        // 料理タスクは食材が必要
+        static const TArray<FRecipeMaterial> CookingRequirements = { FRecipeMaterial(FSimItemId::Intern(TEXT("ingredient")), 1) };
+        
+        // 製作は材料が必要
+        static const TArray<FRecipeMaterial> CraftingRequirements = { FRecipeMaterial(FSimItemId::Intern(TEXT("material")), 1) };
+        
+        switch (TaskType)
+        {
+            case ETaskType::Construction:
+                return ConstructionRequirements;
+            case ETaskType::Cooking:
+                return CookingRequirements;
+            case ETaskType::Crafting:
+                return CraftingRequirements;
+            default:
+                // 採集・冒険は常に実行可能（戦闘装備は後で実装）
+                return NoRequirements;
+        }
+    }
+}
+
 UTaskManagerComponent::UTaskManagerComponent()
 {
     PrimaryComponentTick.bCanEverTick = false;
     bProcessingTasks = false;
-    MaxGlobalTasks = 20;
+    MaxGlobalTasks = 0;
 }
 
 void UTaskManagerComponent::BeginPlay()
 {
     Super::BeginPlay();
     
-    UE_LOG(LogTemp, Log, TEXT("TaskManagerComponent: BeginPlay - Initialized"));
+    // エディタで設定された初期タスクがあればインデックス化
+    RebuildTaskIndex();
+    
+    UE_LOG(LogIdleTask, Log, TEXT("TaskManagerComponent: BeginPlay - Initialized"));
 }
 
 void UTaskManagerComponent::BeginDestroy()
@@ -30,13 +77,16 @@ void UTaskManagerComponent::BeginDestroy()
     GlobalInventoryRef = nullptr;
     TeamComponentRef = nullptr;
     
+    // 台帳のしきい値監視を解除
+    ClearKeepTaskWatches();
+    
     // タイマーをクリア
     if (UWorld* World = GetWorld())
     {
         World->GetTimerManager().ClearAllTimersForObject(this);
     }
     
-    UE_LOG(LogTemp, Log, TEXT("TaskManagerComponent: BeginDestroy - Cleaned up"));
+    UE_LOG(LogIdleTask, Log, TEXT("TaskManagerComponent: BeginDestroy - Cleaned up"));
     
     Super::BeginDestroy();
 }
@@ -57,7 +107,7 @@ int32 UTaskManagerComponent::AddGlobalTask(const FGlobalTask& NewTask)
         return -1;
     }
 
-    if (GlobalTasks.Num() >= MaxGlobalTasks)
+    if (MaxGlobalTasks > 0 && GlobalTasks.Num() >= MaxGlobalTasks)
     {
         LogError(FString::Printf(TEXT("AddGlobalTask: Maximum task limit (%d) reached"), MaxGlobalTasks));
         return -1;
@@ -66,7 +116,7 @@ int32 UTaskManagerComponent::AddGlobalTask(const FGlobalTask& NewTask)
     // 優先度の重複チェック
     if (HasDuplicatePriority(NewTask.Priority))
     {
-        UE_LOG(LogTemp, Warning, TEXT("AddGlobalTask: Priority %d already exists, adjusting priorities"), NewTask.Priority);
+        UE_LOG(LogIdleTask, Warning, TEXT("AddGlobalTask: Priority %d already exists, adjusting priorities"), NewTask.Priority);
         
         // 既存タスクの優先度を調整
         for (FGlobalTask& ExistingTask : GlobalTasks)
@@ -88,6 +138,13 @@ int32 UTaskManagerComponent::AddGlobalTask(const FGlobalTask& NewTask)
     }
     
     int32 NewIndex = GlobalTasks.Add(TaskToAdd);
+    RebuildTaskIndex();
+    
+    // リプレイ記録
+    FIdleReplayCommand Command;
+    Command.CommandType = EIdleReplayCommandType::AddGlobalTask;
+    Command.GlobalTask = NewTask;
+    USimulationReplayManager::Record(this, Command);
     
     LogTaskOperation(TEXT("Added"), TaskToAdd);
     OnGlobalTaskAdded.Broadcast(TaskToAdd);
@@ -95,6 +152,14 @@ int32 UTaskManagerComponent::AddGlobalTask(const FGlobalTask& NewTask)
     return NewIndex;
 }
 
+void UTaskManagerComponent::RestoreGlobalTasks(const TArray<FGlobalTask>& Tasks)
+{
+    GlobalTasks = Tasks;
+    RebuildTaskIndex();
+
+    UE_LOG(LogIdleTask, Log, TEXT("RestoreGlobalTasks: Restored %d tasks"), GlobalTasks.Num());
+}
+
 bool UTaskManagerComponent::RemoveGlobalTask(int32 TaskIndex)
 {
     if (bProcessingTasks)
@@ -111,6 +176,13 @@ bool UTaskManagerComponent::RemoveGlobalTask(int32 TaskIndex)
 
     FGlobalTask RemovedTask = GlobalTasks[TaskIndex];
     GlobalTasks.RemoveAt(TaskIndex);
+    RebuildTaskIndex();
+    
+    // リプレイ記録
+    FIdleReplayCommand Command;
+    Command.CommandType = EIdleReplayCommandType::RemoveGlobalTask;
+    Command.Index = TaskIndex;
+    USimulationReplayManager::Record(this, Command);
     
     LogTaskOperation(TEXT("Removed"), RemovedTask);
     OnGlobalTaskRemoved.Broadcast(TaskIndex);
@@ -135,16 +207,18 @@ bool UTaskManagerComponent::UpdateTaskPriority(int32 TaskIndex, int32 NewPriorit
         return false;
     }
 
-    if (NewPriority < 1 || NewPriority > MaxGlobalTasks)
+    const int32 MaxPriority = FMath::Max(MaxGlobalTasks, GlobalTasks.Num());
+    if (NewPriority < 1 || NewPriority > MaxPriority)
     {
-        LogError(FString::Printf(TEXT("UpdateTaskPriority: Invalid priority %d (valid range: 1-%d)"), NewPriority, MaxGlobalTasks));
+        LogError(FString::Printf(TEXT("UpdateTaskPriority: Invalid priority %d (valid range: 1-%d)"), NewPriority, MaxPriority));
         return false;
     }
 
     int32 OldPriority = GlobalTasks[TaskIndex].Priority;
     GlobalTasks[TaskIndex].Priority = NewPriority;
+    RebuildTaskIndex();
     
-    UE_LOG(LogTemp, Log, TEXT("UpdateTaskPriority: Task %s priority changed from %d to %d"), 
+    UE_LOG(LogIdleTask, Log, TEXT("UpdateTaskPriority: Task %s priority changed from %d to %d"), 
            *GlobalTasks[TaskIndex].TaskId, OldPriority, NewPriority);
     
     OnTaskPriorityChanged.Broadcast(TaskIndex, NewPriority);
@@ -168,8 +242,10 @@ bool UTaskManagerComponent::UpdateTaskTargetQuantity(int32 TaskIndex, int32 NewT
     
     int32 OldQuantity = GlobalTasks[TaskIndex].TargetQuantity;
     GlobalTasks[TaskIndex].TargetQuantity = NewTargetQuantity;
+    MarkTasksChanged();
+    RefreshKeepTaskWatches();
     
-    UE_LOG(LogTemp, Warning, TEXT("UpdateTaskTargetQuantity: Task %s quantity changed from %d to %d"),
+    UE_LOG(LogIdleTask, Warning, TEXT("UpdateTaskTargetQuantity: Task %s quantity changed from %d to %d"),
            *GlobalTasks[TaskIndex].TaskId, OldQuantity, NewTargetQuantity);
     
     // UI更新のためイベントを発行
@@ -193,8 +269,9 @@ bool UTaskManagerComponent::CompleteTask(int32 TaskIndex)
     }
     
     GlobalTasks[TaskIndex].bIsCompleted = true;
+    MarkTasksChanged();
     
-    UE_LOG(LogTemp, Warning, TEXT("CompleteTask: Task %s marked as completed"),
+    UE_LOG(LogIdleTask, Warning, TEXT("CompleteTask: Task %s marked as completed"),
            *GlobalTasks[TaskIndex].TaskId);
     
     return true;
@@ -202,12 +279,13 @@ bool UTaskManagerComponent::CompleteTask(int32 TaskIndex)
 
 TArray<FGlobalTask> UTaskManagerComponent::GetGlobalTasksByPriority() const
 {
-    TArray<FGlobalTask> SortedTasks = GlobalTasks;
-    
-    // 優先度順にソート（1が最高優先度）
-    SortedTasks.Sort([](const FGlobalTask& A, const FGlobalTask& B) {
-        return A.Priority < B.Priority;
-    });
+    // インデックスの優先度順（1が最高優先度）に並べて返す
+    TArray<FGlobalTask> SortedTasks;
+    SortedTasks.Reserve(GlobalTaskIndex.Num());
+    for (int32 TaskIndex : GlobalTaskIndex.GetPriorityOrder())
+    {
+        SortedTasks.Add(GlobalTasks[TaskIndex]);
+    }
     
     return SortedTasks;
 }
@@ -219,7 +297,7 @@ FGlobalTask UTaskManagerComponent::GetGlobalTask(int32 TaskIndex) const
         return GlobalTasks[TaskIndex];
     }
     
-    UE_LOG(LogTemp, Warning, TEXT("GetGlobalTask: Invalid task index %d, returning default task"), TaskIndex);
+    UE_LOG(LogIdleTask, Warning, TEXT("GetGlobalTask: Invalid task index %d, returning default task"), TaskIndex);
     return FGlobalTask(); // デフォルトタスク
 }
 
@@ -241,8 +319,9 @@ bool UTaskManagerComponent::SwapTaskPriority(int32 TaskIndex1, int32 TaskIndex2)
     int32 TempPriority = GlobalTasks[TaskIndex1].Priority;
     GlobalTasks[TaskIndex1].Priority = GlobalTasks[TaskIndex2].Priority;
     GlobalTasks[TaskIndex2].Priority = TempPriority;
+    RebuildTaskIndex();
     
-    UE_LOG(LogTemp, Log, TEXT("SwapTaskPriority: Swapped priorities between tasks %d and %d"), TaskIndex1, TaskIndex2);
+    UE_LOG(LogIdleTask, Log, TEXT("SwapTaskPriority: Swapped priorities between tasks %d and %d"), TaskIndex1, TaskIndex2);
     
     OnTaskPriorityChanged.Broadcast(TaskIndex1, GlobalTasks[TaskIndex1].Priority);
     OnTaskPriorityChanged.Broadcast(TaskIndex2, GlobalTasks[TaskIndex2].Priority);
@@ -257,34 +336,15 @@ bool UTaskManagerComponent::MoveTaskUp(int32 TaskIndex)
         return false;
     }
 
-    TArray<FGlobalTask> SortedTasks = GetGlobalTasksByPriority();
-    
-    // 現在のタスクを探す
-    int32 CurrentPosition = -1;
-    for (int32 i = 0; i < SortedTasks.Num(); i++)
-    {
-        if (SortedTasks[i].TaskId == GlobalTasks[TaskIndex].TaskId)
-        {
-            CurrentPosition = i;
-            break;
-        }
-    }
-
+    // 現在の優先度順位置
+    const int32 CurrentPosition = GlobalTaskIndex.GetPriorityPosition(TaskIndex);
     if (CurrentPosition <= 0)
     {
         return false; // 既に最高優先度または見つからない
     }
 
     // 1つ上のタスクと優先度を交換
-    for (int32 i = 0; i < GlobalTasks.Num(); i++)
-    {
-        if (GlobalTasks[i].TaskId == SortedTasks[CurrentPosition - 1].TaskId)
-        {
-            return SwapTaskPriority(TaskIndex, i);
-        }
-    }
-
-    return false;
+    return SwapTaskPriority(TaskIndex, GlobalTaskIndex.GetPriorityOrder()[CurrentPosition - 1]);
 }
 
 bool UTaskManagerComponent::MoveTaskDown(int32 TaskIndex)
@@ -294,60 +354,35 @@ bool UTaskManagerComponent::MoveTaskDown(int32 TaskIndex)
         return false;
     }
 
-    TArray<FGlobalTask> SortedTasks = GetGlobalTasksByPriority();
-    
-    // 現在のタスクを探す
-    int32 CurrentPosition = -1;
-    for (int32 i = 0; i < SortedTasks.Num(); i++)
-    {
-        if (SortedTasks[i].TaskId == GlobalTasks[TaskIndex].TaskId)
-        {
-            CurrentPosition = i;
-            break;
-        }
-    }
-
-    if (CurrentPosition < 0 || CurrentPosition >= SortedTasks.Num() - 1)
+    // 現在の優先度順位置
+    const int32 CurrentPosition = GlobalTaskIndex.GetPriorityPosition(TaskIndex);
+    if (CurrentPosition < 0 || CurrentPosition >= GlobalTaskIndex.Num() - 1)
     {
         return false; // 既に最低優先度または見つからない
     }
 
     // 1つ下のタスクと優先度を交換
-    for (int32 i = 0; i < GlobalTasks.Num(); i++)
-    {
-        if (GlobalTasks[i].TaskId == SortedTasks[CurrentPosition + 1].TaskId)
-        {
-            return SwapTaskPriority(TaskIndex, i);
-        }
-    }
-
-    return false;
+    return SwapTaskPriority(TaskIndex, GlobalTaskIndex.GetPriorityOrder()[CurrentPosition + 1]);
 }
 
 void UTaskManagerComponent::RecalculatePriorities()
 {
+    // 削除後の添字に合わせてインデックスを作り直す
+    RebuildTaskIndex();
+    
     if (GlobalTasks.Num() == 0)
     {
         return;
     }
 
-    // 優先度順にソートしてから連番を振り直す
-    TArray<FGlobalTask> SortedTasks = GetGlobalTasksByPriority();
-    
-    for (int32 i = 0; i < SortedTasks.Num(); i++)
+    // 優先度順に連番を振り直す（相対順序は変わらないのでインデックスはそのまま有効）
+    const TArray<int32>& PriorityOrder = GlobalTaskIndex.GetPriorityOrder();
+    for (int32 Position = 0; Position < PriorityOrder.Num(); Position++)
     {
-        // 元の配列で該当タスクを見つけて更新
-        for (FGlobalTask& Task : GlobalTasks)
-        {
-            if (Task.TaskId == SortedTasks[i].TaskId)
-            {
-                Task.Priority = i + 1; // 1から開始
-                break;
-            }
-        }
+        GlobalTasks[PriorityOrder[Position]].Priority = Position + 1; // 1から開始
     }
     
-    UE_LOG(LogTemp, Log, TEXT("RecalculatePriorities: Recalculated priorities for %d tasks"), GlobalTasks.Num());
+    UE_LOG(LogIdleTask, Log, TEXT("RecalculatePriorities: Recalculated priorities for %d tasks"), GlobalTasks.Num());
 }
 
 // === 「全て」モード用タスク選択 ===
@@ -360,10 +395,19 @@ FGlobalTask UTaskManagerComponent::GetNextAvailableTask(int32 TeamIndex) const
         return FGlobalTask();
     }
 
-    TArray<FGlobalTask> SortedTasks = GetGlobalTasksByPriority();
-    
-    for (const FGlobalTask& Task : SortedTasks)
+    // 一括割り当て済みならその結果を使う（チームごとの貪欲選択で同じタスクに集中しないように）
+    if (const FTeamTaskAllocation* Allocation = AllModeAllocations.Find(TeamIndex))
+    {
+        const int32 AllocatedIndex = FindTaskByID(Allocation->TaskId);
+        if (GlobalTasks.IsValidIndex(AllocatedIndex) && CanTeamExecuteTask(TeamIndex, GlobalTasks[AllocatedIndex]))
+        {
+            return GlobalTasks[AllocatedIndex];
+        }
+    }
+
+    for (int32 TaskIndex : GlobalTaskIndex.GetPriorityOrder())
     {
+        const FGlobalTask& Task = GlobalTasks[TaskIndex];
         if (Task.bIsCompleted)
         {
             continue; // 完了済みタスクはスキップ
@@ -371,13 +415,13 @@ FGlobalTask UTaskManagerComponent::GetNextAvailableTask(int32 TeamIndex) const
 
         if (CanTeamExecuteTask(TeamIndex, Task))
         {
-            UE_LOG(LogTemp, VeryVerbose, TEXT("GetNextAvailableTask: Found available task %s for team %d"), 
+            UE_LOG(LogIdleTask, VeryVerbose, TEXT("GetNextAvailableTask: Found available task %s for team %d"), 
                    *Task.TaskId, TeamIndex);
             return Task;
         }
     }
     
-    UE_LOG(LogTemp, VeryVerbose, TEXT("GetNextAvailableTask: No available tasks found for team %d"), TeamIndex);
+    UE_LOG(LogIdleTask, VeryVerbose, TEXT("GetNextAvailableTask: No available tasks found for team %d"), TeamIndex);
     return FGlobalTask(); // 実行可能なタスクなし
 }
 
@@ -415,6 +459,338 @@ bool UTaskManagerComponent::CanTeamExecuteTask(int32 TeamIndex, const FGlobalTas
     return true;
 }
 
+void UTaskManagerComponent::SyncRecipeGraph()
+{
+    if (IsValid(CraftingComponentRef))
+    {
+        CraftingComponentRef->SyncUnlockedRecipes();
+    }
+}
+
+int32 UTaskManagerComponent::AllocateAllModeTeams()
+{
+    SCOPE_CYCLE_COUNTER(STAT_IdleSim_TaskAllocation);
+    TRACE_CPUPROFILER_EVENT_SCOPE(IdleSim_TaskAllocation);
+
+    if (!IsValid(TeamComponentRef))
+    {
+        return 0;
+    }
+
+    TArray<FTaskAllocationTeam> Teams;
+    BuildAllocationTeams(Teams);
+
+    TArray<FTaskAllocationCandidate> Candidates;
+    BuildAllocationCandidates(Candidates);
+
+    // 割り当て対象になるタスクとチーム構成が変わっていなければ、候補に残っている割り当てはそのまま維持する
+    // （移動中の距離変化やKeepタスクのしきい値と無関係な変更で毎ターン付け替えて行き来しないように）
+    TArray<FString> CandidateTaskIds;
+    CandidateTaskIds.Reserve(Candidates.Num());
+    for (const FTaskAllocationCandidate& Candidate : Candidates)
+    {
+        CandidateTaskIds.Add(Candidate.TaskId);
+    }
+    const bool bCanKeepPrevious = AllocationCandidateTaskIds == CandidateTaskIds
+        && AllocationTeamStateVersion == TeamComponentRef->GetTeamStateVersion();
+
+    TMap<int32, FTeamTaskAllocation> NewAllocations;
+    TSet<FString> AllocatedTaskIds;
+    TArray<FTaskAllocationTeam> OpenTeams;
+    for (const FTaskAllocationTeam& Team : Teams)
+    {
+        const FTeamTaskAllocation* Previous = bCanKeepPrevious ? AllModeAllocations.Find(Team.TeamIndex) : nullptr;
+        const bool bStillCandidate = Previous && Candidates.ContainsByPredicate([Previous](const FTaskAllocationCandidate& Candidate)
+        {
+            return Candidate.TaskId == Previous->TaskId;
+        });
+
+        if (bStillCandidate)
+        {
+            NewAllocations.Add(Team.TeamIndex, *Previous);
+            AllocatedTaskIds.Add(Previous->TaskId);
+        }
+        else
+        {
+            OpenTeams.Add(Team);
+        }
+    }
+
+    // 残りのチームはまだ誰も担当していないタスクから割り当てる（全て担当済みなら全タスクから）
+    TArray<FTaskAllocationCandidate> OpenCandidates = Candidates.FilterByPredicate([&AllocatedTaskIds](const FTaskAllocationCandidate& Candidate)
+    {
+        return !AllocatedTaskIds.Contains(Candidate.TaskId);
+    });
+    if (OpenCandidates.Num() == 0)
+    {
+        OpenCandidates = Candidates;
+    }
+
+    for (const FTeamTaskAllocation& Allocation : UTaskAllocationSolver::Allocate(OpenTeams, OpenCandidates, AllocationWeights))
+    {
+        NewAllocations.Add(Allocation.TeamIndex, Allocation);
+    }
+
+    // 割り当てが変わったときだけ目標アイテム判定キャッシュを無効化する
+    bool bChanged = NewAllocations.Num() != AllModeAllocations.Num();
+    for (auto It = NewAllocations.CreateConstIterator(); It && !bChanged; ++It)
+    {
+        const FTeamTaskAllocation* Previous = AllModeAllocations.Find(It.Key());
+        bChanged = !Previous || Previous->TaskId != It.Value().TaskId || Previous->LocationId != It.Value().LocationId;
+    }
+
+    if (bChanged)
+    {
+        AllModeAllocations = MoveTemp(NewAllocations);
+        ++AllocationVersion;
+
+        UE_LOG(LogIdleTask, Verbose, TEXT("AllocateAllModeTeams: %d teams allocated across %d candidate tasks"),
+            AllModeAllocations.Num(), Candidates.Num());
+    }
+
+    AllocationCandidateTaskIds = MoveTemp(CandidateTaskIds);
+    AllocationTeamStateVersion = TeamComponentRef->GetTeamStateVersion();
+
+    return AllModeAllocations.Num();
+}
+
+void UTaskManagerComponent::BuildAllocationCandidates(TArray<FTaskAllocationCandidate>& OutCandidates) const
+{
+    OutCandidates.Reset();
+
+    const UGameInstance* GameInstance = GetWorld() ? GetWorld()->GetGameInstance() : nullptr;
+    const ULocationDataTableManager* LocationManager = GameInstance ? GameInstance->GetSubsystem<ULocationDataTableManager>() : nullptr;
+    if (!LocationManager)
+    {
+        return;
+    }
+
+    const ULocationMovementComponent* MovementComp = GetOwner() ? GetOwner()->FindComponentByClass<ULocationMovementComponent>() : nullptr;
+
+    // 「全て」モードの判断は採集として実行されるため、採集タスクのみを対象にする
+    for (int32 TaskIndex : GlobalTaskIndex.GetTasksOfType(ETaskType::Gathering))
+    {
+        const FGlobalTask& Task = GlobalTasks[TaskIndex];
+        if (Task.bIsCompleted)
+        {
+            continue;
+        }
+
+        // 満たされているKeepタスクは割り当てない
+        if (Task.GatheringQuantityType == EGatheringQuantityType::Keep && Task.TargetQuantity > 0 && IsKeepTaskSatisfied(Task))
+        {
+            continue;
+        }
+
+        const TArray<FString>& Locations = LocationManager->GetLocationsForItem(Task.TargetItemId);
+        if (Locations.Num() == 0)
+        {
+            continue; // どこでも採集できない
+        }
+
+        FTaskAllocationCandidate& Candidate = OutCandidates.AddDefaulted_GetRef();
+        Candidate.TaskIndex = TaskIndex;
+        Candidate.TaskId = Task.TaskId;
+        Candidate.PriorityPosition = GlobalTaskIndex.GetPriorityPosition(TaskIndex);
+
+        Candidate.Sites.Reserve(Locations.Num());
+        for (const FString& LocationId : Locations)
+        {
+            FTaskAllocationSite& Site = Candidate.Sites.AddDefaulted_GetRef();
+            Site.LocationId = LocationId;
+            Site.DistanceFromBase = MovementComp ? MovementComp->GetLocationDistanceFromBase(LocationId) : 0.0f;
+            Site.GatheringCoefficient = LocationManager->GetGatheringCoefficient(LocationId, Task.TargetItemId);
+        }
+    }
+}
+
+void UTaskManagerComponent::BuildAllocationTeams(TArray<FTaskAllocationTeam>& OutTeams) const
+{
+    OutTeams.Reset();
+
+    const ULocationMovementComponent* MovementComp = GetOwner() ? GetOwner()->FindComponentByClass<ULocationMovementComponent>() : nullptr;
+    const TArray<FTeam>& AllTeams = TeamComponentRef->GetTeams();
+
+    for (int32 TeamIndex = 0; TeamIndex < AllTeams.Num(); ++TeamIndex)
+    {
+        const FTeam& Team = AllTeams[TeamIndex];
+        if (Team.AssignedTask != ETaskType::All || !Team.IsValidTeam() || Team.Members.Num() == 0)
+        {
+            continue;
+        }
+
+        FTaskAllocationTeam& AllocationTeam = OutTeams.AddDefaulted_GetRef();
+        AllocationTeam.TeamIndex = TeamIndex;
+        AllocationTeam.DistanceFromBase = MovementComp ? MovementComp->GetCurrentDistanceFromBase(TeamIndex) : 0.0f;
+
+        for (AC_IdleCharacter* Member : Team.Members)
+        {
+            if (IsValid(Member))
+            {
+                if (UCharacterStatusComponent* StatusComp = Member->GetStatusComponent())
+                {
+                    AllocationTeam.GatheringPower += StatusComp->GetGatheringPower();
+                }
+            }
+        }
+    }
+}
+
+// === 完了予測 ===
+
+int32 UTaskManagerComponent::GetPredictedCompletionTurn(const FString& TaskId) const
+{
+    RefreshTaskForecasts();
+    
+    const int32* PredictedTurn = ForecastCompletionTurns.Find(TaskId);
+    return PredictedTurn ? *PredictedTurn : -1;
+}
+
+int32 UTaskManagerComponent::GetTurnsUntilCompletion(const FString& TaskId) const
+{
+    const int32 PredictedTurn = GetPredictedCompletionTurn(TaskId);
+    return PredictedTurn >= 0 ? FMath::Max(0, PredictedTurn - GetSimulationTurn()) : -1;
+}
+
+int32 UTaskManagerComponent::GetNextPredictedCompletionTurn() const
+{
+    RefreshTaskForecasts();
+    return NextForecastTurn;
+}
+
+TArray<FString> UTaskManagerComponent::GetTaskIdsByPredictedCompletion() const
+{
+    RefreshTaskForecasts();
+    
+    TArray<TPair<int32, FString>> Ordered;
+    Ordered.Reserve(ForecastCompletionTurns.Num());
+    for (const TPair<FString, int32>& Forecast : ForecastCompletionTurns)
+    {
+        Ordered.Emplace(Forecast.Value, Forecast.Key);
+    }
+    
+    // 同じ予測ターンは優先度順
+    Ordered.Sort([this](const TPair<int32, FString>& A, const TPair<int32, FString>& B)
+    {
+        if (A.Key != B.Key)
+        {
+            return A.Key < B.Key;
+        }
+        return GlobalTaskIndex.GetPriorityPosition(GlobalTaskIndex.FindTaskIndex(A.Value))
+            < GlobalTaskIndex.GetPriorityPosition(GlobalTaskIndex.FindTaskIndex(B.Value));
+    });
+    
+    TArray<FString> TaskIds;
+    TaskIds.Reserve(Ordered.Num());
+    for (TPair<int32, FString>& Entry : Ordered)
+    {
+        TaskIds.Add(MoveTemp(Entry.Value));
+    }
+    
+    return TaskIds;
+}
+
+void UTaskManagerComponent::RefreshTaskForecasts() const
+{
+    // 予測は周期モデルの評価とチーム判定を伴うのでゲームスレッドでのみ更新する
+    if (!IsInGameThread())
+    {
+        return;
+    }
+    
+    const int32 CurrentTurn = GetSimulationTurn();
+    const uint32 TeamStateVersion = IsValid(TeamComponentRef) ? TeamComponentRef->GetTeamStateVersion() : 0;
+    
+    // 採集レートの変更番号：メンバーの能力値（積載量・採集力）
+    // 在庫の増減は予測に織り込み済みなので見ない（Keepタスクのしきい値をまたいだときだけ個別に更新する）
+    const UCharacterRosterManager* Roster = UCharacterRosterManager::Get(this);
+    const uint32 RateVersion = Roster ? Roster->GetStatusVersion() : 0;
+    
+    // 採集量・移動時間・担当が変わらない限り予測完了ターンは動かない
+    // 予測より遅れているタスクがあれば（予測外の消費など）作り直す
+    const bool bUpToDate = ForecastBaseTurn != INDEX_NONE
+        && ForecastTaskSetVersion == TaskSetVersion
+        && ForecastTeamStateVersion == TeamStateVersion
+        && ForecastRateVersion == RateVersion
+        && ForecastAllocationVersion == AllocationVersion
+        && CurrentTurn >= ForecastBaseTurn
+        && (NextForecastTurn == INDEX_NONE || CurrentTurn <= NextForecastTurn);
+    AC_PlayerController* PlayerController = Cast<AC_PlayerController>(GetOwner());
+    if (bUpToDate)
+    {
+        if (DirtyForecastTaskIds.Num() == 0)
+        {
+            return;
+        }
+        
+        SCOPE_CYCLE_COUNTER(STAT_IdleSim_TaskForecast);
+        TRACE_CPUPROFILER_EVENT_SCOPE(IdleSim_TaskForecast);
+        
+        // しきい値をまたいだKeepタスクの予測だけ差し替える
+        TSet<FString> DirtyTaskIds = MoveTemp(DirtyForecastTaskIds);
+        DirtyForecastTaskIds.Reset();
+        for (const FString& TaskId : DirtyTaskIds)
+        {
+            ForecastCompletionTurns.Remove(TaskId);
+            PendingForecastTaskIds.Remove(TaskId);
+        }
+        
+        ApplyTaskForecasts(UOfflineProgressCalculator::ForecastTaskCompletionTurnsFor(PlayerController, ForecastHorizonTurns, DirtyTaskIds),
+            CurrentTurn);
+        
+        UE_LOG(LogIdleTask, Verbose, TEXT("📋⏳ Task forecast updated at turn %d: %d Keep tasks, next completion %d"),
+            CurrentTurn, DirtyTaskIds.Num(), NextForecastTurn);
+        return;
+    }
+    
+    SCOPE_CYCLE_COUNTER(STAT_IdleSim_TaskForecast);
+    TRACE_CPUPROFILER_EVENT_SCOPE(IdleSim_TaskForecast);
+    
+    ForecastBaseTurn = CurrentTurn;
+    ForecastTaskSetVersion = TaskSetVersion;
+    ForecastTeamStateVersion = TeamStateVersion;
+    ForecastRateVersion = RateVersion;
+    ForecastAllocationVersion = AllocationVersion;
+    ForecastCompletionTurns.Reset();
+    PendingForecastTaskIds.Reset();
+    DirtyForecastTaskIds.Reset();
+    
+    ApplyTaskForecasts(UOfflineProgressCalculator::ForecastTaskCompletionTurns(PlayerController, ForecastHorizonTurns), CurrentTurn);
+    
+    UE_LOG(LogIdleTask, Verbose, TEXT("📋⏳ Task forecast rebuilt at turn %d: %d tasks, next completion %d"),
+        CurrentTurn, ForecastCompletionTurns.Num(), NextForecastTurn);
+}
+
+void UTaskManagerComponent::ApplyTaskForecasts(const TMap<FString, int32>& TurnsByTask, int32 CurrentTurn) const
+{
+    for (const TPair<FString, int32>& Forecast : TurnsByTask)
+    {
+        ForecastCompletionTurns.Add(Forecast.Key, CurrentTurn + Forecast.Value);
+        
+        // 達成済み（キープ型で在庫が足りている等）は待つ対象にしない
+        if (Forecast.Value > 0)
+        {
+            PendingForecastTaskIds.Add(Forecast.Key);
+        }
+    }
+    
+    NextForecastTurn = INDEX_NONE;
+    for (const FString& TaskId : PendingForecastTaskIds)
+    {
+        const int32 PredictedTurn = ForecastCompletionTurns.FindChecked(TaskId);
+        if (NextForecastTurn == INDEX_NONE || PredictedTurn < NextForecastTurn)
+        {
+            NextForecastTurn = PredictedTurn;
+        }
+    }
+}
+
+int32 UTaskManagerComponent::GetSimulationTurn() const
+{
+    const UTimeManagerComponent* TimeManager = UTimeManagerComponent::Get(this);
+    return TimeManager ? TimeManager->GetCurrentTurn() : 0;
+}
+
 // === リソース監視・判定 ===
 
 bool UTaskManagerComponent::CheckResourceRequirements(const FTeamTask& Task) const
@@ -430,7 +806,7 @@ bool UTaskManagerComponent::CheckResourceRequirements(const FTeamTask& Task) con
         int32 TotalAmount = GetTotalResourceAmount(Requirement.Key);
         if (TotalAmount < Requirement.Value)
         {
-            UE_LOG(LogTemp, VeryVerbose, TEXT("CheckResourceRequirements: Insufficient %s (have %d, need %d)"), 
+            UE_LOG(LogIdleTask, VeryVerbose, TEXT("CheckResourceRequirements: Insufficient %s (have %d, need %d)"), 
                    *Requirement.Key, TotalAmount, Requirement.Value);
             return false;
         }
@@ -439,8 +815,31 @@ bool UTaskManagerComponent::CheckResourceRequirements(const FTeamTask& Task) con
     return true;
 }
 
+int32 UTaskManagerComponent::GetTotalResourceAmount(FSimItemId ResourceId) const
+{
+    if (const UResourceLedgerManager* Ledger = UResourceLedgerManager::Get(this))
+    {
+        if (Ledger->IsTracked(GlobalInventoryRef))
+        {
+            return Ledger->GetTotalAmount(ResourceId);
+        }
+    }
+    
+    return ResourceId.IsValid() ? GetTotalResourceAmount(ResourceId.ToString()) : 0;
+}
+
 int32 UTaskManagerComponent::GetTotalResourceAmount(const FString& ResourceId) const
 {
+    // 資源台帳（拠点倉庫 + チーム所持の差分集計）があればO(1)で返す
+    if (const UResourceLedgerManager* Ledger = UResourceLedgerManager::Get(this))
+    {
+        if (Ledger->IsTracked(GlobalInventoryRef))
+        {
+            return Ledger->GetTotalAmount(ResourceId);
+        }
+    }
+    
+    // 台帳未初期化時のフォールバック：全インベントリを走査
     int32 TotalAmount = 0;
 
     // グローバルインベントリから取得
@@ -474,32 +873,50 @@ int32 UTaskManagerComponent::GetTotalResourceAmount(const FString& ResourceId) c
 
 bool UTaskManagerComponent::CheckGlobalTaskRequirements(const FGlobalTask& Task, int32 TeamIndex) const
 {
-    // 基本的な要件チェック（将来的にタスクタイプ別の詳細チェックを追加）
-    switch (Task.TaskType)
+    // 中間素材まで展開済みの原材料要件を在庫と突き合わせるだけ
+    for (const FRecipeMaterial& Requirement : GetTaskMaterialRequirements(Task))
     {
-        case ETaskType::Construction:
-            // 建築タスクは木材と石材が必要（例）
-            return GetTotalResourceAmount(TEXT("wood")) >= 10 && 
-                   GetTotalResourceAmount(TEXT("stone")) >= 5;
-            
-        case ETaskType::Cooking:
-            // 料理タスクは食材が必要（例）
-            return GetTotalResourceAmount(TEXT("ingredient")) >= 1;
-            
-        case ETaskType::Gathering:
-            // 採集は常に実行可能
-            return true;
-            
-        case ETaskType::Crafting:
-            // 製作は材料が必要（例）
-            return GetTotalResourceAmount(TEXT("material")) >= 1;
-            
-        case ETaskType::Adventure:
-            // 冒険タスクは常に実行可能（戦闘装備は後で実装）
-            return true;
-            
-        default:
-            return true;
+        if (GetTotalResourceAmount(Requirement.Key) < Requirement.Value)
+        {
+            return false;
+        }
+    }
+    
+    return true;
+}
+
+TArray<FRecipeMaterial> UTaskManagerComponent::GetTaskMaterialRequirements(const FGlobalTask& Task) const
+{
+    if (IsValid(CraftingComponentRef))
+    {
+        const FRecipeGraph& RecipeGraph = CraftingComponentRef->GetRecipeGraph();
+        const FSimItemId TargetId = FSimItemId::Find(Task.TargetItemId);
+        if (RecipeGraph.HasRecipe(TargetId))
+        {
+            // 未アンロックのレシピは展開されず、完成品そのものが要件になる
+            return RecipeGraph.Expand(TargetId, 1);
+        }
+    }
+    
+    return GetTaskTypeResourceRequirements(Task.TaskType);
+}
+
+uint32 UTaskManagerComponent::GetRecipeGraphVersion() const
+{
+    return IsValid(CraftingComponentRef) ? CraftingComponentRef->GetRecipeGraph().GetVersion() : 0;
+}
+
+void UTaskManagerComponent::RefreshDecisionResourceIds() const
+{
+    DecisionRecipeGraphVersion = GetRecipeGraphVersion();
+    
+    DecisionResourceIds.Reset();
+    for (const FGlobalTask& Task : GlobalTasks)
+    {
+        for (const FRecipeMaterial& Requirement : GetTaskMaterialRequirements(Task))
+        {
+            DecisionResourceIds.AddUnique(Requirement.Key);
+        }
     }
 }
 
@@ -523,12 +940,13 @@ void UTaskManagerComponent::ProcessTaskCompletion(const FString& TaskId, int32 C
             if (Task.CurrentProgress >= Task.TargetQuantity)
             {
                 Task.bIsCompleted = true;
+                MarkTasksChanged();
                 LogTaskOperation(TEXT("Completed"), Task);
                 OnGlobalTaskCompleted.Broadcast(Task);
             }
             else
             {
-                UE_LOG(LogTemp, VeryVerbose, TEXT("ProcessTaskCompletion: Task %s progress updated to %d/%d"), 
+                UE_LOG(LogIdleTask, VeryVerbose, TEXT("ProcessTaskCompletion: Task %s progress updated to %d/%d"), 
                        *TaskId, Task.CurrentProgress, Task.TargetQuantity);
             }
             break;
@@ -558,7 +976,7 @@ bool UTaskManagerComponent::UpdateTaskProgress(const FString& TaskId, int32 Prog
     // 進捗ログは重要な場合のみ
     if (Task.CurrentProgress >= Task.TargetQuantity)
     {
-        UE_LOG(LogTemp, Warning, TEXT("PROGRESS: %s completed %d/%d"), 
+        UE_LOG(LogIdleTask, Warning, TEXT("PROGRESS: %s completed %d/%d"), 
             *TaskId, Task.CurrentProgress, Task.TargetQuantity);
     }
     
@@ -569,12 +987,12 @@ bool UTaskManagerComponent::UpdateTaskProgress(const FString& TaskId, int32 Prog
         {
             case EGatheringQuantityType::Unlimited:
                 // 無制限採集は永続的に実行される（完了しない）
-                UE_LOG(LogTemp, VeryVerbose, TEXT("Unlimited gathering task %s continues"), *TaskId);
+                UE_LOG(LogIdleTask, VeryVerbose, TEXT("Unlimited gathering task %s continues"), *TaskId);
                 return true;
                 
             case EGatheringQuantityType::Keep:
                 // キープ型は永続的に実行される（完了しない）
-                UE_LOG(LogTemp, VeryVerbose, TEXT("Keep quantity task %s continues"), *TaskId);
+                UE_LOG(LogIdleTask, VeryVerbose, TEXT("Keep quantity task %s continues"), *TaskId);
                 return true;
                 
             case EGatheringQuantityType::Specified:
@@ -582,7 +1000,7 @@ bool UTaskManagerComponent::UpdateTaskProgress(const FString& TaskId, int32 Prog
                 if (Task.CurrentProgress >= Task.TargetQuantity && Task.TargetQuantity > 0)
                 {
                     Task.bIsCompleted = true;
-                    UE_LOG(LogTemp, Warning, TEXT("TASK COMPLETED: %s reached %d/%d - removing from list"), 
+                    UE_LOG(LogIdleTask, Warning, TEXT("TASK COMPLETED: %s reached %d/%d - removing from list"), 
                         *TaskId, Task.CurrentProgress, Task.TargetQuantity);
                     OnGlobalTaskCompleted.Broadcast(Task);
                     
@@ -593,7 +1011,7 @@ bool UTaskManagerComponent::UpdateTaskProgress(const FString& TaskId, int32 Prog
                     // UI更新通知
                     OnGlobalTaskRemoved.Broadcast(TaskIndex);
                     
-                    UE_LOG(LogTemp, Warning, TEXT("✅ Task %s auto-removed. Remaining: %d"), *TaskId, GlobalTasks.Num());
+                    UE_LOG(LogIdleTask, Warning, TEXT("✅ Task %s auto-removed. Remaining: %d"), *TaskId, GlobalTasks.Num());
                 }
                 return true;
                 
@@ -610,7 +1028,7 @@ bool UTaskManagerComponent::UpdateTaskProgress(const FString& TaskId, int32 Prog
                     if (Task.CurrentProgress >= Task.TargetQuantity && Task.TargetQuantity > 0)
                     {
                         Task.bIsCompleted = true;
-                        UE_LOG(LogTemp, Warning, TEXT("TASK COMPLETED: %s reached %d/%d - removing from list"), 
+                        UE_LOG(LogIdleTask, Warning, TEXT("TASK COMPLETED: %s reached %d/%d - removing from list"), 
                             *TaskId, Task.CurrentProgress, Task.TargetQuantity);
                         OnGlobalTaskCompleted.Broadcast(Task);
                         
@@ -618,7 +1036,7 @@ bool UTaskManagerComponent::UpdateTaskProgress(const FString& TaskId, int32 Prog
                         RecalculatePriorities();
                         OnGlobalTaskRemoved.Broadcast(TaskIndex);
                         
-                        UE_LOG(LogTemp, Warning, TEXT("✅ Task %s auto-removed. Remaining: %d"), *TaskId, GlobalTasks.Num());
+                        UE_LOG(LogIdleTask, Warning, TEXT("✅ Task %s auto-removed. Remaining: %d"), *TaskId, GlobalTasks.Num());
                     }
                 }
                 return true;
@@ -629,7 +1047,7 @@ bool UTaskManagerComponent::UpdateTaskProgress(const FString& TaskId, int32 Prog
     if (Task.CurrentProgress >= Task.TargetQuantity && Task.TargetQuantity > 0)
     {
         Task.bIsCompleted = true;
-        UE_LOG(LogTemp, Warning, TEXT("TASK COMPLETED: %s reached %d/%d - removing from list"), 
+        UE_LOG(LogIdleTask, Warning, TEXT("TASK COMPLETED: %s reached %d/%d - removing from list"), 
             *TaskId, Task.CurrentProgress, Task.TargetQuantity);
         OnGlobalTaskCompleted.Broadcast(Task);
         
@@ -640,7 +1058,7 @@ bool UTaskManagerComponent::UpdateTaskProgress(const FString& TaskId, int32 Prog
         // UI更新通知
         OnGlobalTaskRemoved.Broadcast(TaskIndex);
         
-        UE_LOG(LogTemp, Warning, TEXT("✅ Task %s auto-removed. Remaining: %d"), *TaskId, GlobalTasks.Num());
+        UE_LOG(LogIdleTask, Warning, TEXT("✅ Task %s auto-removed. Remaining: %d"), *TaskId, GlobalTasks.Num());
     }
 
     return true;
@@ -654,7 +1072,7 @@ void UTaskManagerComponent::ClearCompletedTasks()
 
     if (RemovedCount > 0)
     {
-        UE_LOG(LogTemp, Log, TEXT("ClearCompletedTasks: Removed %d completed tasks"), RemovedCount);
+        UE_LOG(LogIdleTask, Log, TEXT("ClearCompletedTasks: Removed %d completed tasks"), RemovedCount);
         RecalculatePriorities();
     }
 }
@@ -666,7 +1084,14 @@ void UTaskManagerComponent::SetGlobalInventoryReference(UInventoryComponent* Inv
     if (IsValid(InventoryComponent))
     {
         GlobalInventoryRef = InventoryComponent;
-        UE_LOG(LogTemp, Log, TEXT("TaskManagerComponent: GlobalInventory reference set"));
+        
+        // 拠点倉庫を資源台帳に登録
+        if (UResourceLedgerManager* Ledger = UResourceLedgerManager::Get(this))
+        {
+            Ledger->RegisterBaseInventory(InventoryComponent);
+        }
+        
+        UE_LOG(LogIdleTask, Log, TEXT("TaskManagerComponent: GlobalInventory reference set"));
     }
     else
     {
@@ -679,7 +1104,7 @@ void UTaskManagerComponent::SetTeamComponentReference(UTeamComponent* TeamCompon
     if (IsValid(TeamComponent))
     {
         TeamComponentRef = TeamComponent;
-        UE_LOG(LogTemp, Log, TEXT("TaskManagerComponent: TeamComponent reference set"));
+        UE_LOG(LogIdleTask, Log, TEXT("TaskManagerComponent: TeamComponent reference set"));
     }
     else
     {
@@ -687,6 +1112,21 @@ void UTaskManagerComponent::SetTeamComponentReference(UTeamComponent* TeamCompon
     }
 }
 
+void UTaskManagerComponent::SetCraftingComponentReference(UCraftingComponent* CraftingComponent)
+{
+    if (IsValid(CraftingComponent))
+    {
+        CraftingComponentRef = CraftingComponent;
+        CraftingComponentRef->SyncUnlockedRecipes();
+        RefreshDecisionResourceIds();
+        UE_LOG(LogIdleTask, Log, TEXT("TaskManagerComponent: CraftingComponent reference set"));
+    }
+    else
+    {
+        LogError(TEXT("SetCraftingComponentReference: Invalid crafting component"));
+    }
+}
+
 // === 採集継続判定機能 ===
 
 bool UTaskManagerComponent::ShouldContinueGathering(int32 TeamIndex, const FString& ItemId) const
@@ -715,8 +1155,8 @@ bool UTaskManagerComponent::ShouldContinueGathering(int32 TeamIndex, const FStri
             return true;
             
         case EGatheringQuantityType::Keep:
-            // キープ型：目標数量を下回っている場合は継続
-            return CurrentAvailable < GatheringTask.TargetQuantity;
+            // キープ型：拠点全体の在庫が目標数量を下回っている場合は継続（台帳のしきい値監視の状態）
+            return !IsKeepTaskSatisfied(GatheringTask);
             
         case EGatheringQuantityType::Specified:
             // 個数指定型：目標数量に達していない場合は継続
@@ -761,50 +1201,119 @@ int32 UTaskManagerComponent::GetCurrentItemAvailability(int32 TeamIndex, const F
         }
     }
     
-    return TotalAvailable;
+    return TotalAvailable;
+}
+
+FGlobalTask UTaskManagerComponent::FindActiveGatheringTask(const FString& ItemId) const
+{
+    // 該当アイテムの未完了タスクを優先度順に検索
+    for (int32 TaskIndex : GlobalTaskIndex.GetTasksForItem(ItemId))
+    {
+        const FGlobalTask& Task = GlobalTasks[TaskIndex];
+        if (!Task.bIsCompleted && 
+            (Task.TaskType == ETaskType::Gathering || Task.TaskType == ETaskType::All))
+        {
+            return Task;
+        }
+    }
+    
+    // 見つからない場合は空のタスクを返す
+    return FGlobalTask();
+}
+
+FString UTaskManagerComponent::GetTargetItemForTeam(int32 TeamIndex, const FString& LocationId) const
+{
+    SCOPE_CYCLE_COUNTER(STAT_IdleSim_TargetItemForTeam);
+    TRACE_CPUPROFILER_EVENT_SCOPE(IdleSim_TargetItemForTeam);
+    
+    // 同じチーム・場所の判定はタスク・チーム構成・関連在庫が変わるまで使い回す
+    // （同じターンのメンバー全員で1回の判定を共有する。キャッシュ更新はゲームスレッドのみ）
+    FTeamDecisionVersions Versions;
+    const bool bUseCache = IsInGameThread() && GetTeamDecisionVersions(Versions);
+    if (bUseCache)
+    {
+        if (const FString* CachedTarget = TeamDecisionCache.Find(TeamIndex, LocationId, Versions))
+        {
+            INC_DWORD_STAT(STAT_IdleSim_TeamDecisionCacheHits);
+            return *CachedTarget;
+        }
+        INC_DWORD_STAT(STAT_IdleSim_TeamDecisionCacheMisses);
+    }
+    
+    const FString TargetItem = ResolveTargetItemForTeam(TeamIndex, LocationId);
+    
+    if (bUseCache)
+    {
+        TeamDecisionCache.Store(TeamIndex, LocationId, Versions, TargetItem);
+    }
+    
+    return TargetItem;
 }
 
-FGlobalTask UTaskManagerComponent::FindActiveGatheringTask(const FString& ItemId) const
+bool UTaskManagerComponent::GetTeamDecisionVersions(FTeamDecisionVersions& OutVersions) const
 {
-    // 優先度順にソート
-    TArray<FGlobalTask> SortedTasks = GlobalTasks;
-    SortedTasks.Sort([](const FGlobalTask& A, const FGlobalTask& B) {
-        return A.Priority < B.Priority;
-    });
+    if (!IsValid(TeamComponentRef))
+    {
+        return false;
+    }
     
-    // 該当アイテムの未完了タスクを検索
-    for (const FGlobalTask& Task : SortedTasks)
+    // 在庫の変化は資源台帳の変更番号で検出する（台帳未初期化時はキャッシュしない）
+    const UResourceLedgerManager* Ledger = UResourceLedgerManager::Get(this);
+    if (!Ledger || !Ledger->IsTracked(GlobalInventoryRef))
     {
-        if (Task.TargetItemId == ItemId && 
-            !Task.bIsCompleted && 
-            (Task.TaskType == ETaskType::Gathering || Task.TaskType == ETaskType::All))
-        {
-            return Task;
-        }
+        return false;
     }
     
-    // 見つからない場合は空のタスクを返す
-    return FGlobalTask();
+    // レシピの追加・アンロックで要件が変わったら監視対象の資源を作り直す
+    OutVersions.Recipes = GetRecipeGraphVersion();
+    if (OutVersions.Recipes != DecisionRecipeGraphVersion)
+    {
+        RefreshDecisionResourceIds();
+    }
+    
+    OutVersions.TaskSet = TaskSetVersion;
+    OutVersions.TeamState = TeamComponentRef->GetTeamStateVersion();
+    OutVersions.Allocation = AllocationVersion;
+    
+    // 判定に関わる資源だけを見るので、無関係なアイテムの増減では無効化されない
+    OutVersions.Inventory = 0;
+    for (FSimItemId ResourceId : DecisionResourceIds)
+    {
+        OutVersions.Inventory += Ledger->GetItemVersion(ResourceId);
+    }
+    
+    return true;
 }
 
-FString UTaskManagerComponent::GetTargetItemForTeam(int32 TeamIndex, const FString& LocationId) const
+FString UTaskManagerComponent::ResolveTargetItemForTeam(int32 TeamIndex, const FString& LocationId) const
 {
-    UE_LOG(LogTemp, Warning, TEXT("📋🎯 GetTargetItemForTeam: Team %d, Location %s"), TeamIndex, *LocationId);
+    UE_LOG(LogIdleTask, Verbose, TEXT("📋🎯 GetTargetItemForTeam: Team %d, Location %s"), TeamIndex, *LocationId);
     
     if (!IsValid(TeamComponentRef))
     {
-        UE_LOG(LogTemp, Error, TEXT("GetTargetItemForTeam: TeamComponent unavailable"));
+        UE_LOG(LogIdleTask, Error, TEXT("GetTargetItemForTeam: TeamComponent unavailable"));
         return FString();
     }
     
+    // 「全て」モードで一括割り当て済みのチームは、割り当てられた作業場所でだけ対象アイテムを返す
+    if (const FTeamTaskAllocation* Allocation = AllModeAllocations.Find(TeamIndex))
+    {
+        const int32 AllocatedIndex = FindTaskByID(Allocation->TaskId);
+        if (GlobalTasks.IsValidIndex(AllocatedIndex) && TeamComponentRef->IsValidTeamIndex(TeamIndex)
+            && TeamComponentRef->GetTeams()[TeamIndex].AssignedTask == ETaskType::All)
+        {
+            return Allocation->LocationId == LocationId ? GlobalTasks[AllocatedIndex].TargetItemId : FString();
+        }
+    }
+    
     // 1. チームタスクを優先度順で取得
     TArray<FTeamTask> TeamTasks = TeamComponentRef->GetTeamTasks(TeamIndex);
     
-    UE_LOG(LogTemp, Warning, TEXT("📋📝 GetTargetItemForTeam: Found %d team tasks"), TeamTasks.Num());
+    UE_LOG(LogIdleTask, Verbose, TEXT("📋📝 GetTargetItemForTeam: Found %d team tasks"), TeamTasks.Num());
     
     if (TeamTasks.Num() == 0)
     {
-        UE_LOG(LogTemp, Warning, TEXT("📋⚠️ GetTargetItemForTeam: No team tasks, falling back to global tasks"));
+        UE_LOG(LogIdleTask, Verbose, TEXT("📋⚠️ GetTargetItemForTeam: No team tasks, falling back to global tasks"));
         // チームタスクなし → グローバルタスクにフォールバック
         return GetTargetItemFromGlobalTasks(LocationId);
     }
@@ -814,22 +1323,22 @@ FString UTaskManagerComponent::GetTargetItemForTeam(int32 TeamIndex, const FStri
     {
         const FTeamTask& TeamTask = TeamTasks[i];
         
-        UE_LOG(LogTemp, Warning, TEXT("📋🔍 GetTargetItemForTeam: Checking team task %d - Type: %d, Priority: %d"), 
+        UE_LOG(LogIdleTask, Verbose, TEXT("📋🔍 GetTargetItemForTeam: Checking team task %d - Type: %d, Priority: %d"), 
             i, (int32)TeamTask.TaskType, TeamTask.Priority);
         
         // 3. このチームタスクに対応するグローバルタスクを探す
         FString MatchedTarget = FindMatchingGlobalTask(TeamTask, TeamIndex, LocationId);
         
-        UE_LOG(LogTemp, Warning, TEXT("📋📦 GetTargetItemForTeam: FindMatchingGlobalTask returned: '%s'"), *MatchedTarget);
+        UE_LOG(LogIdleTask, Verbose, TEXT("📋📦 GetTargetItemForTeam: FindMatchingGlobalTask returned: '%s'"), *MatchedTarget);
         
         if (!MatchedTarget.IsEmpty())
         {
-            UE_LOG(LogTemp, Warning, TEXT("📋✅ GetTargetItemForTeam: Returning matched target: '%s'"), *MatchedTarget);
+            UE_LOG(LogIdleTask, Verbose, TEXT("📋✅ GetTargetItemForTeam: Returning matched target: '%s'"), *MatchedTarget);
             return MatchedTarget; // 最初にマッチしたものを返す
         }
     }
     
-    UE_LOG(LogTemp, Warning, TEXT("📋❌ GetTargetItemForTeam: No matching tasks found, returning empty string"));
+    UE_LOG(LogIdleTask, Verbose, TEXT("📋❌ GetTargetItemForTeam: No matching tasks found, returning empty string"));
     return FString(); // 全てのチームタスクでマッチしない → 拠点帰還
 }
 
@@ -840,14 +1349,14 @@ FString UTaskManagerComponent::GetTargetItemFromGlobalTasks(const FString& Locat
     UGameInstance* GameInstance = GetWorld()->GetGameInstance();
     if (!GameInstance)
     {
-        UE_LOG(LogTemp, Warning, TEXT("GetTargetItemFromGlobalTasks: GameInstance not found"));
+        UE_LOG(LogIdleTask, Warning, TEXT("GetTargetItemFromGlobalTasks: GameInstance not found"));
         return FString();
     }
     
     ULocationDataTableManager* LocationManager = GameInstance->GetSubsystem<ULocationDataTableManager>();
     if (!LocationManager)
     {
-        UE_LOG(LogTemp, Warning, TEXT("GetTargetItemFromGlobalTasks: LocationManager not found"));
+        UE_LOG(LogIdleTask, Warning, TEXT("GetTargetItemFromGlobalTasks: LocationManager not found"));
         return FString();
     }
     
@@ -866,21 +1375,10 @@ FString UTaskManagerComponent::GetTargetItemFromGlobalTasks(const FString& Locat
             continue;
         }
         
-        // LocationDataからアイテムが採取可能かチェック
-        if (!LocationId.IsEmpty())
+        // この場所で採取可能なアイテムかチェック（採集可能マトリクス参照）
+        if (!LocationId.IsEmpty() && LocationManager->CanGatherItemAt(LocationId, GlobalTask.TargetItemId))
         {
-            FLocationDataRow LocationData;
-            if (LocationManager->GetLocationData(LocationId, LocationData))
-            {
-                // この場所で採取可能なアイテムリストに含まれているかチェック
-                TArray<FString> GatherableItems;
-                LocationData.GetGatherableItemIds(GatherableItems);
-                
-                if (GatherableItems.Contains(GlobalTask.TargetItemId))
-                {
-                    return GlobalTask.TargetItemId;
-                }
-            }
+            return GlobalTask.TargetItemId;
         }
     }
     
@@ -907,25 +1405,28 @@ bool UTaskManagerComponent::IsTaskCompleted(const FString& TaskId) const
             // 現在の進捗が目標に達しているかチェック
             if (Task.TargetQuantity > 0 && Task.CurrentProgress >= Task.TargetQuantity)
             {
-                UE_LOG(LogTemp, Warning, TEXT("TASK COMPLETED: %s reached target (%d/%d)"), 
+                UE_LOG(LogIdleTask, Verbose, TEXT("TASK COMPLETED: %s reached target (%d/%d)"), 
                     *TaskId, Task.CurrentProgress, Task.TargetQuantity);
                 return true;
             }
             
             // 重要：進捗状況（目標に達していない場合のみ表示）
-            UE_LOG(LogTemp, Warning, TEXT("TASK PROGRESS: %s (%d/%d)"), 
+            UE_LOG(LogIdleTask, Verbose, TEXT("TASK PROGRESS: %s (%d/%d)"), 
                 *TaskId, Task.CurrentProgress, Task.TargetQuantity);
             
             return false;
         }
     }
     
-    UE_LOG(LogTemp, Warning, TEXT("IsTaskCompleted: Task %s not found"), *TaskId);
+    UE_LOG(LogIdleTask, Warning, TEXT("IsTaskCompleted: Task %s not found"), *TaskId);
     return true; // 見つからないタスクは完了とみなす
 }
 
 TArray<FGlobalTask> UTaskManagerComponent::GetExecutableGatheringTasksAtLocation(int32 TeamIndex, const FString& LocationId) const
 {
+    SCOPE_CYCLE_COUNTER(STAT_IdleSim_ExecutableGatheringTasks);
+    TRACE_CPUPROFILER_EVENT_SCOPE(IdleSim_ExecutableGatheringTasks);
+    
     TArray<FGlobalTask> ExecutableTasks;
     
     // LocationDataTableManager を取得して場所の採集可能アイテムリストを確認
@@ -941,57 +1442,48 @@ TArray<FGlobalTask> UTaskManagerComponent::GetExecutableGatheringTasksAtLocation
         return ExecutableTasks;
     }
     
-    // 場所データを取得
-    FLocationDataRow LocationData;
-    if (!LocationManager->GetLocationData(LocationId, LocationData))
+    // その場所の採集可能アイテムリストを取得（採集可能マトリクス参照）
+    const TArray<FString>& GatherableItems = LocationManager->GetGatherableItemIds(LocationId);
+    if (GatherableItems.Num() == 0)
     {
         return ExecutableTasks;
     }
     
-    // その場所の採集可能アイテムリストを取得
-    TArray<FGatherableItemInfo> GatherableItems = LocationData.ParseGatherableItemsList();
+    // その場所で採集できるアイテムのタスクだけをアイテム別インデックスから集める
+    TArray<int32> CandidateTasks;
+    for (const FString& GatherableItemId : GatherableItems)
+    {
+        CandidateTasks.Append(GlobalTaskIndex.GetTasksForItem(GatherableItemId));
+    }
     
-    // 優先度順にソートされた全体タスクを取得
-    TArray<FGlobalTask> SortedTasks = GlobalTasks;
-    SortedTasks.Sort([](const FGlobalTask& A, const FGlobalTask& B) {
-        return A.Priority < B.Priority; // 優先度が高い（数値が小さい）順
+    // 優先度が高い（数値が小さい）順
+    CandidateTasks.Sort([this](int32 A, int32 B) {
+        return GlobalTaskIndex.GetPriorityPosition(A) < GlobalTaskIndex.GetPriorityPosition(B);
     });
     
     // 採集タスクの中で、その場所で実行可能なものを抽出
-    for (const FGlobalTask& Task : SortedTasks)
+    int32 PreviousTaskIndex = INDEX_NONE;
+    for (int32 TaskIndex : CandidateTasks)
     {
-        // 未完了の採集タスクのみ対象
-        if (Task.bIsCompleted || Task.TaskType != ETaskType::Gathering)
+        // 同じアイテムが場所リストに重複していた場合
+        if (TaskIndex == PreviousTaskIndex)
         {
             continue;
         }
+        PreviousTaskIndex = TaskIndex;
         
-        // Keepタスクの満足度チェック：拠点全体の在庫量で判定
-        if (Task.GatheringQuantityType == EGatheringQuantityType::Keep && Task.TargetQuantity > 0)
-        {
-            // 拠点全体の現在在庫量を取得（拠点倉庫 + 全チーム所持）
-            int32 TotalCurrentAmount = GetTotalResourceAmount(Task.TargetItemId);
-            
-            if (TotalCurrentAmount >= Task.TargetQuantity)
-            {
-                continue; // Keep task is satisfied, skip
-            }
-        }
+        const FGlobalTask& Task = GlobalTasks[TaskIndex];
         
-        // その場所で採集可能なアイテムかチェック
-        bool bCanGatherAtLocation = false;
-        for (const FGatherableItemInfo& ItemInfo : GatherableItems)
+        // 未完了の採集タスクのみ対象
+        if (Task.bIsCompleted || Task.TaskType != ETaskType::Gathering)
         {
-            if (ItemInfo.ItemId == Task.TargetItemId)
-            {
-                bCanGatherAtLocation = true;
-                break;
-            }
+            continue;
         }
         
-        if (!bCanGatherAtLocation)
+        // Keepタスクの満足度チェック：拠点全体の在庫量で判定（台帳のしきい値監視）
+        if (Task.GatheringQuantityType == EGatheringQuantityType::Keep && Task.TargetQuantity > 0 && IsKeepTaskSatisfied(Task))
         {
-            continue;
+            continue; // Keep task is satisfied, skip
         }
         
         // チームがこのタスクを実行可能かチェック
@@ -1013,14 +1505,7 @@ bool UTaskManagerComponent::IsValidTaskIndex(int32 TaskIndex) const
 
 int32 UTaskManagerComponent::FindTaskByID(const FString& TaskId) const
 {
-    for (int32 i = 0; i < GlobalTasks.Num(); i++)
-    {
-        if (GlobalTasks[i].TaskId == TaskId)
-        {
-            return i;
-        }
-    }
-    return -1;
+    return GlobalTaskIndex.FindTaskIndex(TaskId);
 }
 
 int32 UTaskManagerComponent::GetIncompleteTaskCount() const
@@ -1073,16 +1558,103 @@ bool UTaskManagerComponent::IsValidArrayAccess(int32 Index) const
     return Index >= 0 && Index < GlobalTasks.Num();
 }
 
+void UTaskManagerComponent::RebuildTaskIndex()
+{
+    GlobalTaskIndex.Rebuild(GlobalTasks);
+    MarkTasksChanged();
+    
+    // 目標アイテム判定が在庫を参照する資源（タスク要件）
+    RefreshDecisionResourceIds();
+    
+    RefreshKeepTaskWatches();
+}
+
+void UTaskManagerComponent::RefreshKeepTaskWatches()
+{
+    ClearKeepTaskWatches();
+    
+    UResourceLedgerManager* Ledger = UResourceLedgerManager::Get(this);
+    if (!Ledger)
+    {
+        return;
+    }
+    
+    // 目標在庫をまたいだときだけ通知を受ける（毎ターンの在庫集計の代わり）
+    for (const FGlobalTask& Task : GlobalTasks)
+    {
+        if (Task.TaskType != ETaskType::Gathering || Task.GatheringQuantityType != EGatheringQuantityType::Keep || Task.TargetQuantity <= 0)
+        {
+            continue;
+        }
+        
+        const int32 WatchHandle = Ledger->AddThresholdWatch(FSimItemId::Intern(Task.TargetItemId), Task.TargetQuantity,
+            ELedgerWatchScope::Total, FOnLedgerThresholdCrossed::CreateUObject(this, &UTaskManagerComponent::OnKeepThresholdCrossed));
+        if (WatchHandle != INDEX_NONE)
+        {
+            KeepTaskWatches.Add(Task.TaskId, WatchHandle);
+        }
+    }
+}
+
+void UTaskManagerComponent::ClearKeepTaskWatches()
+{
+    if (UResourceLedgerManager* Ledger = UResourceLedgerManager::Get(this))
+    {
+        for (const TPair<FString, int32>& Watch : KeepTaskWatches)
+        {
+            Ledger->RemoveThresholdWatch(Watch.Value);
+        }
+    }
+    KeepTaskWatches.Reset();
+}
+
+bool UTaskManagerComponent::IsKeepTaskSatisfied(const FGlobalTask& Task) const
+{
+    // 台帳が拠点倉庫を集計していれば、監視の状態がそのまま拠点全体の在庫判定になる
+    if (const UResourceLedgerManager* Ledger = UResourceLedgerManager::Get(this))
+    {
+        const int32* WatchHandle = KeepTaskWatches.Find(Task.TaskId);
+        if (WatchHandle && Ledger->IsTracked(GlobalInventoryRef))
+        {
+            return Ledger->IsWatchAtOrAbove(*WatchHandle);
+        }
+    }
+    
+    return GetTotalResourceAmount(Task.TargetItemId) >= Task.TargetQuantity;
+}
+
+void UTaskManagerComponent::OnKeepThresholdCrossed(FSimItemId ItemId, bool bAtOrAbove)
+{
+    // 実行可能なKeepタスクが変わったので目標アイテム判定をやり直させる
+    // 完了予測は作り直さず、この品目のKeepタスクの予測だけ次の参照時に差し替える
+    const bool bForecastCurrent = ForecastTaskSetVersion == TaskSetVersion;
+    MarkTasksChanged();
+    if (bForecastCurrent)
+    {
+        ForecastTaskSetVersion = TaskSetVersion;
+        for (const FGlobalTask& Task : GlobalTasks)
+        {
+            if (Task.GatheringQuantityType == EGatheringQuantityType::Keep && Task.TargetItemId == ItemId.ToString())
+            {
+                DirtyForecastTaskIds.Add(Task.TaskId);
+            }
+        }
+    }
+    
+    UE_LOG(LogIdleTask, Verbose, TEXT("Keep threshold crossed: %s is now %s target"),
+        *ItemId.ToString(), bAtOrAbove ? TEXT("at or above") : TEXT("below"));
+}
+
 void UTaskManagerComponent::LogTaskOperation(const FString& Operation, const FGlobalTask& Task) const
 {
-    UE_LOG(LogTemp, Log, TEXT("TaskManager %s: %s (ID: %s, Priority: %d, Type: %s)"),
+    UE_LOG(LogIdleTask, Log, TEXT("TaskManager %s: %s (ID: %s, Priority: %d, Type: %s)"),
            *Operation, *Task.DisplayName, *Task.TaskId, Task.Priority,
            *UTaskTypeUtils::GetTaskTypeDisplayName(Task.TaskType));
 }
 
 void UTaskManagerComponent::LogError(const FString& ErrorMessage) const
 {
-    UE_LOG(LogTemp, Error, TEXT("TaskManagerComponent Error: %s"), *ErrorMessage);
+    UE_LOG(LogIdleTask, Error, TEXT("TaskManagerComponent Error: %s"), *ErrorMessage);
 }
 
 // === タスクマッチング関数群 ===
@@ -1107,41 +1679,41 @@ FString UTaskManagerComponent::FindMatchingGlobalTask(const FTeamTask& TeamTask,
             return FindMatchingCraftingTask(TeamIndex);
             
         default:
-            UE_LOG(LogTemp, Warning, TEXT("⚠️ Unhandled team task type: %d"), (int32)TeamTask.TaskType);
+            UE_LOG(LogIdleTask, Warning, TEXT("⚠️ Unhandled team task type: %d"), (int32)TeamTask.TaskType);
             return FString();
     }
 }
 
 FString UTaskManagerComponent::FindMatchingGatheringTask(int32 TeamIndex, const FString& LocationId) const
 {
-    UE_LOG(LogTemp, Warning, TEXT("📋🌱 FindMatchingGatheringTask: Team %d, Location %s"), TeamIndex, *LocationId);
+    UE_LOG(LogIdleTask, Verbose, TEXT("📋🌱 FindMatchingGatheringTask: Team %d, Location %s"), TeamIndex, *LocationId);
     
     // その場所で採集可能なグローバルタスクを優先度順で取得
-    UE_LOG(LogTemp, Warning, TEXT("📋🔍 FindMatchingGatheringTask: Checking global tasks count: %d"), GlobalTasks.Num());
+    UE_LOG(LogIdleTask, Verbose, TEXT("📋🔍 FindMatchingGatheringTask: Checking global tasks count: %d"), GlobalTasks.Num());
     
-    // 現在のグローバルタスクをログ出力
-    for (int32 i = 0; i < GlobalTasks.Num(); i++)
+    // 現在のグローバルタスクをログ出力（タスク数に比例するので詳細ログ有効時のみ）
+    for (int32 i = 0; UE_LOG_ACTIVE(LogIdleTask, VeryVerbose) && i < GlobalTasks.Num(); i++)
     {
         const FGlobalTask& Task = GlobalTasks[i];
-        UE_LOG(LogTemp, Warning, TEXT("📋📝 Global Task %d: ID=%s, Type=%d, TargetItem=%s, Completed=%s"), 
+        UE_LOG(LogIdleTask, VeryVerbose, TEXT("📋📝 Global Task %d: ID=%s, Type=%d, TargetItem=%s, Completed=%s"), 
             i, *Task.TaskId, (int32)Task.TaskType, *Task.TargetItemId, Task.bIsCompleted ? TEXT("YES") : TEXT("NO"));
     }
     TArray<FGlobalTask> ExecutableTasks = GetExecutableGatheringTasksAtLocation(TeamIndex, LocationId);
     
     if (ExecutableTasks.Num() == 0)
     {
-        UE_LOG(LogTemp, Warning, TEXT("📋❌ FindMatchingGatheringTask: No executable tasks at location %s"), *LocationId);
+        UE_LOG(LogIdleTask, Verbose, TEXT("📋❌ FindMatchingGatheringTask: No executable tasks at location %s"), *LocationId);
     }
     else
     {
-        UE_LOG(LogTemp, Warning, TEXT("📋📊 FindMatchingGatheringTask: Found %d executable tasks at location %s"), 
+        UE_LOG(LogIdleTask, Verbose, TEXT("📋📊 FindMatchingGatheringTask: Found %d executable tasks at location %s"), 
             ExecutableTasks.Num(), *LocationId);
     }
     
     if (ExecutableTasks.Num() > 0)
     {
         const FGlobalTask& SelectedTask = ExecutableTasks[0]; // 最優先
-        UE_LOG(LogTemp, Warning, TEXT("📋✅ FindMatchingGatheringTask: Selected task target item: %s"), 
+        UE_LOG(LogIdleTask, Verbose, TEXT("📋✅ FindMatchingGatheringTask: Selected task target item: %s"), 
             *SelectedTask.TargetItemId);
         return SelectedTask.TargetItemId;
     }
@@ -1152,15 +1724,15 @@ FString UTaskManagerComponent::FindMatchingGatheringTask(int32 TeamIndex, const
 
 FString UTaskManagerComponent::FindMatchingAdventureTask(int32 TeamIndex, const FString& LocationId) const
 {
-    UE_LOG(LogTemp, VeryVerbose, TEXT("  🏔️ Searching adventure tasks for location %s"), *LocationId);
+    UE_LOG(LogIdleTask, VeryVerbose, TEXT("  🏔️ Searching adventure tasks for location %s"), *LocationId);
     
     // 冒険タスクを優先度順で取得
-    TArray<FGlobalTask> AdventureTasks = GetGlobalTasksByPriority();
-    
-    for (const FGlobalTask& Task : AdventureTasks)
+    for (int32 TaskIndex : GlobalTaskIndex.GetTasksOfType(ETaskType::Adventure))
     {
-        // 冒険タスクかつ未完了のタスクのみ対象
-        if (Task.TaskType == ETaskType::Adventure && !Task.bIsCompleted)
+        const FGlobalTask& Task = GlobalTasks[TaskIndex];
+        
+        // 未完了のタスクのみ対象
+        if (!Task.bIsCompleted)
         {
             // TargetItemIdを場所IDとして使用（例: "plains", "forest"など）
             if (Task.TargetItemId == LocationId || Task.TargetItemId.IsEmpty())
@@ -1168,7 +1740,7 @@ FString UTaskManagerComponent::FindMatchingAdventureTask(int32 TeamIndex, const
                 // チームがタスクを実行可能かチェック
                 if (CanTeamExecuteTask(TeamIndex, Task))
                 {
-                    UE_LOG(LogTemp, VeryVerbose, TEXT("  ✅ Selected adventure task: %s at %s"), 
+                    UE_LOG(LogIdleTask, VeryVerbose, TEXT("  ✅ Selected adventure task: %s at %s"), 
                         *Task.DisplayName, *LocationId);
                     return Task.TaskId;
                 }
@@ -1176,27 +1748,27 @@ FString UTaskManagerComponent::FindMatchingAdventureTask(int32 TeamIndex, const
         }
     }
     
-    UE_LOG(LogTemp, VeryVerbose, TEXT("  ❌ No adventure tasks available for %s"), *LocationId);
+    UE_LOG(LogIdleTask, VeryVerbose, TEXT("  ❌ No adventure tasks available for %s"), *LocationId);
     return FString();
 }
 
 FString UTaskManagerComponent::FindMatchingConstructionTask(int32 TeamIndex) const
 {
-    UE_LOG(LogTemp, VeryVerbose, TEXT("  🏗️ Construction task matching (not implemented)"));
+    UE_LOG(LogIdleTask, VeryVerbose, TEXT("  🏗️ Construction task matching (not implemented)"));
     // TODO: 建築システム実装時に追加
     return FString();
 }
 
 FString UTaskManagerComponent::FindMatchingCookingTask(int32 TeamIndex) const
 {
-    UE_LOG(LogTemp, VeryVerbose, TEXT("  🍳 Cooking task matching (not implemented)"));
+    UE_LOG(LogIdleTask, VeryVerbose, TEXT("  🍳 Cooking task matching (not implemented)"));
     // TODO: 料理システム実装時に追加
     return FString();
 }
 
 FString UTaskManagerComponent::FindMatchingCraftingTask(int32 TeamIndex) const
 {
-    UE_LOG(LogTemp, VeryVerbose, TEXT("  ⚒️ Crafting task matching (not implemented)"));
+    UE_LOG(LogIdleTask, VeryVerbose, TEXT("  ⚒️ Crafting task matching (not implemented)"));
     // TODO: 製作システム実装時に追加
     return FString();
 }
@@ -1205,7 +1777,7 @@ FString UTaskManagerComponent::FindMatchingCraftingTask(int32 TeamIndex) const
 
 FTaskExecutionPlan UTaskManagerComponent::CreateExecutionPlanForTeam(int32 TeamIndex, const FString& CurrentLocation, ETaskType CurrentTask)
 {
-    UE_LOG(LogTemp, VeryVerbose, TEXT("📋 Creating execution plan for Team %d at %s (Current Task: %s)"), 
+    UE_LOG(LogIdleTask, VeryVerbose, TEXT("📋 Creating execution plan for Team %d at %s (Current Task: %s)"), 
         TeamIndex, *CurrentLocation, *UTaskTypeUtils::GetTaskTypeDisplayName(CurrentTask));
     
     // タスクタイプに応じて専門メソッドに委譲
@@ -1221,7 +1793,7 @@ FTaskExecutionPlan UTaskManagerComponent::CreateExecutionPlanForTeam(int32 TeamI
             return CreateAllModeExecutionPlan(TeamIndex, CurrentLocation);
             
         default:
-            UE_LOG(LogTemp, Warning, TEXT("⚠️ Unsupported task type for execution plan: %s"), 
+            UE_LOG(LogIdleTask, Warning, TEXT("⚠️ Unsupported task type for execution plan: %s"), 
                 *UTaskTypeUtils::GetTaskTypeDisplayName(CurrentTask));
             
             // 無効な計画を返す
@@ -1235,7 +1807,7 @@ FTaskExecutionPlan UTaskManagerComponent::CreateExecutionPlanForTeam(int32 TeamI
 
 FTaskExecutionPlan UTaskManagerComponent::CreateGatheringExecutionPlan(int32 TeamIndex, const FString& CurrentLocation)
 {
-    UE_LOG(LogTemp, VeryVerbose, TEXT("🌾 Creating gathering execution plan for Team %d at %s"), TeamIndex, *CurrentLocation);
+    UE_LOG(LogIdleTask, VeryVerbose, TEXT("🌾 Creating gathering execution plan for Team %d at %s"), TeamIndex, *CurrentLocation);
     
     FTaskExecutionPlan Plan;
     Plan.ExecutionAction = ETaskExecutionAction::None;
@@ -1249,8 +1821,11 @@ FTaskExecutionPlan UTaskManagerComponent::CreateGatheringExecutionPlan(int32 Tea
         Plan.ExecutionReason = TEXT("Auto-unload at base before next gathering task");
         Plan.bIsValid = true;
         
-        // 次の採集先を探す
-        TArray<FString> LocationsToCheck = {TEXT("plains"), TEXT("forest"), TEXT("swamp"), TEXT("mountain")};
+        // 次の採集先を探す（Brainと同じくDataTableの採集可能な場所から）
+        UGameInstance* GameInstance = GetWorld() ? GetWorld()->GetGameInstance() : nullptr;
+        TArray<FString> LocationsToCheck;
+        UCharacterBrain::GetGatheringCandidateLocations(
+            GameInstance ? GameInstance->GetSubsystem<ULocationDataTableManager>() : nullptr, LocationsToCheck);
         for (const FString& LocationId : LocationsToCheck)
         {
             TArray<FGlobalTask> GatheringTasks = GetExecutableGatheringTasksAtLocation(TeamIndex, LocationId);
@@ -1266,7 +1841,7 @@ FTaskExecutionPlan UTaskManagerComponent::CreateGatheringExecutionPlan(int32 Tea
                     *LocationId, *SelectedTask.TargetItemId);
                 Plan.bIsValid = true;
                 
-                UE_LOG(LogTemp, Log, TEXT("📋 Gathering Plan: Move to %s for %s"), 
+                UE_LOG(LogIdleTask, Log, TEXT("📋 Gathering Plan: Move to %s for %s"), 
                     *LocationId, *SelectedTask.TargetItemId);
                 return Plan;
             }
@@ -1292,7 +1867,7 @@ FTaskExecutionPlan UTaskManagerComponent::CreateGatheringExecutionPlan(int32 Tea
             Plan.ExecutionReason = FString::Printf(TEXT("Task %s completed, returning to base"), *ActiveTask.TaskId);
             Plan.bIsValid = true;
             
-            UE_LOG(LogTemp, Log, TEXT("📋 Gathering Plan: Task completed, returning to base"));
+            UE_LOG(LogIdleTask, Log, TEXT("📋 Gathering Plan: Task completed, returning to base"));
             return Plan;
         }
     }
@@ -1307,7 +1882,7 @@ FTaskExecutionPlan UTaskManagerComponent::CreateGatheringExecutionPlan(int32 Tea
         Plan.ExecutionReason = TEXT("No target item for current location");
         Plan.bIsValid = true;
         
-        UE_LOG(LogTemp, Log, TEXT("📋 Gathering Plan: No target item, returning to base"));
+        UE_LOG(LogIdleTask, Log, TEXT("📋 Gathering Plan: No target item, returning to base"));
         return Plan;
     }
     
@@ -1319,13 +1894,13 @@ FTaskExecutionPlan UTaskManagerComponent::CreateGatheringExecutionPlan(int32 Tea
         *TargetItemId, *CurrentLocation);
     Plan.bIsValid = true;
     
-    UE_LOG(LogTemp, Log, TEXT("📋 Gathering Plan: Execute gathering for %s"), *TargetItemId);
+    UE_LOG(LogIdleTask, Log, TEXT("📋 Gathering Plan: Execute gathering for %s"), *TargetItemId);
     return Plan;
 }
 
 FTaskExecutionPlan UTaskManagerComponent::CreateAdventureExecutionPlan(int32 TeamIndex, const FString& CurrentLocation)
 {
-    UE_LOG(LogTemp, VeryVerbose, TEXT("⚔️ Creating adventure execution plan for Team %d at %s"), TeamIndex, *CurrentLocation);
+    UE_LOG(LogIdleTask, VeryVerbose, TEXT("⚔️ Creating adventure execution plan for Team %d at %s"), TeamIndex, *CurrentLocation);
     
     FTaskExecutionPlan Plan;
     Plan.ExecutionAction = ETaskExecutionAction::None;
@@ -1335,13 +1910,13 @@ FTaskExecutionPlan UTaskManagerComponent::CreateAdventureExecutionPlan(int32 Tea
     if (CurrentLocation == TEXT("base"))
     {
         // 利用可能な冒険タスクから目的地を決定（既存のロジックを統合）
-        TArray<FGlobalTask> AdventureTasks = GetGlobalTasksByPriority();
         FString TargetLocation;
         FString SelectedTaskId;
         
-        for (const FGlobalTask& Task : AdventureTasks)
+        for (int32 TaskIndex : GlobalTaskIndex.GetTasksOfType(ETaskType::Adventure))
         {
-            if (Task.TaskType == ETaskType::Adventure && !Task.bIsCompleted)
+            const FGlobalTask& Task = GlobalTasks[TaskIndex];
+            if (!Task.bIsCompleted)
             {
                 // TargetItemIdを場所として使用
                 if (!Task.TargetItemId.IsEmpty())
@@ -1354,7 +1929,9 @@ FTaskExecutionPlan UTaskManagerComponent::CreateAdventureExecutionPlan(int32 Tea
                 {
                     // 場所が指定されていない場合はランダムに選択
                     TArray<FString> PossibleLocations = {TEXT("plains"), TEXT("forest"), TEXT("swamp"), TEXT("cave")};
-                    TargetLocation = PossibleLocations[FMath::RandRange(0, PossibleLocations.Num() - 1)];
+                    FIdleRandomStream RandomStream = USimulationRandomManager::MakeStreamForCurrentTurn(
+                        this, EIdleRandomDomain::TaskPlanning, static_cast<uint64>(TeamIndex), USimulationRandomManager::GetStringKey(Task.TaskId));
+                    TargetLocation = PossibleLocations[RandomStream.RandRange(0, PossibleLocations.Num() - 1)];
                     SelectedTaskId = Task.TaskId;
                     break;
                 }
@@ -1367,7 +1944,7 @@ FTaskExecutionPlan UTaskManagerComponent::CreateAdventureExecutionPlan(int32 Tea
             Plan.ExecutionReason = TEXT("No adventure tasks available");
             Plan.bIsValid = true;
             
-            UE_LOG(LogTemp, Log, TEXT("📋 Adventure Plan: No adventure tasks available"));
+            UE_LOG(LogIdleTask, Log, TEXT("📋 Adventure Plan: No adventure tasks available"));
             return Plan;
         }
         
@@ -1378,7 +1955,7 @@ FTaskExecutionPlan UTaskManagerComponent::CreateAdventureExecutionPlan(int32 Tea
         Plan.ExecutionReason = FString::Printf(TEXT("Moving to %s for adventure"), *TargetLocation);
         Plan.bIsValid = true;
         
-        UE_LOG(LogTemp, Log, TEXT("📋 Adventure Plan: Move to %s for adventure"), *TargetLocation);
+        UE_LOG(LogIdleTask, Log, TEXT("📋 Adventure Plan: Move to %s for adventure"), *TargetLocation);
         return Plan;
     }
     
@@ -1394,7 +1971,7 @@ FTaskExecutionPlan UTaskManagerComponent::CreateAdventureExecutionPlan(int32 Tea
         Plan.ExecutionReason = FString::Printf(TEXT("Execute combat at %s"), *CurrentLocation);
         Plan.bIsValid = true;
         
-        UE_LOG(LogTemp, Log, TEXT("📋 Adventure Plan: Execute combat at %s"), *CurrentLocation);
+        UE_LOG(LogIdleTask, Log, TEXT("📋 Adventure Plan: Execute combat at %s"), *CurrentLocation);
         return Plan;
     }
     
@@ -1403,13 +1980,13 @@ FTaskExecutionPlan UTaskManagerComponent::CreateAdventureExecutionPlan(int32 Tea
     Plan.ExecutionReason = FString::Printf(TEXT("No matching adventure task at %s, returning to base"), *CurrentLocation);
     Plan.bIsValid = true;
     
-    UE_LOG(LogTemp, Log, TEXT("📋 Adventure Plan: No matching task at %s, returning to base"), *CurrentLocation);
+    UE_LOG(LogIdleTask, Log, TEXT("📋 Adventure Plan: No matching task at %s, returning to base"), *CurrentLocation);
     return Plan;
 }
 
 FTaskExecutionPlan UTaskManagerComponent::CreateAllModeExecutionPlan(int32 TeamIndex, const FString& CurrentLocation)
 {
-    UE_LOG(LogTemp, VeryVerbose, TEXT("🔄 Creating all-mode execution plan for Team %d at %s"), TeamIndex, *CurrentLocation);
+    UE_LOG(LogIdleTask, VeryVerbose, TEXT("🔄 Creating all-mode execution plan for Team %d at %s"), TeamIndex, *CurrentLocation);
     
     FTaskExecutionPlan Plan;
     Plan.ExecutionAction = ETaskExecutionAction::None;
@@ -1425,7 +2002,7 @@ FTaskExecutionPlan UTaskManagerComponent::CreateAllModeExecutionPlan(int32 TeamI
         Plan.ExecutionReason = TEXT("No available tasks in all-mode");
         Plan.bIsValid = true;
         
-        UE_LOG(LogTemp, Log, TEXT("📋 All-Mode Plan: No available tasks"));
+        UE_LOG(LogIdleTask, Log, TEXT("📋 All-Mode Plan: No available tasks"));
         return Plan;
     }
     
@@ -1437,7 +2014,7 @@ FTaskExecutionPlan UTaskManagerComponent::CreateAllModeExecutionPlan(int32 TeamI
                 FTaskExecutionPlan GatheringPlan = CreateGatheringExecutionPlan(TeamIndex, CurrentLocation);
                 GatheringPlan.ExecutionReason = FString::Printf(TEXT("All-mode selected gathering: %s"), 
                     *GatheringPlan.ExecutionReason);
-                UE_LOG(LogTemp, Log, TEXT("📋 All-Mode Plan: Delegated to gathering"));
+                UE_LOG(LogIdleTask, Log, TEXT("📋 All-Mode Plan: Delegated to gathering"));
                 return GatheringPlan;
             }
             
@@ -1446,7 +2023,7 @@ FTaskExecutionPlan UTaskManagerComponent::CreateAllModeExecutionPlan(int32 TeamI
                 FTaskExecutionPlan AdventurePlan = CreateAdventureExecutionPlan(TeamIndex, CurrentLocation);
                 AdventurePlan.ExecutionReason = FString::Printf(TEXT("All-mode selected adventure: %s"), 
                     *AdventurePlan.ExecutionReason);
-                UE_LOG(LogTemp, Log, TEXT("📋 All-Mode Plan: Delegated to adventure"));
+                UE_LOG(LogIdleTask, Log, TEXT("📋 All-Mode Plan: Delegated to adventure"));
                 return AdventurePlan;
             }
             
@@ -1457,7 +2034,7 @@ FTaskExecutionPlan UTaskManagerComponent::CreateAllModeExecutionPlan(int32 TeamI
                 *UTaskTypeUtils::GetTaskTypeDisplayName(NextTask.TaskType));
             Plan.bIsValid = true;
             
-            UE_LOG(LogTemp, Warning, TEXT("📋 All-Mode Plan: Unsupported task type: %s"), 
+            UE_LOG(LogIdleTask, Warning, TEXT("📋 All-Mode Plan: Unsupported task type: %s"), 
                 *UTaskTypeUtils::GetTaskTypeDisplayName(NextTask.TaskType));
             return Plan;
     }
@@ -1471,7 +2048,7 @@ TArray<FString> UTaskManagerComponent::GetGatherableItemsAt(const FString& Locat
     
     if (LocationId.IsEmpty())
     {
-        UE_LOG(LogTemp, Warning, TEXT("📋⛏️ GetGatherableItemsAt: Empty location ID"));
+        UE_LOG(LogIdleTask, Warning, TEXT("📋⛏️ GetGatherableItemsAt: Empty location ID"));
         return GatherableItems;
     }
     
@@ -1479,27 +2056,26 @@ TArray<FString> UTaskManagerComponent::GetGatherableItemsAt(const FString& Locat
     UGameInstance* GameInstance = GetWorld() ? GetWorld()->GetGameInstance() : nullptr;
     if (!GameInstance)
     {
-        UE_LOG(LogTemp, Error, TEXT("📋⛏️ GetGatherableItemsAt: GameInstance not found"));
+        UE_LOG(LogIdleTask, Error, TEXT("📋⛏️ GetGatherableItemsAt: GameInstance not found"));
         return GatherableItems;
     }
     
     ULocationDataTableManager* LocationManager = GameInstance->GetSubsystem<ULocationDataTableManager>();
     if (!LocationManager)
     {
-        UE_LOG(LogTemp, Error, TEXT("📋⛏️ GetGatherableItemsAt: LocationDataTableManager not found"));
+        UE_LOG(LogIdleTask, Error, TEXT("📋⛏️ GetGatherableItemsAt: LocationDataTableManager not found"));
         return GatherableItems;
     }
     
-    FLocationDataRow LocationData;
-    if (LocationManager->GetLocationData(LocationId, LocationData))
+    if (LocationManager->HasCompiledLocation(LocationId))
     {
-        LocationData.GetGatherableItemIds(GatherableItems);
-        UE_LOG(LogTemp, VeryVerbose, TEXT("📋⛏️ GetGatherableItemsAt: Found %d gatherable items at %s"), 
+        GatherableItems = LocationManager->GetGatherableItemIds(LocationId);
+        UE_LOG(LogIdleTask, VeryVerbose, TEXT("📋⛏️ GetGatherableItemsAt: Found %d gatherable items at %s"), 
             GatherableItems.Num(), *LocationId);
     }
     else
     {
-        UE_LOG(LogTemp, Warning, TEXT("📋⛏️ GetGatherableItemsAt: Location %s not found"), *LocationId);
+        UE_LOG(LogIdleTask, Warning, TEXT("📋⛏️ GetGatherableItemsAt: Location %s not found"), *LocationId);
     }
     
     return GatherableItems;
@@ -1511,25 +2087,26 @@ TArray<FString> UTaskManagerComponent::FindLocationsForItem(const FString& ItemI
     
     if (ItemId.IsEmpty())
     {
-        UE_LOG(LogTemp, Warning, TEXT("📋🔍 FindLocationsForItem: Empty item ID"));
+        UE_LOG(LogIdleTask, Warning, TEXT("📋🔍 FindLocationsForItem: Empty item ID"));
         return Locations;
     }
     
-    // 全場所をチェックして該当アイテムが採集可能な場所を探す
-    TArray<FString> AllLocations = {TEXT("base"), TEXT("plains"), TEXT("forest"), TEXT("swamp"), TEXT("mountain"), TEXT("cave")};
+    // 採集可能マトリクスのアイテム別場所リストを参照（DataTableの全場所が対象）
+    const ULocationDataTableManager* LocationManager = nullptr;
+    if (UGameInstance* GameInstance = GetWorld() ? GetWorld()->GetGameInstance() : nullptr)
+    {
+        LocationManager = GameInstance->GetSubsystem<ULocationDataTableManager>();
+    }
     
-    for (const FString& Location : AllLocations)
+    if (!LocationManager)
     {
-        TArray<FString> GatherableItems = GetGatherableItemsAt(Location);
-        if (GatherableItems.Contains(ItemId))
-        {
-            Locations.Add(Location);
-            UE_LOG(LogTemp, VeryVerbose, TEXT("📋🔍 FindLocationsForItem: Item %s found at %s"), 
-                *ItemId, *Location);
-        }
+        UE_LOG(LogIdleTask, Error, TEXT("📋🔍 FindLocationsForItem: LocationDataTableManager not found"));
+        return Locations;
     }
     
-    UE_LOG(LogTemp, VeryVerbose, TEXT("📋🔍 FindLocationsForItem: Item %s can be gathered at %d locations"), 
+    Locations = LocationManager->GetLocationsForItem(ItemId);
+    
+    UE_LOG(LogIdleTask, VeryVerbose, TEXT("📋🔍 FindLocationsForItem: Item %s can be gathered at %d locations"), 
         *ItemId, Locations.Num());
     
     return Locations;
@@ -1539,24 +2116,40 @@ int32 UTaskManagerComponent::CalculateGatheringAmount(int32 TeamIndex, const FSt
 {
     if (!IsValid(TeamComponentRef))
     {
-        UE_LOG(LogTemp, Error, TEXT("📋📊 CalculateGatheringAmount: TeamComponent reference not set"));
+        UE_LOG(LogIdleTask, Error, TEXT("📋📊 CalculateGatheringAmount: TeamComponent reference not set"));
         return 0;
     }
     
     if (ItemId.IsEmpty() || LocationId.IsEmpty())
     {
-        UE_LOG(LogTemp, Warning, TEXT("📋📊 CalculateGatheringAmount: Empty ItemId or LocationId"));
+        UE_LOG(LogIdleTask, Warning, TEXT("📋📊 CalculateGatheringAmount: Empty ItemId or LocationId"));
         return 0;
     }
     
     // チーム情報を取得
-    FTeam Team = TeamComponentRef->GetTeam(TeamIndex);
+    if (!TeamComponentRef->IsValidTeamIndex(TeamIndex))
+    {
+        UE_LOG(LogIdleTask, Warning, TEXT("📋📊 CalculateGatheringAmount: Invalid team %d"), TeamIndex);
+        return 0;
+    }
+    
+    const FTeam& Team = TeamComponentRef->GetTeams()[TeamIndex];
     if (!Team.IsValidTeam() || Team.Members.Num() == 0)
     {
-        UE_LOG(LogTemp, Warning, TEXT("📋📊 CalculateGatheringAmount: Invalid team %d"), TeamIndex);
+        UE_LOG(LogIdleTask, Warning, TEXT("📋📊 CalculateGatheringAmount: Invalid team %d"), TeamIndex);
         return 0;
     }
     
+    const int32 FinalAmount = CalculateTeamGatheringAmount(Team);
+    
+    UE_LOG(LogIdleTask, VeryVerbose, TEXT("📋📊 CalculateGatheringAmount: Team %d, Item %s, Amount %d"), 
+        TeamIndex, *ItemId, FinalAmount);
+    
+    return FinalAmount;
+}
+
+int32 UTaskManagerComponent::CalculateTeamGatheringAmount(const FTeam& Team) const
+{
     // チーム全体の採集力を計算
     float TotalGatheringPower = 0.0f;
     int32 ValidMembers = 0;
@@ -1568,8 +2161,7 @@ int32 UTaskManagerComponent::CalculateGatheringAmount(int32 TeamIndex, const FSt
             // CharacterStatusComponentから採集能力を取得
             if (UCharacterStatusComponent* StatusComp = Member->GetStatusComponent())
             {
-                FDerivedStats DerivedStats = StatusComp->GetDerivedStats();
-                TotalGatheringPower += DerivedStats.GatheringPower;
+                TotalGatheringPower += StatusComp->GetGatheringPower();
                 ValidMembers++;
             }
         }
@@ -1577,111 +2169,315 @@ int32 UTaskManagerComponent::CalculateGatheringAmount(int32 TeamIndex, const FSt
     
     if (ValidMembers == 0)
     {
-        UE_LOG(LogTemp, Warning, TEXT("📋📊 CalculateGatheringAmount: No valid team members"));
+        UE_LOG(LogIdleTask, Warning, TEXT("📋📊 CalculateGatheringAmount: No valid team members"));
         return 0;
     }
     
     // 基本採集量計算（1ターンあたり）
     // 採集効率係数を適用（GatheringComponentと同じ値を使用）
-    float GatheringEfficiencyMultiplier = 40.0f;
-    int32 BaseAmount = FMath::FloorToInt(TotalGatheringPower / GatheringEfficiencyMultiplier);
+    const float GatheringEfficiencyMultiplier = 40.0f;
+    const int32 BaseAmount = FMath::FloorToInt(TotalGatheringPower / GatheringEfficiencyMultiplier);
     
     // 最低1個は採集できるようにする
-    int32 FinalAmount = FMath::Max(BaseAmount, 1);
-    
-    UE_LOG(LogTemp, VeryVerbose, TEXT("📋📊 CalculateGatheringAmount: Team %d, Item %s, Amount %d (Power: %.1f, Members: %d)"), 
-        TeamIndex, *ItemId, FinalAmount, TotalGatheringPower, ValidMembers);
-    
-    return FinalAmount;
+    return FMath::Max(BaseAmount, 1);
 }
 
-bool UTaskManagerComponent::ExecuteGathering(int32 TeamIndex, const FString& ItemId, const FString& LocationId)
+bool UTaskManagerComponent::ValidateGatheringRequest(int32 TeamIndex, const FString& ItemId, const FString& LocationId) const
 {
     if (!IsValid(TeamComponentRef))
     {
-        UE_LOG(LogTemp, Error, TEXT("📋⚡ ExecuteGathering: TeamComponent reference not set"));
+        UE_LOG(LogIdleTask, Error, TEXT("📋⚡ ExecuteGathering: TeamComponent reference not set"));
         return false;
     }
     
     if (ItemId.IsEmpty() || LocationId.IsEmpty())
     {
-        UE_LOG(LogTemp, Warning, TEXT("📋⚡ ExecuteGathering: Empty ItemId or LocationId"));
+        UE_LOG(LogIdleTask, Warning, TEXT("📋⚡ ExecuteGathering: Empty ItemId or LocationId"));
         return false;
     }
     
     // チーム情報を取得
-    FTeam Team = TeamComponentRef->GetTeam(TeamIndex);
+    if (!TeamComponentRef->IsValidTeamIndex(TeamIndex))
+    {
+        UE_LOG(LogIdleTask, Warning, TEXT("📋⚡ ExecuteGathering: Invalid team %d"), TeamIndex);
+        return false;
+    }
+    
+    const FTeam& Team = TeamComponentRef->GetTeams()[TeamIndex];
     if (!Team.IsValidTeam() || Team.Members.Num() == 0)
     {
-        UE_LOG(LogTemp, Warning, TEXT("📋⚡ ExecuteGathering: Invalid team %d"), TeamIndex);
+        UE_LOG(LogIdleTask, Warning, TEXT("📋⚡ ExecuteGathering: Invalid team %d"), TeamIndex);
         return false;
     }
     
-    // 場所で該当アイテムが採集可能かチェック
-    TArray<FString> GatherableItems = GetGatherableItemsAt(LocationId);
-    if (!GatherableItems.Contains(ItemId))
+    // 場所で該当アイテムが採集可能かチェック（採集可能マトリクス参照）
+    const UGameInstance* GameInstance = GetWorld() ? GetWorld()->GetGameInstance() : nullptr;
+    const ULocationDataTableManager* LocationManager = GameInstance ? GameInstance->GetSubsystem<ULocationDataTableManager>() : nullptr;
+    if (!LocationManager || !LocationManager->CanGatherItemAt(LocationId, ItemId))
     {
-        UE_LOG(LogTemp, Warning, TEXT("📋⚡ ExecuteGathering: Item %s not gatherable at %s"), 
+        UE_LOG(LogIdleTask, Warning, TEXT("📋⚡ ExecuteGathering: Item %s not gatherable at %s"), 
             *ItemId, *LocationId);
         return false;
     }
     
-    // 採集量を計算
-    int32 GatheringAmount = CalculateGatheringAmount(TeamIndex, ItemId, LocationId);
-    if (GatheringAmount <= 0)
+    return true;
+}
+
+bool UTaskManagerComponent::ExecuteGathering(int32 TeamIndex, const FString& ItemId, const FString& LocationId)
+{
+    if (!ValidateGatheringRequest(TeamIndex, ItemId, LocationId))
     {
-        UE_LOG(LogTemp, Warning, TEXT("📋⚡ ExecuteGathering: No gathering amount calculated"));
         return false;
     }
     
-    UE_LOG(LogTemp, Warning, TEXT("📋⚡🌱 ExecuteGathering: Team %d gathering %d x %s at %s"), 
-        TeamIndex, GatheringAmount, *ItemId, *LocationId);
+    // 採集ステージ中は予約のみ（同じチーム・アイテム・場所は回数にまとめる）
+    if (bGatheringStageOpen)
+    {
+        // 誰も1個も持てないなら予約しない（従来どおり「何も採集できなかった」を返す）
+        bool bCanCarry = false;
+        for (AC_IdleCharacter* Member : TeamComponentRef->GetTeams()[TeamIndex].Members)
+        {
+            const UInventoryComponent* MemberInventory = IsValid(Member) ? Member->GetInventoryComponent() : nullptr;
+            if (MemberInventory && MemberInventory->CanAddItemByWeight(ItemId, 1))
+            {
+                bCanCarry = true;
+                break;
+            }
+        }
+        
+        if (!bCanCarry)
+        {
+            UE_LOG(LogIdleTask, Verbose, TEXT("📋⚡ ExecuteGathering: Team %d cannot carry any more %s"), TeamIndex, *ItemId);
+            return false;
+        }
+        
+        FGatheringRequest* Existing = PendingGatheringRequests.FindByPredicate([&](const FGatheringRequest& Request) {
+            return Request.TeamIndex == TeamIndex && Request.ItemId == ItemId && Request.LocationId == LocationId;
+        });
+        
+        if (Existing)
+        {
+            Existing->Count++;
+        }
+        else
+        {
+            FGatheringRequest& Request = PendingGatheringRequests.AddDefaulted_GetRef();
+            Request.TeamIndex = TeamIndex;
+            Request.ItemId = ItemId;
+            Request.LocationId = LocationId;
+            Request.Count = 1;
+        }
+        
+        UE_LOG(LogIdleTask, Verbose, TEXT("📋⚡🌱 ExecuteGathering: Team %d queued %s at %s"), 
+            TeamIndex, *ItemId, *LocationId);
+        return true;
+    }
+    
+    // ステージ外からの呼び出しはその場で1件だけ反映
+    TArray<FGatheringRequest> SingleRequest;
+    FGatheringRequest& Request = SingleRequest.AddDefaulted_GetRef();
+    Request.TeamIndex = TeamIndex;
+    Request.ItemId = ItemId;
+    Request.LocationId = LocationId;
+    Request.Count = 1;
     
-    // 各チームメンバーのインベントリに均等配分
-    int32 AmountPerMember = FMath::Max(1, GatheringAmount / Team.Members.Num());
-    int32 RemainingAmount = GatheringAmount;
+    if (ApplyGatheringRequests(SingleRequest) > 0)
+    {
+        return true;
+    }
     
-    for (AC_IdleCharacter* Member : Team.Members)
+    UE_LOG(LogIdleTask, Warning, TEXT("📋⚡ ExecuteGathering: No items were actually gathered"));
+    return false;
+}
+
+// === 採集ステージ ===
+
+void UTaskManagerComponent::BeginGatheringStage()
+{
+    // 前のステージが閉じられていなければ先に反映
+    if (bGatheringStageOpen)
+    {
+        EndGatheringStage();
+    }
+    
+    bGatheringStageOpen = true;
+    PendingGatheringRequests.Reset();
+}
+
+int32 UTaskManagerComponent::EndGatheringStage()
+{
+    if (!bGatheringStageOpen)
+    {
+        return 0;
+    }
+    
+    bGatheringStageOpen = false;
+    
+    if (PendingGatheringRequests.Num() == 0)
+    {
+        return 0;
+    }
+    
+    // 反映中のExecuteGatheringが予約に戻らないよう、ステージを閉じてから処理する
+    TArray<FGatheringRequest> Requests = MoveTemp(PendingGatheringRequests);
+    PendingGatheringRequests.Reset();
+    
+    return ApplyGatheringRequests(Requests);
+}
+
+int32 UTaskManagerComponent::ApplyGatheringRequests(const TArray<FGatheringRequest>& Requests)
+{
+    SCOPE_CYCLE_COUNTER(STAT_IdleSim_GatheringStage);
+    TRACE_CPUPROFILER_EVENT_SCOPE(IdleSim_GatheringStage);
+    
+    if (!IsValid(TeamComponentRef))
+    {
+        return 0;
+    }
+    
+    const TArray<FTeam>& Teams = TeamComponentRef->GetTeams();
+    
+    // チームごとの1回あたり採集量（同じターン内では1度だけ計算）
+    TMap<int32, int32> TeamGatheringAmounts;
+    
+    // インベントリごとの追加量（予約順を保つ）
+    TMap<UInventoryComponent*, TMap<FString, int32>> InventoryDeltas;
+    
+    // インベントリごとの残り積載量（このステージで配分した分を差し引いていく）
+    TMap<UInventoryComponent*, float> RemainingCapacities;
+    
+    for (const FGatheringRequest& Request : Requests)
     {
-        if (IsValid(Member) && RemainingAmount > 0)
+        if (!Teams.IsValidIndex(Request.TeamIndex) || Request.Count <= 0)
+        {
+            continue;
+        }
+        
+        const FTeam& Team = Teams[Request.TeamIndex];
+        if (Team.Members.Num() == 0)
+        {
+            continue;
+        }
+        
+        int32* CachedAmount = TeamGatheringAmounts.Find(Request.TeamIndex);
+        if (!CachedAmount)
+        {
+            CachedAmount = &TeamGatheringAmounts.Add(Request.TeamIndex, CalculateTeamGatheringAmount(Team));
+        }
+        
+        const int32 GatheringAmount = *CachedAmount;
+        if (GatheringAmount <= 0)
+        {
+            continue;
+        }
+        
+        UE_LOG(LogIdleTask, Verbose, TEXT("📋⚡🌱 ExecuteGathering: Team %d gathering %d x %s at %s (%d times)"), 
+            Request.TeamIndex, GatheringAmount, *Request.ItemId, *Request.LocationId, Request.Count);
+        
+        // 1回分を各チームメンバーに均等配分し、回数分をまとめて積む
+        // 積載量が足りないメンバーの分は次のメンバーに回す（入りきらなかった分だけが失われる）
+        const int32 SharePerMember = FMath::Max(1, GatheringAmount / Team.Members.Num()) * Request.Count;
+        int32 RemainingAmount = GatheringAmount * Request.Count;
+        int32 UnplacedAmount = 0;
+        float ItemWeight = -1.0f;
+        
+        for (AC_IdleCharacter* Member : Team.Members)
         {
-            if (UInventoryComponent* MemberInventory = Member->GetInventoryComponent())
+            if (RemainingAmount <= 0)
             {
-                int32 AmountToAdd = FMath::Min(AmountPerMember, RemainingAmount);
-                
-                if (MemberInventory->AddItem(ItemId, AmountToAdd))
-                {
-                    RemainingAmount -= AmountToAdd;
-                    
-                    UE_LOG(LogTemp, Warning, TEXT("📋⚡✅ ExecuteGathering: Added %d %s to %s"), 
-                        AmountToAdd, *ItemId, *Member->GetName());
-                }
-                else
+                break;
+            }
+            
+            if (!IsValid(Member))
+            {
+                continue;
+            }
+            
+            UInventoryComponent* MemberInventory = Member->GetInventoryComponent();
+            if (!MemberInventory)
+            {
+                continue;
+            }
+            
+            if (ItemWeight < 0.0f)
+            {
+                ItemWeight = MemberInventory->GetItemUnitWeight(Request.ItemId);
+                if (ItemWeight < 0.0f)
                 {
-                    UE_LOG(LogTemp, Warning, TEXT("📋⚡ ExecuteGathering: Failed to add %s to %s inventory"), 
-                        *ItemId, *Member->GetName());
+                    break; // DataTableにないアイテム
                 }
             }
+            
+            float* RemainingCapacity = RemainingCapacities.Find(MemberInventory);
+            if (!RemainingCapacity)
+            {
+                RemainingCapacity = &RemainingCapacities.Add(MemberInventory, MemberInventory->GetRemainingCarryingCapacity());
+            }
+            
+            const int32 Desired = FMath::Min(SharePerMember + UnplacedAmount, RemainingAmount);
+            int32 AmountToAdd = Desired;
+            if (ItemWeight > 0.0f && *RemainingCapacity != FLT_MAX)
+            {
+                AmountToAdd = FMath::Min(AmountToAdd, FMath::FloorToInt(*RemainingCapacity / ItemWeight));
+            }
+            
+            UnplacedAmount = Desired - AmountToAdd;
+            if (AmountToAdd <= 0)
+            {
+                continue;
+            }
+            
+            InventoryDeltas.FindOrAdd(MemberInventory).FindOrAdd(Request.ItemId) += AmountToAdd;
+            RemainingAmount -= AmountToAdd;
+            if (*RemainingCapacity != FLT_MAX)
+            {
+                *RemainingCapacity -= ItemWeight * AmountToAdd;
+            }
+        }
+        
+        if (UnplacedAmount > 0)
+        {
+            UE_LOG(LogIdleTask, Verbose, TEXT("📋⚡ ExecuteGathering: Team %d could not carry %d %s"), 
+                Request.TeamIndex, UnplacedAmount, *Request.ItemId);
         }
     }
     
-    // タスク進捗を更新
-    int32 ActualGathered = GatheringAmount - RemainingAmount;
-    if (ActualGathered > 0)
+    // インベントリごとに一括追加（重量計算・変更通知は1回ずつ）
+    TMap<FString, int32> GatheredByItem;
+    TMap<FString, int32> AddedItems;
+    for (const TPair<UInventoryComponent*, TMap<FString, int32>>& Delta : InventoryDeltas)
     {
-        // アクティブな採集タスクを見つけて進捗更新
-        FGlobalTask ActiveTask = FindActiveGatheringTask(ItemId);
-        if (!ActiveTask.TaskId.IsEmpty())
+        Delta.Key->AddItems(Delta.Value, AddedItems);
+        
+        for (const TPair<FString, int32>& Added : AddedItems)
+        {
+            GatheredByItem.FindOrAdd(Added.Key) += Added.Value;
+            
+            UE_LOG(LogIdleTask, Verbose, TEXT("📋⚡✅ ExecuteGathering: Added %d %s to %s"), 
+                Added.Value, *Added.Key, *Delta.Key->OwnerId);
+        }
+        
+        if (AddedItems.Num() < Delta.Value.Num())
         {
-            UpdateTaskProgress(ActiveTask.TaskId, ActualGathered);
+            UE_LOG(LogIdleTask, Verbose, TEXT("📋⚡ ExecuteGathering: %s could not carry all gathered items"), *Delta.Key->OwnerId);
         }
+    }
+    
+    // タスク進捗はアイテムごとに1回だけ更新
+    int32 TotalGathered = 0;
+    for (const TPair<FString, int32>& Gathered : GatheredByItem)
+    {
+        TotalGathered += Gathered.Value;
         
-        UE_LOG(LogTemp, VeryVerbose, TEXT("📋⚡ ExecuteGathering: Successfully gathered %d %s at %s"), 
-            ActualGathered, *ItemId, *LocationId);
+        FGlobalTask ActiveTask = FindActiveGatheringTask(Gathered.Key);
+        if (!ActiveTask.TaskId.IsEmpty())
+        {
+            UpdateTaskProgress(ActiveTask.TaskId, Gathered.Value);
+        }
         
-        return true;
+        UE_LOG(LogIdleTask, VeryVerbose, TEXT("📋⚡ ExecuteGathering: Successfully gathered %d %s"), 
+            Gathered.Value, *Gathered.Key);
     }
     
-    UE_LOG(LogTemp, Warning, TEXT("📋⚡ ExecuteGathering: No items were actually gathered"));
-    return false;
+    return TotalGathered;
 }
\ No newline at end of file
@@ -4,11 +4,16 @@
 #include "Components/ActorComponent.h"
 #include "../Types/TaskTypes.h"
 #include "../Types/TeamTypes.h"
+#include "../Types/TaskIndexTypes.h"
+#include "../Types/TeamDecisionCacheTypes.h"
+#include "../Types/TaskAllocationTypes.h"
+#include "../Types/RecipeGraphTypes.h"
 #include "TaskManagerComponent.generated.h"
 
 // Forward declarations
 class UInventoryComponent;
 class UTeamComponent;
+class UCraftingComponent;
 
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class UE_IDLE_API UTaskManagerComponent : public UActorComponent
@@ -24,13 +29,62 @@ protected:
 
     // === 全体タスク管理 ===
 
-    // 全体タスクリスト（最大20個）
+    // 全体タスクリスト（順序は追加順、優先度順の参照はGlobalTaskIndexを使う）
     UPROPERTY(BlueprintReadWrite, Category = "Task", meta = (AllowPrivateAccess = "true"))
     TArray<FGlobalTask> GlobalTasks;
     
-    // タスク管理設定
+    // タスク管理設定（0以下で上限なし）
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Task Settings")
-    int32 MaxGlobalTasks = 20;
+    int32 MaxGlobalTasks = 0;
+
+    // 優先度順・アイテム別・タイプ別のタスクインデックス（GlobalTasks変更時に再構築）
+    FGlobalTaskIndex GlobalTaskIndex;
+
+    // 全体タスクの変更番号（追加・削除・優先度・完了状態の変更で増える）
+    uint32 TaskSetVersion = 0;
+
+    // チーム目標アイテム判定が参照する資源ID（タスク要件、インデックス再構築時とレシピグラフ変更時に更新）
+    // Keepタスクの対象はしきい値監視で追うため含めない
+    mutable TArray<FSimItemId> DecisionResourceIds;
+
+    // DecisionResourceIdsを作った時点のレシピグラフの変更番号
+    mutable uint32 DecisionRecipeGraphVersion = 0;
+
+    // Keepタスク → 資源台帳のしきい値監視ハンドル（目標在庫をまたいだときだけ状態が変わる）
+    TMap<FString, int32> KeepTaskWatches;
+
+    // (チーム, 場所) ごとの目標アイテム判定キャッシュ
+    mutable FTeamDecisionCache TeamDecisionCache;
+
+    // 「全て」モードのチーム → 割り当てタスク（AllocateAllModeTeamsで更新）
+    TMap<int32, FTeamTaskAllocation> AllModeAllocations;
+
+    // 割り当ての変更番号（割り当てが変わったときだけ増える。タスク集合の変更番号とは別に持つ）
+    uint32 AllocationVersion = 0;
+
+    // 割り当て時点の候補タスク（優先度順）とチーム構成の変更番号
+    // 候補とチーム構成が変わっていなければ解き直さず既存の割り当てを維持する
+    TArray<FString> AllocationCandidateTaskIds;
+    uint32 AllocationTeamStateVersion = 0;
+
+    // タスク → 予測完了ターン（タスク集合・チーム状態・採集レート・割り当てが変わったときだけ作り直す）
+    mutable TMap<FString, int32> ForecastCompletionTurns;
+
+    // 予測を作ったターンと、その時点の変更番号
+    mutable int32 ForecastBaseTurn = INDEX_NONE;
+    mutable uint32 ForecastTaskSetVersion = 0;
+    mutable uint32 ForecastTeamStateVersion = 0;
+    mutable uint32 ForecastRateVersion = 0;
+    mutable uint32 ForecastAllocationVersion = 0;
+
+    // 未達成タスクのうち最も早い予測完了ターン
+    mutable int32 NextForecastTurn = INDEX_NONE;
+
+    // 予測上まだ達成していないタスク（NextForecastTurnの集計対象）
+    mutable TSet<FString> PendingForecastTaskIds;
+
+    // しきい値をまたいだKeepタスク（次の参照時にこのタスクの予測だけ作り直す）
+    mutable TSet<FString> DirtyForecastTaskIds;
 
     // 処理中フラグ（安全性確保用）
     UPROPERTY(BlueprintReadOnly, Category = "Task State")
@@ -46,6 +100,10 @@ protected:
     UPROPERTY()
     UTeamComponent* TeamComponentRef = nullptr;
 
+    // 生産レシピ（タスク要件の展開元）への参照
+    UPROPERTY()
+    UCraftingComponent* CraftingComponentRef = nullptr;
+
 public:
     // === タスク管理機能 ===
 
@@ -85,6 +143,9 @@ public:
     UFUNCTION(BlueprintPure, Category = "Task")
     int32 GetTaskCount() const { return GlobalTasks.Num(); }
 
+    // タスク一覧を記録時の内容・順序のまま置き換える（リプレイの開始状態復元用、記録はしない）
+    void RestoreGlobalTasks(const TArray<FGlobalTask>& Tasks);
+
     // === 優先度管理機能 ===
 
     // タスク優先度入れ替え
@@ -117,15 +178,53 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Task Selection")
     FString GetTargetItemFromGlobalTasks(const FString& LocationId) const;
 
+    // 施設でのレシピのアンロックをレシピグラフへ反映する（TimeManagerがターン開始時に呼ぶ）
+    // constの判定・予測処理はここで反映済みのグラフを読むだけ
+    void SyncRecipeGraph();
+
+    // 「全て」モードの全チームをまとめてタスクと作業場所へ割り当てる（TimeManagerがターンごとに1回呼ぶ）
+    UFUNCTION(BlueprintCallable, Category = "Task Selection")
+    int32 AllocateAllModeTeams();
+
+    // チームの割り当て結果（割り当てなしはnullptr）
+    const FTeamTaskAllocation* FindAllModeAllocation(int32 TeamIndex) const { return AllModeAllocations.Find(TeamIndex); }
+
+    // 割り当てのコスト重み（優先度・移動距離・採集力）
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Task Settings")
+    FTaskAllocationWeights AllocationWeights;
+
+    // === 完了予測 ===
+
+    // タスクの予測完了ターン（採集タスクのみ、予測できない場合は-1）
+    UFUNCTION(BlueprintPure, Category = "Task Forecast")
+    int32 GetPredictedCompletionTurn(const FString& TaskId) const;
+
+    // 予測完了までの残りターン数（「あとNターン」表示用、予測できない場合は-1）
+    UFUNCTION(BlueprintPure, Category = "Task Forecast")
+    int32 GetTurnsUntilCompletion(const FString& TaskId) const;
+
+    // 未達成タスクのうち最も早い予測完了ターン（なければ-1）
+    UFUNCTION(BlueprintPure, Category = "Task Forecast")
+    int32 GetNextPredictedCompletionTurn() const;
+
+    // 予測完了ターンが早い順のタスクID（予測できないタスクは含めない）
+    UFUNCTION(BlueprintCallable, Category = "Task Forecast")
+    TArray<FString> GetTaskIdsByPredictedCompletion() const;
+
+    // 完了を予測する範囲（ターン数、これ以上かかるタスクは予測なし）
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Task Forecast", meta = (ClampMin = "1"))
+    int32 ForecastHorizonTurns = 86400;
+
     // === リソース監視・判定 ===
 
     // リソース要件チェック
     UFUNCTION(BlueprintCallable, Category = "Resource")
     bool CheckResourceRequirements(const FTeamTask& Task) const;
 
-    // 総リソース量取得
+    // 総リソース量取得（拠点倉庫 + 全チーム所持、資源台帳からO(1)）
     UFUNCTION(BlueprintCallable, Category = "Resource")
     int32 GetTotalResourceAmount(const FString& ResourceId) const;
+    int32 GetTotalResourceAmount(FSimItemId ResourceId) const;
 
     // リソース条件満たすかチェック（GlobalTask用）
     UFUNCTION(BlueprintCallable, Category = "Resource")
@@ -155,6 +254,10 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Setup")
     void SetTeamComponentReference(UTeamComponent* TeamComponent);
 
+    // 生産レシピ参照設定
+    UFUNCTION(BlueprintCallable, Category = "Setup")
+    void SetCraftingComponentReference(UCraftingComponent* CraftingComponent);
+
     // === 採集継続判定機能 ===
 
     // 採集継続判定（特定チームが特定アイテムの採集を継続すべきか）
@@ -195,10 +298,21 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Gathering")
     int32 CalculateGatheringAmount(int32 TeamIndex, const FString& ItemId, const FString& LocationId) const;
 
-    // 実際の採集処理を実行
+    // 実際の採集処理を実行（採集ステージ中は予約のみ行い、ステージ終了時にまとめて反映）
+    // ステージ中の戻り値は予約できたか（メンバーの誰かが1個以上持てるか）で、同じステージの予約分は考慮しない
     UFUNCTION(BlueprintCallable, Category = "Gathering")
     bool ExecuteGathering(int32 TeamIndex, const FString& ItemId, const FString& LocationId);
 
+    // === 採集ステージ（ターン単位の一括採集） ===
+
+    // 採集ステージを開始（TimeManagerのコミットフェーズ開始時に呼ぶ）
+    void BeginGatheringStage();
+
+    // 予約された採集をまとめて反映し、採集した総数を返す
+    int32 EndGatheringStage();
+
+    bool IsGatheringStageOpen() const { return bGatheringStageOpen; }
+
     // === ユーティリティ ===
 
     // タスクの有効性チェック
@@ -270,6 +384,59 @@ private:
     // 安全な配列アクセス
     bool IsValidArrayAccess(int32 Index) const;
 
+    // タスクインデックス再構築（GlobalTasksの追加・削除・優先度変更後に呼ぶ）
+    void RebuildTaskIndex();
+
+    // タスクの内容変更を判定キャッシュに知らせる
+    void MarkTasksChanged() { ++TaskSetVersion; }
+
+    // 判定キャッシュのキーとなる現在のバージョン（資源台帳が使えない場合はfalse）
+    bool GetTeamDecisionVersions(FTeamDecisionVersions& OutVersions) const;
+
+    // === タスク要件 ===
+
+    // タスク1回分の原材料要件（レシピがあればレシピグラフの展開、なければタスクタイプ別の既定値）
+    TArray<FRecipeMaterial> GetTaskMaterialRequirements(const FGlobalTask& Task) const;
+
+    // レシピグラフの変更番号（生産レシピ未設定時は0）
+    uint32 GetRecipeGraphVersion() const;
+
+    // 全タスクの要件から判定キャッシュの監視対象資源を作り直す
+    void RefreshDecisionResourceIds() const;
+
+    // === 完了予測 ===
+
+    // タスク集合・チーム状態が変わった、または予測ターンを過ぎても未達成のタスクがあれば予測を作り直す
+    void RefreshTaskForecasts() const;
+
+    // 予測結果（タスクID → 現在からのターン数）を反映し、最も早い予測完了ターンを集計し直す
+    void ApplyTaskForecasts(const TMap<FString, int32>& TurnsByTask, int32 CurrentTurn) const;
+
+    // ターン時計の現在ターン（TimeManager未生成時は0）
+    int32 GetSimulationTurn() const;
+
+    // キャッシュを介さない目標アイテム判定
+    FString ResolveTargetItemForTeam(int32 TeamIndex, const FString& LocationId) const;
+
+    // === Keepタスクのしきい値監視 ===
+
+    // Keepタスクの監視を張り直す（タスク配列・目標数量の変更後）
+    void RefreshKeepTaskWatches();
+
+    void ClearKeepTaskWatches();
+
+    // Keepタスクの目標在庫が満たされているか（監視があればその状態、なければ在庫を集計して判定）
+    bool IsKeepTaskSatisfied(const FGlobalTask& Task) const;
+
+    // 監視中の在庫が目標数をまたいだ
+    void OnKeepThresholdCrossed(FSimItemId ItemId, bool bAtOrAbove);
+
+    // 一括割り当ての対象（未完了で未充足の採集タスク、優先度順）
+    void BuildAllocationCandidates(TArray<FTaskAllocationCandidate>& OutCandidates) const;
+
+    // 一括割り当ての対象（「全て」モードでメンバーがいるチーム）
+    void BuildAllocationTeams(TArray<FTaskAllocationTeam>& OutTeams) const;
+
     // ログ出力
     void LogTaskOperation(const FString& Operation, const FGlobalTask& Task) const;
 
@@ -288,6 +455,29 @@ private:
     FString FindMatchingCookingTask(int32 TeamIndex) const;
     FString FindMatchingCraftingTask(int32 TeamIndex) const;
 
+    // === 採集ステージ内部 ===
+
+    // 予約された採集（同じチーム・アイテム・場所の予約は回数にまとめる）
+    struct FGatheringRequest
+    {
+        int32 TeamIndex = INDEX_NONE;
+        FString ItemId;
+        FString LocationId;
+        int32 Count = 0;
+    };
+
+    // 採集要求の事前チェック（チーム・場所・アイテム）
+    bool ValidateGatheringRequest(int32 TeamIndex, const FString& ItemId, const FString& LocationId) const;
+
+    // チームの1回あたり採集量（メンバーの採集力合計から計算）
+    int32 CalculateTeamGatheringAmount(const FTeam& Team) const;
+
+    // 採集要求をまとめて反映（インベントリごとに一括追加、タスク進捗はアイテムごとに1回）
+    int32 ApplyGatheringRequests(const TArray<FGatheringRequest>& Requests);
+
+    bool bGatheringStageOpen = false;
+    TArray<FGatheringRequest> PendingGatheringRequests;
+
     // === 内部状態管理 ===
     
     // タスク処理中フラグ（再入防止）
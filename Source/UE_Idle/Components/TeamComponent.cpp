@@ -1,4 +1,5 @@
 #include "TeamComponent.h"
+#include "../UE_Idle.h"
 #include "../Actor/C_IdleCharacter.h"
 #include "../Managers/BattleSystemManager.h"
 #include "../Types/CharacterTypes.h"
@@ -7,6 +8,9 @@
 #include "CombatComponent.h"
 #include "LocationMovementComponent.h"
 #include "TaskManagerComponent.h"
+#include "TimeManagerComponent.h"
+#include "../Managers/SimulationReplayManager.h"
+#include "../Managers/ResourceLedgerManager.h"
 #include "Engine/World.h"
 #include "Kismet/GameplayStatics.h"
 
@@ -27,7 +31,7 @@ void UTeamComponent::BeginPlay()
 {
 	Super::BeginPlay();
 	
-	UE_LOG(LogTemp, Log, TEXT("TeamComponent: BeginPlay - Initialized"));
+	UE_LOG(LogIdleTask, Log, TEXT("TeamComponent: BeginPlay - Initialized"));
 }
 
 void UTeamComponent::BeginDestroy()
@@ -45,7 +49,7 @@ void UTeamComponent::BeginDestroy()
 	// タスクリストをクリア
 	TeamTasks.Empty();
 	
-	UE_LOG(LogTemp, Log, TEXT("TeamComponent: BeginDestroy - Cleaned up"));
+	UE_LOG(LogIdleTask, Log, TEXT("TeamComponent: BeginDestroy - Cleaned up"));
 	
 	Super::BeginDestroy();
 }
@@ -60,7 +64,7 @@ void UTeamComponent::AddCharacter(AC_IdleCharacter* IdleCharacter)
 		OnCharacterAdded.Broadcast(IdleCharacter);
 		OnCharacterListChanged.Broadcast();
 		
-		UE_LOG(LogTemp, Warning, TEXT("TeamComponent: Character added, broadcasting events"));
+		UE_LOG(LogIdleTask, Warning, TEXT("TeamComponent: Character added, broadcasting events"));
 	}
 }
 
@@ -79,7 +83,7 @@ bool UTeamComponent::RemoveCharacter(AC_IdleCharacter* IdleCharacter)
 			OnCharacterRemoved.Broadcast(IdleCharacter);
 			OnCharacterListChanged.Broadcast();
 			
-			UE_LOG(LogTemp, Warning, TEXT("TeamComponent: Character removed, broadcasting events"));
+			UE_LOG(LogIdleTask, Warning, TEXT("TeamComponent: Character removed, broadcasting events"));
 			return true;
 		}
 	}
@@ -108,12 +112,20 @@ int32 UTeamComponent::CreateTeam(const FString& TeamName)
 	// 新しいタスク管理データの初期化
 	FTeamTaskList EmptyTaskList;
 	TeamTasks.Add(EmptyTaskList);
+	++TeamStateVersion;
+	
+	// リプレイ記録
+	FIdleReplayCommand Command;
+	Command.CommandType = EIdleReplayCommandType::CreateTeam;
+	Command.TeamIndex = NewTeamIndex;
+	Command.Name = TeamName;
+	USimulationReplayManager::Record(this, Command);
 	
 	// イベント通知
 	OnTeamCreated.Broadcast(NewTeamIndex, TeamName);
 	OnTeamsUpdated.Broadcast();
 	
-	UE_LOG(LogTemp, Log, TEXT("CreateTeam: Created team '%s' at index %d"), *TeamName, NewTeamIndex);
+	UE_LOG(LogIdleTask, Log, TEXT("CreateTeam: Created team '%s' at index %d"), *TeamName, NewTeamIndex);
 	
 	return NewTeamIndex;
 }
@@ -124,6 +136,17 @@ bool UTeamComponent::DeleteTeam(int32 TeamIndex)
 	{
 		// チームメンバーを解放する
 		FTeam& Team = Teams[TeamIndex];
+		UResourceLedgerManager* Ledger = UResourceLedgerManager::Get(this);
+		if (Ledger)
+		{
+			for (AC_IdleCharacter* Member : Team.Members)
+			{
+				if (IsValid(Member))
+				{
+					Ledger->UnassignInventory(Member->GetInventoryComponent());
+				}
+			}
+		}
 		Team.Members.Empty();
 		
 		// TeamInventory削除済み
@@ -135,17 +158,38 @@ bool UTeamComponent::DeleteTeam(int32 TeamIndex)
 		}
 		
 		Teams.RemoveAt(TeamIndex);
+		++TeamStateVersion;
+		
+		// 予約済みイベントを取り消し、後ろのチームのイベントは番号を詰める
+		CancelCombatEndEvent(TeamIndex);
+		TMap<int32, int64> ShiftedCombatEndEvents;
+		for (const TPair<int32, int64>& Event : CombatEndEvents)
+		{
+			ShiftedCombatEndEvents.Add(Event.Key > TeamIndex ? Event.Key - 1 : Event.Key, Event.Value);
+		}
+		CombatEndEvents = MoveTemp(ShiftedCombatEndEvents);
+		
+		if (ULocationMovementComponent* MovementComp = GetMovementComponent())
+		{
+			MovementComp->RemoveTeam(TeamIndex);
+		}
+		
+		// 台帳のチーム別集計も詰める
+		if (Ledger)
+		{
+			Ledger->RemoveTeam(TeamIndex);
+		}
 		
 		// イベント通知
 		OnTeamDeleted.Broadcast(TeamIndex);
 		OnTeamsUpdated.Broadcast();
 		
-		UE_LOG(LogTemp, Log, TEXT("DeleteTeam: Deleted team at index %d"), TeamIndex);
+		UE_LOG(LogIdleTask, Log, TEXT("DeleteTeam: Deleted team at index %d"), TeamIndex);
 		
 		return true;
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("DeleteTeam: Invalid team index %d"), TeamIndex);
+	UE_LOG(LogIdleTask, Warning, TEXT("DeleteTeam: Invalid team index %d"), TeamIndex);
 	return false;
 }
 
@@ -161,9 +205,24 @@ bool UTeamComponent::AssignCharacterToTeam(AC_IdleCharacter* Character, int32 Te
 	
 	// 新しいチームに追加
 	Teams[TeamIndex].Members.Add(Character);
+	++TeamStateVersion;
+	
+	// メンバーの所持品をチームの資源集計に加える
+	if (UResourceLedgerManager* Ledger = UResourceLedgerManager::Get(this))
+	{
+		Ledger->AssignInventoryToTeam(Character->GetInventoryComponent(), TeamIndex);
+	}
+	
+	// リプレイ記録（キャラクターは安定IDで識別、名前は表示用）
+	FIdleReplayCommand Command;
+	Command.CommandType = EIdleReplayCommandType::AssignCharacterToTeam;
+	Command.TeamIndex = TeamIndex;
+	Command.Name = Character->GetName();
+	Command.CharacterId = Character->GetCharacterId();
+	USimulationReplayManager::Record(this, Command);
 	
 	// イベント通知
-	UE_LOG(LogTemp, Log, TEXT("Character assigned to Team %d (%s)"), TeamIndex, *Teams[TeamIndex].TeamName);
+	UE_LOG(LogIdleTask, Log, TEXT("Character assigned to Team %d (%s)"), TeamIndex, *Teams[TeamIndex].TeamName);
 	OnMemberAssigned.Broadcast(TeamIndex, Character, Teams[TeamIndex].TeamName);
 	OnTeamsUpdated.Broadcast();
 	OnCharacterDataChanged.Broadcast(Character);  // Cardの更新をトリガー
@@ -181,6 +240,13 @@ bool UTeamComponent::RemoveCharacterFromTeam(AC_IdleCharacter* Character, int32
 	bool bRemoved = Teams[TeamIndex].Members.Remove(Character) > 0;
 	if (bRemoved)
 	{
+		++TeamStateVersion;
+		
+		if (UResourceLedgerManager* Ledger = UResourceLedgerManager::Get(this))
+		{
+			Ledger->UnassignInventory(Character->GetInventoryComponent());
+		}
+		
 		// イベント通知
 		OnMemberRemoved.Broadcast(TeamIndex, Character);
 		OnTeamsUpdated.Broadcast();
@@ -221,6 +287,14 @@ bool UTeamComponent::SetTeamTask(int32 TeamIndex, ETaskType NewTask)
 	if (Teams.IsValidIndex(TeamIndex))
 	{
 		Teams[TeamIndex].AssignedTask = NewTask;
+		++TeamStateVersion;
+		
+		// リプレイ記録
+		FIdleReplayCommand Command;
+		Command.CommandType = EIdleReplayCommandType::SetTeamTask;
+		Command.TeamIndex = TeamIndex;
+		Command.TaskType = NewTask;
+		USimulationReplayManager::Record(this, Command);
 		
 		// 冒険以外のタスクに変更する場合は場所をクリア
 		if (NewTask != ETaskType::Adventure)
@@ -237,7 +311,7 @@ bool UTeamComponent::SetTeamTask(int32 TeamIndex, ETaskType NewTask)
 		OnTaskChanged.Broadcast(TeamIndex, NewTask);
 		OnTeamsUpdated.Broadcast();
 		
-		UE_LOG(LogTemp, Log, TEXT("🎯 SetTeamTask: Team %d task updated to %d, strategies reevaluated"), 
+		UE_LOG(LogIdleTask, Log, TEXT("🎯 SetTeamTask: Team %d task updated to %d, strategies reevaluated"), 
 			TeamIndex, (int32)NewTask);
 		
 		return true;
@@ -272,7 +346,7 @@ bool UTeamComponent::SetTeamAdventureLocation(int32 TeamIndex, const FString& Lo
 	
 	OnTeamsUpdated.Broadcast();
 	
-	UE_LOG(LogTemp, Log, TEXT("Team %d adventure location set to: %s"), TeamIndex, *LocationId);
+	UE_LOG(LogIdleTask, Log, TEXT("Team %d adventure location set to: %s"), TeamIndex, *LocationId);
 	return true;
 }
 
@@ -280,7 +354,7 @@ bool UTeamComponent::StartAdventure(int32 TeamIndex, const FString& LocationId)
 {
 	if (!Teams.IsValidIndex(TeamIndex))
 	{
-		UE_LOG(LogTemp, Error, TEXT("StartAdventure: Invalid team index %d"), TeamIndex);
+		UE_LOG(LogIdleTask, Error, TEXT("StartAdventure: Invalid team index %d"), TeamIndex);
 		return false;
 	}
 
@@ -289,14 +363,14 @@ bool UTeamComponent::StartAdventure(int32 TeamIndex, const FString& LocationId)
 	// チームメンバーがいるかチェック
 	if (Team.Members.Num() == 0)
 	{
-		UE_LOG(LogTemp, Error, TEXT("StartAdventure: Team %d has no members"), TeamIndex);
+		UE_LOG(LogIdleTask, Error, TEXT("StartAdventure: Team %d has no members"), TeamIndex);
 		return false;
 	}
 
 	// 既に戦闘中かチェック
 	if (Team.bInCombat)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("StartAdventure: Team %d is already in combat"), TeamIndex);
+		UE_LOG(LogIdleTask, Warning, TEXT("StartAdventure: Team %d is already in combat"), TeamIndex);
 		return false;
 	}
 
@@ -315,13 +389,13 @@ bool UTeamComponent::StartAdventure(int32 TeamIndex, const FString& LocationId)
 			{
 				// イベントトリガーに失敗した場合はフラグをリセット
 				Team.bInCombat = false;
-				UE_LOG(LogTemp, Error, TEXT("StartAdventure: Failed to trigger combat event for team %d"), TeamIndex);
+				UE_LOG(LogIdleTask, Error, TEXT("StartAdventure: Failed to trigger combat event for team %d"), TeamIndex);
 				return false;
 			}
 		}
 		else
 		{
-			UE_LOG(LogTemp, Error, TEXT("StartAdventure: BattleSystemManager not found"));
+			UE_LOG(LogIdleTask, Error, TEXT("StartAdventure: BattleSystemManager not found"));
 			Team.bInCombat = false;
 			return false;
 		}
@@ -331,7 +405,7 @@ bool UTeamComponent::StartAdventure(int32 TeamIndex, const FString& LocationId)
 	OnTaskChanged.Broadcast(TeamIndex, ETaskType::Adventure);
 	OnTeamsUpdated.Broadcast();
 
-	UE_LOG(LogTemp, Log, TEXT("Adventure started for team %d at location %s with %d members"), 
+	UE_LOG(LogIdleTask, Log, TEXT("Adventure started for team %d at location %s with %d members"), 
 		TeamIndex, *LocationId, Team.Members.Num());
 	
 	return true;
@@ -367,7 +441,7 @@ bool UTeamComponent::SetTeamGatheringLocation(int32 TeamIndex, const FString& Lo
 	
 	OnTeamsUpdated.Broadcast();
 	
-	UE_LOG(LogTemp, Log, TEXT("Team %d gathering location set to: %s"), TeamIndex, *LocationId);
+	UE_LOG(LogIdleTask, Log, TEXT("Team %d gathering location set to: %s"), TeamIndex, *LocationId);
 	return true;
 }
 
@@ -375,7 +449,7 @@ bool UTeamComponent::StartGathering(int32 TeamIndex, const FString& LocationId)
 {
 	if (!Teams.IsValidIndex(TeamIndex))
 	{
-		UE_LOG(LogTemp, Error, TEXT("StartGathering: Invalid team index %d"), TeamIndex);
+		UE_LOG(LogIdleTask, Error, TEXT("StartGathering: Invalid team index %d"), TeamIndex);
 		return false;
 	}
 
@@ -384,14 +458,14 @@ bool UTeamComponent::StartGathering(int32 TeamIndex, const FString& LocationId)
 	// チームメンバーがいるかチェック
 	if (Team.Members.Num() == 0)
 	{
-		UE_LOG(LogTemp, Error, TEXT("StartGathering: Team %d has no members"), TeamIndex);
+		UE_LOG(LogIdleTask, Error, TEXT("StartGathering: Team %d has no members"), TeamIndex);
 		return false;
 	}
 
 	// 既に戦闘中かチェック
 	if (Team.bInCombat)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("StartGathering: Team %d is in combat, cannot start gathering"), TeamIndex);
+		UE_LOG(LogIdleTask, Warning, TEXT("StartGathering: Team %d is in combat, cannot start gathering"), TeamIndex);
 		return false;
 	}
 
@@ -403,7 +477,7 @@ bool UTeamComponent::StartGathering(int32 TeamIndex, const FString& LocationId)
 	OnTaskChanged.Broadcast(TeamIndex, ETaskType::Gathering);
 	OnTeamsUpdated.Broadcast();
 
-	UE_LOG(LogTemp, Log, TEXT("Gathering task started for team %d at location %s with %d members"), 
+	UE_LOG(LogIdleTask, Log, TEXT("Gathering task started for team %d at location %s with %d members"), 
 		TeamIndex, *LocationId, Team.Members.Num());
 	
 	return true;
@@ -432,6 +506,7 @@ bool UTeamComponent::SetTeamName(int32 TeamIndex, const FString& NewTeamName)
 	if (Teams.IsValidIndex(TeamIndex))
 	{
 		Teams[TeamIndex].TeamName = NewTeamName;
+		++TeamStateVersion;  // 空の名前はIsValidTeamに影響する
 		
 		// イベント通知
 		OnTeamNameChanged.Broadcast(TeamIndex, NewTeamName);
@@ -539,13 +614,20 @@ void UTeamComponent::RemoveCharacterFromAllTeams(AC_IdleCharacter* Character)
 	// キャラクターが実際に削除された場合はイベント発信
 	if (bWasRemoved && Character)
 	{
+		++TeamStateVersion;
+		
+		if (UResourceLedgerManager* Ledger = UResourceLedgerManager::Get(this))
+		{
+			Ledger->UnassignInventory(Character->GetInventoryComponent());
+		}
+		
 		OnCharacterDataChanged.Broadcast(Character);  // Cardの更新をトリガー
 	}
 }
 
 void UTeamComponent::OnCombatEnd(const TArray<AC_IdleCharacter*>& Winners, const TArray<AC_IdleCharacter*>& Losers)
 {
-	UE_LOG(LogTemp, Log, TEXT("OnCombatEnd called with %d winners and %d losers"), Winners.Num(), Losers.Num());
+	UE_LOG(LogIdleTask, Log, TEXT("OnCombatEnd called with %d winners and %d losers"), Winners.Num(), Losers.Num());
 	
 	// 勝者側と敗者側の両方のチームのbInCombatフラグをリセット
 	TSet<int32> ProcessedTeams;
@@ -562,7 +644,8 @@ void UTeamComponent::OnCombatEnd(const TArray<AC_IdleCharacter*>& Winners, const
 				{
 					Teams[TeamIndex].bInCombat = false;
 					ProcessedTeams.Add(TeamIndex);
-					UE_LOG(LogTemp, Log, TEXT("Reset bInCombat flag for team %d (%s) - Winner"), 
+					CancelCombatEndEvent(TeamIndex);
+					UE_LOG(LogIdleTask, Log, TEXT("Reset bInCombat flag for team %d (%s) - Winner"), 
 						TeamIndex, *Teams[TeamIndex].TeamName);
 				}
 			}
@@ -581,7 +664,8 @@ void UTeamComponent::OnCombatEnd(const TArray<AC_IdleCharacter*>& Winners, const
 				{
 					Teams[TeamIndex].bInCombat = false;
 					ProcessedTeams.Add(TeamIndex);
-					UE_LOG(LogTemp, Log, TEXT("Reset bInCombat flag for team %d (%s) - Loser"), 
+					CancelCombatEndEvent(TeamIndex);
+					UE_LOG(LogIdleTask, Log, TEXT("Reset bInCombat flag for team %d (%s) - Loser"), 
 						TeamIndex, *Teams[TeamIndex].TeamName);
 				}
 			}
@@ -609,7 +693,7 @@ bool UTeamComponent::AddTeamTask(int32 TeamIndex, const FTeamTask& NewTask)
 {
 	if (!IsValidTeamIndex(TeamIndex))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("AddTeamTask: Invalid team index %d"), TeamIndex);
+		UE_LOG(LogIdleTask, Warning, TEXT("AddTeamTask: Invalid team index %d"), TeamIndex);
 		return false;
 	}
 
@@ -624,13 +708,13 @@ bool UTeamComponent::AddTeamTask(int32 TeamIndex, const FTeamTask& NewTask)
 
 	if (TaskList.Num() >= MaxTeamTasks)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("AddTeamTask: Team %d has reached maximum task limit (%d)"), TeamIndex, MaxTeamTasks);
+		UE_LOG(LogIdleTask, Warning, TEXT("AddTeamTask: Team %d has reached maximum task limit (%d)"), TeamIndex, MaxTeamTasks);
 		return false;
 	}
 
 	if (!NewTask.IsValid())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("AddTeamTask: Invalid task provided for team %d"), TeamIndex);
+		UE_LOG(LogIdleTask, Warning, TEXT("AddTeamTask: Invalid task provided for team %d"), TeamIndex);
 		return false;
 	}
 
@@ -639,19 +723,27 @@ bool UTeamComponent::AddTeamTask(int32 TeamIndex, const FTeamTask& NewTask)
 	{
 		if (ExistingTask.Priority == NewTask.Priority)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("AddTeamTask: Priority %d already exists in team %d"), NewTask.Priority, TeamIndex);
+			UE_LOG(LogIdleTask, Warning, TEXT("AddTeamTask: Priority %d already exists in team %d"), NewTask.Priority, TeamIndex);
 			return false;
 		}
 	}
 
 	TaskList.Add(NewTask);
+	++TeamStateVersion;
 	
-	UE_LOG(LogTemp, Log, TEXT("AddTeamTask: Added task with priority %d to team %d"), NewTask.Priority, TeamIndex);
+	// リプレイ記録
+	FIdleReplayCommand Command;
+	Command.CommandType = EIdleReplayCommandType::AddTeamTask;
+	Command.TeamIndex = TeamIndex;
+	Command.TeamTask = NewTask;
+	USimulationReplayManager::Record(this, Command);
+	
+	UE_LOG(LogIdleTask, Log, TEXT("AddTeamTask: Added task with priority %d to team %d"), NewTask.Priority, TeamIndex);
 	
 	// チームがアイドル状態の場合、即座にタスクを実行
 	if (Teams[TeamIndex].ActionState == ETeamActionState::Idle)
 	{
-		UE_LOG(LogTemp, Log, TEXT("AddTeamTask: Team %d is idle, attempting to execute new task"), TeamIndex);
+		UE_LOG(LogIdleTask, Log, TEXT("AddTeamTask: Team %d is idle, attempting to execute new task"), TeamIndex);
 		SwitchToNextAvailableTaskSafe(TeamIndex);
 	}
 	else
@@ -677,14 +769,22 @@ bool UTeamComponent::RemoveTeamTask(int32 TeamIndex, int32 TaskPriority)
 		{
 			FTeamTask RemovedTask = TaskList[i];
 			TaskList.RemoveAt(i);
+			++TeamStateVersion;
+			
+			// リプレイ記録
+			FIdleReplayCommand Command;
+			Command.CommandType = EIdleReplayCommandType::RemoveTeamTask;
+			Command.TeamIndex = TeamIndex;
+			Command.Index = TaskPriority;
+			USimulationReplayManager::Record(this, Command);
 			
-			UE_LOG(LogTemp, Log, TEXT("RemoveTeamTask: Removed task with priority %d from team %d"), TaskPriority, TeamIndex);
+			UE_LOG(LogIdleTask, Log, TEXT("RemoveTeamTask: Removed task with priority %d from team %d"), TaskPriority, TeamIndex);
 			
 			// タスクリストが空になった場合、チームをアイドル状態にリセット
 			if (TaskList.Num() == 0)
 			{
 				Teams[TeamIndex].AssignedTask = ETaskType::Idle;
-				UE_LOG(LogTemp, Log, TEXT("RemoveTeamTask: Team %d has no tasks, set to Idle"), TeamIndex);
+				UE_LOG(LogIdleTask, Log, TEXT("RemoveTeamTask: Team %d has no tasks, set to Idle"), TeamIndex);
 				OnTaskChanged.Broadcast(TeamIndex, ETaskType::Idle);
 			}
 			
@@ -694,7 +794,7 @@ bool UTeamComponent::RemoveTeamTask(int32 TeamIndex, int32 TaskPriority)
 		}
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("RemoveTeamTask: Task with priority %d not found in team %d"), TaskPriority, TeamIndex);
+	UE_LOG(LogIdleTask, Warning, TEXT("RemoveTeamTask: Task with priority %d not found in team %d"), TaskPriority, TeamIndex);
 	return false;
 }
 
@@ -735,7 +835,7 @@ bool UTeamComponent::SwitchToNextAvailableTask(int32 TeamIndex)
 {
 	if (bTaskSwitchProcessing)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("SwitchToNextAvailableTask: Already processing task switch for team %d"), TeamIndex);
+		UE_LOG(LogIdleTask, Warning, TEXT("SwitchToNextAvailableTask: Already processing task switch for team %d"), TeamIndex);
 		return false;
 	}
 
@@ -831,11 +931,11 @@ void UTeamComponent::ExecuteTask(int32 TeamIndex, const FTeamTask& Task)
 	if (Task.TaskType == ETaskType::Gathering)
 	{
 		// GatheringLocationIdは既にチーム作成時やUI操作で設定されているはず
-		UE_LOG(LogTemp, Log, TEXT("ExecuteTask: Gathering task for team %d with location %s"), 
+		UE_LOG(LogIdleTask, Log, TEXT("ExecuteTask: Gathering task for team %d with location %s"), 
 			TeamIndex, *Team.GatheringLocationId);
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("ExecuteTask: Team %d started executing %s task with priority %d"), 
+	UE_LOG(LogIdleTask, Log, TEXT("ExecuteTask: Team %d started executing %s task with priority %d"), 
 		TeamIndex, *UTaskTypeUtils::GetTaskTypeDisplayName(Task.TaskType), Task.Priority);
 	OnTeamTaskStarted.Broadcast(TeamIndex, Task);
 }
@@ -854,7 +954,7 @@ void UTeamComponent::SetTeamActionState(int32 TeamIndex, ETeamActionState NewSta
 
 	if (OldState != NewState)
 	{
-		UE_LOG(LogTemp, Log, TEXT("SetTeamActionState: Team %d state changed from %s to %s"), 
+		UE_LOG(LogIdleTask, Log, TEXT("SetTeamActionState: Team %d state changed from %s to %s"), 
 			   TeamIndex, *UTaskTypeUtils::GetActionStateDisplayName(OldState), *UTaskTypeUtils::GetActionStateDisplayName(NewState));
 		
 		OnTeamActionStateChanged.Broadcast(TeamIndex, NewState);
@@ -915,14 +1015,14 @@ bool UTeamComponent::IsCombatFinished(int32 TeamIndex) const
 	// 防御的プログラミング - 範囲チェック
 	if (!IsValidTeamIndex(TeamIndex))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("IsCombatFinished: Invalid TeamIndex %d"), TeamIndex);
+		UE_LOG(LogIdleTask, Warning, TEXT("IsCombatFinished: Invalid TeamIndex %d"), TeamIndex);
 		return false;
 	}
 	
 	// オブジェクト有効性チェック
 	if (!IsValid(this))
 	{
-		UE_LOG(LogTemp, Error, TEXT("IsCombatFinished: Invalid TeamComponent"));
+		UE_LOG(LogIdleTask, Error, TEXT("IsCombatFinished: Invalid TeamComponent"));
 		return false;
 	}
 	
@@ -945,8 +1045,45 @@ void UTeamComponent::StartCombat(int32 TeamIndex, float EstimatedDuration)
 
 	float CurrentTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
 	Teams[TeamIndex].StartCombatSafe(CurrentTime, EstimatedDuration);
+
+	// 推定終了ターンにウェイクアップイベントを予約（早送りがそのターンで止まるように）
+	// 戦闘の終了自体はCombatComponentの決着（OnCombatEnd / EndCombat）で行う
+	UTimeManagerComponent* TimeManager = UTimeManagerComponent::Get(this);
+	if (TimeManager && EstimatedDuration > 0.0f)
+	{
+		if (int64* ExistingEventId = CombatEndEvents.Find(TeamIndex))
+		{
+			TimeManager->CancelTurnEvent(*ExistingEventId);
+		}
+
+		// 発火時のチーム番号は予約時と異なりうるので、イベントIDから引き直す
+		TWeakObjectPtr<UTeamComponent> WeakThis(this);
+		TSharedRef<int64> ScheduledEventId = MakeShared<int64>(0);
+		const int64 EventId = TimeManager->ScheduleTurnEvent(
+			EIdleTimeEventType::CombatEnd, FMath::CeilToInt(EstimatedDuration),
+			[WeakThis, ScheduledEventId]()
+			{
+				if (!WeakThis.IsValid())
+				{
+					return;
+				}
+				const int32* FoundTeamIndex = WeakThis->CombatEndEvents.FindKey(*ScheduledEventId);
+				if (!FoundTeamIndex)
+				{
+					return;
+				}
+				const int32 CurrentTeamIndex = *FoundTeamIndex;
+				WeakThis->CombatEndEvents.Remove(CurrentTeamIndex);
+				if (WeakThis->IsValidTeamIndex(CurrentTeamIndex) && WeakThis->Teams[CurrentTeamIndex].IsInCombat())
+				{
+					UE_LOG(LogIdleTask, Verbose, TEXT("StartCombat: Team %d passed its estimated combat duration, still fighting"), CurrentTeamIndex);
+				}
+			});
+		*ScheduledEventId = EventId;
+		CombatEndEvents.Add(TeamIndex, EventId);
+	}
 	
-	UE_LOG(LogTemp, Log, TEXT("StartCombat: Team %d entered combat (Duration: %.1fs)"), TeamIndex, EstimatedDuration);
+	UE_LOG(LogIdleTask, Log, TEXT("StartCombat: Team %d entered combat (Duration: %.1fs)"), TeamIndex, EstimatedDuration);
 	OnTeamActionStateChanged.Broadcast(TeamIndex, ETeamActionState::InCombat);
 }
 
@@ -960,6 +1097,9 @@ void UTeamComponent::EndCombat(int32 TeamIndex)
 	
 	// 処理中フラグセット
 	bCombatEndProcessing = true;
+
+	// 予約済みの戦闘終了イベントを取り消し
+	CancelCombatEndEvent(TeamIndex);
 	
 	// 状態遷移
 	Teams[TeamIndex].EndCombatSafe();
@@ -973,11 +1113,23 @@ void UTeamComponent::EndCombat(int32 TeamIndex)
 			OnCombatEnded.Broadcast(TeamIndex);
 			bCombatEndProcessing = false;
 			
-			UE_LOG(LogTemp, Log, TEXT("EndCombat: Team %d combat ended safely"), TeamIndex);
+			UE_LOG(LogIdleTask, Log, TEXT("EndCombat: Team %d combat ended safely"), TeamIndex);
 		}
 	});
 }
 
+void UTeamComponent::CancelCombatEndEvent(int32 TeamIndex)
+{
+	int64 PendingEventId = 0;
+	if (CombatEndEvents.RemoveAndCopyValue(TeamIndex, PendingEventId))
+	{
+		if (UTimeManagerComponent* TimeManager = UTimeManagerComponent::Get(this))
+		{
+			TimeManager->CancelTurnEvent(PendingEventId);
+		}
+	}
+}
+
 ETeamCombatState UTeamComponent::GetCombatState(int32 TeamIndex) const
 {
 	if (IsValidTeamIndex(TeamIndex))
@@ -1003,7 +1155,7 @@ void UTeamComponent::SetTeamCombatState(int32 TeamIndex, ETeamCombatState NewSta
 	if (IsValidTeamIndex(TeamIndex))
 	{
 		Teams[TeamIndex].CombatState = NewState;
-		UE_LOG(LogTemp, VeryVerbose, TEXT("SetTeamCombatState: Team %d set to %s"), 
+		UE_LOG(LogIdleTask, VeryVerbose, TEXT("SetTeamCombatState: Team %d set to %s"), 
 			TeamIndex, *UEnum::GetValueAsString(NewState));
 	}
 }
@@ -1036,18 +1188,18 @@ ULocationMovementComponent* UTeamComponent::GetMovementComponent() const
 // 委譲メソッド実装
 bool UTeamComponent::ExecuteMovement(int32 TeamIndex, const FString& TargetLocation)
 {
-	UE_LOG(LogTemp, Log, TEXT("🚶 TeamComponent: Delegating movement to %s for team %d"), *TargetLocation, TeamIndex);
+	UE_LOG(LogIdleTask, Log, TEXT("🚶 TeamComponent: Delegating movement to %s for team %d"), *TargetLocation, TeamIndex);
 	
 	if (!IsValidTeamIndex(TeamIndex) || TargetLocation.IsEmpty())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("❌ Invalid movement parameters"));
+		UE_LOG(LogIdleTask, Warning, TEXT("❌ Invalid movement parameters"));
 		return false;
 	}
 	
 	ULocationMovementComponent* MovementComp = GetMovementComponent();
 	if (!MovementComp)
 	{
-		UE_LOG(LogTemp, Error, TEXT("❌ MovementComponent not found"));
+		UE_LOG(LogIdleTask, Error, TEXT("❌ MovementComponent not found"));
 		return false;
 	}
 	
@@ -1082,12 +1234,12 @@ bool UTeamComponent::ExecuteMovement(int32 TeamIndex, const FString& TargetLocat
 		CurrentLocation = TEXT("base");
 	}
 	
-	UE_LOG(LogTemp, Log, TEXT("🗺️ Team %d current location: %s (distance: %.1f)"), TeamIndex, *CurrentLocation, CurrentDistance);
+	UE_LOG(LogIdleTask, Log, TEXT("🗺️ Team %d current location: %s (distance: %.1f)"), TeamIndex, *CurrentLocation, CurrentDistance);
 	
 	// 既に目的地にいるかチェック
 	if (CurrentLocation == TargetLocation)
 	{
-		UE_LOG(LogTemp, Log, TEXT("🏁 Team %d is already at %s, skipping movement"), TeamIndex, *TargetLocation);
+		UE_LOG(LogIdleTask, Log, TEXT("🏁 Team %d is already at %s, skipping movement"), TeamIndex, *TargetLocation);
 		SetTeamActionState(TeamIndex, ETeamActionState::Working);
 		return true;
 	}
@@ -1096,7 +1248,7 @@ bool UTeamComponent::ExecuteMovement(int32 TeamIndex, const FString& TargetLocat
 	bool bMovementStarted = MovementComp->StartMovement(TeamIndex, CurrentLocation, TargetLocation);
 	if (!bMovementStarted)
 	{
-		UE_LOG(LogTemp, Error, TEXT("❌ Failed to start movement for team %d"), TeamIndex);
+		UE_LOG(LogIdleTask, Error, TEXT("❌ Failed to start movement for team %d"), TeamIndex);
 		return false;
 	}
 	
@@ -1107,7 +1259,7 @@ bool UTeamComponent::ExecuteMovement(int32 TeamIndex, const FString& TargetLocat
 	FTeam& Team = Teams[TeamIndex];
 	if (TargetLocation == TEXT("base") && Team.ActionState == ETeamActionState::Returning)
 	{
-		UE_LOG(LogTemp, Log, TEXT("🏠 Team %d continuing return to base, keeping Returning state"), TeamIndex);
+		UE_LOG(LogIdleTask, Log, TEXT("🏠 Team %d continuing return to base, keeping Returning state"), TeamIndex);
 		// Returning状態を保持
 	}
 	else
@@ -1115,17 +1267,17 @@ bool UTeamComponent::ExecuteMovement(int32 TeamIndex, const FString& TargetLocat
 		SetTeamActionState(TeamIndex, ETeamActionState::Moving);
 	}
 	
-	UE_LOG(LogTemp, Log, TEXT("✅ Movement initiated to %s"), *TargetLocation);
+	UE_LOG(LogIdleTask, Log, TEXT("✅ Movement initiated to %s"), *TargetLocation);
 	return true;
 }
 
 bool UTeamComponent::ExecuteGathering(int32 TeamIndex, const FString& TargetItem)
 {
-	UE_LOG(LogTemp, Log, TEXT("🌾 TeamComponent: Delegating gathering of %s for team %d"), *TargetItem, TeamIndex);
+	UE_LOG(LogIdleTask, Verbose, TEXT("🌾 TeamComponent: Delegating gathering of %s for team %d"), *TargetItem, TeamIndex);
 	
 	if (!IsValidTeamIndex(TeamIndex) || TargetItem.IsEmpty())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("❌ Invalid gathering parameters"));
+		UE_LOG(LogIdleTask, Warning, TEXT("❌ Invalid gathering parameters"));
 		return false;
 	}
 	
@@ -1137,7 +1289,7 @@ bool UTeamComponent::ExecuteGathering(int32 TeamIndex, const FString& TargetItem
 	}
 	if (!TaskManager)
 	{
-		UE_LOG(LogTemp, Error, TEXT("❌ TaskManager not found"));
+		UE_LOG(LogIdleTask, Error, TEXT("❌ TaskManager not found"));
 		return false;
 	}
 	
@@ -1170,38 +1322,38 @@ bool UTeamComponent::ExecuteGathering(int32 TeamIndex, const FString& TargetItem
 		}
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("🌾 ExecuteGathering: Team %d at location %s"), TeamIndex, *CurrentLocation);
+	UE_LOG(LogIdleTask, Verbose, TEXT("🌾 ExecuteGathering: Team %d at location %s"), TeamIndex, *CurrentLocation);
 	
 	// TaskManagerで採集実行（シンプル化）
 	bool bSuccess = TaskManager->ExecuteGathering(TeamIndex, TargetItem, CurrentLocation);
 	if (bSuccess)
 	{
 		SetTeamActionState(TeamIndex, ETeamActionState::Working);
-		UE_LOG(LogTemp, VeryVerbose, TEXT("🌾 ExecuteGathering: Team %d gathering %s at %s"), TeamIndex, *TargetItem, *CurrentLocation);
+		UE_LOG(LogIdleTask, VeryVerbose, TEXT("🌾 ExecuteGathering: Team %d gathering %s at %s"), TeamIndex, *TargetItem, *CurrentLocation);
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("🌾 ExecuteGathering: Failed to execute gathering for team %d"), TeamIndex);
+		UE_LOG(LogIdleTask, Warning, TEXT("🌾 ExecuteGathering: Failed to execute gathering for team %d"), TeamIndex);
 	}
 	
-	UE_LOG(LogTemp, Log, TEXT("✅ Gathering initiated for %s"), *TargetItem);
+	UE_LOG(LogIdleTask, Log, TEXT("✅ Gathering initiated for %s"), *TargetItem);
 	return true;
 }
 
 bool UTeamComponent::ExecuteCombat(int32 TeamIndex, const FString& TargetLocation)
 {
-	UE_LOG(LogTemp, Log, TEXT("⚔️ TeamComponent: Delegating combat at %s for team %d"), *TargetLocation, TeamIndex);
+	UE_LOG(LogIdleTask, Log, TEXT("⚔️ TeamComponent: Delegating combat at %s for team %d"), *TargetLocation, TeamIndex);
 	
 	if (!IsValidTeamIndex(TeamIndex))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("❌ Invalid combat parameters"));
+		UE_LOG(LogIdleTask, Warning, TEXT("❌ Invalid combat parameters"));
 		return false;
 	}
 	
 	UCombatComponent* CombatComp = GetCombatComponent();
 	if (!CombatComp)
 	{
-		UE_LOG(LogTemp, Error, TEXT("❌ CombatComponent not found"));
+		UE_LOG(LogIdleTask, Error, TEXT("❌ CombatComponent not found"));
 		return false;
 	}
 	
@@ -1217,12 +1369,12 @@ bool UTeamComponent::ExecuteCombat(int32 TeamIndex, const FString& TargetLocatio
 		if (bCombatStarted)
 		{
 			SetTeamActionState(TeamIndex, ETeamActionState::InCombat);
-			UE_LOG(LogTemp, Log, TEXT("✅ Combat started for team %d"), TeamIndex);
+			UE_LOG(LogIdleTask, Log, TEXT("✅ Combat started for team %d"), TeamIndex);
 			return true;
 		}
 		else
 		{
-			UE_LOG(LogTemp, Warning, TEXT("❌ Failed to start combat for team %d"), TeamIndex);
+			UE_LOG(LogIdleTask, Warning, TEXT("❌ Failed to start combat for team %d"), TeamIndex);
 			return false;
 		}
 	}
@@ -1230,35 +1382,59 @@ bool UTeamComponent::ExecuteCombat(int32 TeamIndex, const FString& TargetLocatio
 	{
 		// 戦闘継続中 - CombatComponent::ProcessCombat()で1ターン処理
 		CombatComp->ProcessCombat(0.0f);
-		UE_LOG(LogTemp, VeryVerbose, TEXT("⚔️ Processing combat turn for team %d"), TeamIndex);
+		UE_LOG(LogIdleTask, VeryVerbose, TEXT("⚔️ Processing combat turn for team %d"), TeamIndex);
 		return true;
 	}
 }
 
 bool UTeamComponent::ExecuteUnload(int32 TeamIndex)
 {
-	UE_LOG(LogTemp, Log, TEXT("📦 TeamComponent: Delegating unload for team %d"), TeamIndex);
+	UE_LOG(LogIdleTask, Log, TEXT("📦 TeamComponent: Delegating unload for team %d"), TeamIndex);
 	
 	if (!IsValidTeamIndex(TeamIndex))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("❌ Invalid unload parameters"));
+		UE_LOG(LogIdleTask, Warning, TEXT("❌ Invalid unload parameters"));
 		return false;
 	}
 	
-	// TODO: TimeManagerのAutoUnloadResourceItems()ロジックを委譲
-	// 一時的な実装：処理完了フラグ
-	UE_LOG(LogTemp, Log, TEXT("✅ Unload completed for team %d"), TeamIndex);
-	return true;
+	AC_PlayerController* PlayerController = Cast<AC_PlayerController>(GetOwner());
+	UInventoryComponent* Storage = PlayerController ? PlayerController->GlobalInventory.Get() : nullptr;
+	if (!Storage)
+	{
+		UE_LOG(LogIdleTask, Warning, TEXT("❌ Unload failed for team %d: storage not found"), TeamIndex);
+		return false;
+	}
+	
+	// メンバーごとに全所持品を一括転送（メンバー単位で全量か無しか）
+	bool bAllUnloaded = true;
+	for (AC_IdleCharacter* Member : Teams[TeamIndex].Members)
+	{
+		UInventoryComponent* MemberInventory = IsValid(Member) ? Member->GetInventoryComponent() : nullptr;
+		if (!MemberInventory)
+		{
+			continue;
+		}
+		
+		const TMap<FString, int32> Carried = MemberInventory->GetTransferableItems();
+		if (Carried.Num() > 0 && !MemberInventory->TransferMany(Storage, Carried))
+		{
+			UE_LOG(LogIdleTask, Warning, TEXT("⚠️ Team %d: %s could not unload (storage full)"), TeamIndex, *Member->GetName());
+			bAllUnloaded = false;
+		}
+	}
+	
+	UE_LOG(LogIdleTask, Log, TEXT("✅ Unload %s for team %d"), bAllUnloaded ? TEXT("completed") : TEXT("partially completed"), TeamIndex);
+	return bAllUnloaded;
 }
 
 // メインの実行メソッド
 bool UTeamComponent::ExecutePlan(const FTaskExecutionPlan& Plan, int32 TeamIndex)
 {
-	UE_LOG(LogTemp, Log, TEXT("📋 TeamComponent: Executing plan for team %d - %s"), TeamIndex, *Plan.ExecutionReason);
+	UE_LOG(LogIdleTask, Log, TEXT("📋 TeamComponent: Executing plan for team %d - %s"), TeamIndex, *Plan.ExecutionReason);
 	
 	if (!Plan.bIsValid)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("❌ Invalid execution plan"));
+		UE_LOG(LogIdleTask, Warning, TEXT("❌ Invalid execution plan"));
 		return false;
 	}
 	
@@ -1285,7 +1461,7 @@ bool UTeamComponent::ExecutePlan(const FTaskExecutionPlan& Plan, int32 TeamIndex
 			
 		case ETaskExecutionAction::None:
 		default:
-			UE_LOG(LogTemp, Warning, TEXT("❌ Unsupported execution action: %d"), (int32)Plan.ExecutionAction);
+			UE_LOG(LogIdleTask, Warning, TEXT("❌ Unsupported execution action: %d"), (int32)Plan.ExecutionAction);
 			SetToIdle(TeamIndex);
 			return false;
 	}
@@ -1293,7 +1469,7 @@ bool UTeamComponent::ExecutePlan(const FTaskExecutionPlan& Plan, int32 TeamIndex
 
 void UTeamComponent::SetToIdle(int32 TeamIndex)
 {
-	UE_LOG(LogTemp, Log, TEXT("💤 TeamComponent: Setting team %d to idle"), TeamIndex);
+	UE_LOG(LogIdleTask, Log, TEXT("💤 TeamComponent: Setting team %d to idle"), TeamIndex);
 	
 	if (IsValidTeamIndex(TeamIndex))
 	{
@@ -1307,7 +1483,7 @@ void UTeamComponent::SetTeamActionStateInternal(int32 TeamIndex, ETeamActionStat
 {
 	if (!Teams.IsValidIndex(TeamIndex))
 	{
-		UE_LOG(LogTemp, Error, TEXT("SetTeamActionStateInternal: Invalid team index %d"), TeamIndex);
+		UE_LOG(LogIdleTask, Error, TEXT("SetTeamActionStateInternal: Invalid team index %d"), TeamIndex);
 		return;
 	}
 	
@@ -1329,14 +1505,14 @@ FTeamStrategy UTeamComponent::GetTeamStrategy(int32 TeamIndex) const
 	// チームインデックスの有効性チェック
 	if (!IsValidTeamIndex(TeamIndex))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("🧠👥 GetTeamStrategy: Invalid team index %d"), TeamIndex);
+		UE_LOG(LogIdleTask, Warning, TEXT("🧠👥 GetTeamStrategy: Invalid team index %d"), TeamIndex);
 		return FTeamStrategy(); // デフォルト戦略
 	}
 
 	// 戦略が存在するかチェック
 	if (!TeamStrategies.IsValidIndex(TeamIndex))
 	{
-		UE_LOG(LogTemp, VeryVerbose, TEXT("🧠👥 GetTeamStrategy: No strategy found for team %d, generating default"), TeamIndex);
+		UE_LOG(LogIdleTask, VeryVerbose, TEXT("🧠👥 GetTeamStrategy: No strategy found for team %d, generating default"), TeamIndex);
 		
 		// デフォルト戦略を生成
 		FTeamStrategy DefaultStrategy;
@@ -1354,7 +1530,7 @@ FTeamStrategy UTeamComponent::GetTeamStrategy(int32 TeamIndex) const
 		float TimeSinceUpdate = CurrentTime - StrategyUpdateTimes[TeamIndex];
 		if (TimeSinceUpdate > TeamStrategies[TeamIndex].ValidDuration)
 		{
-			UE_LOG(LogTemp, VeryVerbose, TEXT("🧠👥 GetTeamStrategy: Strategy for team %d expired, needs update"), TeamIndex);
+			UE_LOG(LogIdleTask, VeryVerbose, TEXT("🧠👥 GetTeamStrategy: Strategy for team %d expired, needs update"), TeamIndex);
 		}
 	}
 
@@ -1367,7 +1543,7 @@ FTeamInfo UTeamComponent::GetTeamInfoForCharacter(AC_IdleCharacter* Character) c
 
 	if (!IsValid(Character))
 	{
-		UE_LOG(LogTemp, Error, TEXT("🧠👥 GetTeamInfoForCharacter: Invalid character"));
+		UE_LOG(LogIdleTask, Error, TEXT("🧠👥 GetTeamInfoForCharacter: Invalid character"));
 		return TeamInfo;
 	}
 
@@ -1384,7 +1560,7 @@ FTeamInfo UTeamComponent::GetTeamInfoForCharacter(AC_IdleCharacter* Character) c
 
 	if (CharacterTeamIndex == -1)
 	{
-		UE_LOG(LogTemp, VeryVerbose, TEXT("🧠👥 GetTeamInfoForCharacter: Character %s not in any team"), 
+		UE_LOG(LogIdleTask, VeryVerbose, TEXT("🧠👥 GetTeamInfoForCharacter: Character %s not in any team"), 
 			*Character->GetCharacterName());
 		return TeamInfo; // デフォルト値（チーム未所属）
 	}
@@ -1435,7 +1611,7 @@ FTeamInfo UTeamComponent::GetTeamInfoForCharacter(AC_IdleCharacter* Character) c
 		TeamInfo.CoordinationMessage = TEXT("Team coordination recommended for current task");
 	}
 
-	UE_LOG(LogTemp, VeryVerbose, TEXT("🧠👥 GetTeamInfoForCharacter: Generated info for %s in team %d (%s)"), 
+	UE_LOG(LogIdleTask, VeryVerbose, TEXT("🧠👥 GetTeamInfoForCharacter: Generated info for %s in team %d (%s)"), 
 		*Character->GetCharacterName(), CharacterTeamIndex, *Team.TeamName);
 
 	return TeamInfo;
@@ -1445,7 +1621,7 @@ bool UTeamComponent::CoordinateWithTeammates(AC_IdleCharacter* Character, const
 {
 	if (!IsValid(Character))
 	{
-		UE_LOG(LogTemp, Error, TEXT("🧠👥 CoordinateWithTeammates: Invalid character"));
+		UE_LOG(LogIdleTask, Error, TEXT("🧠👥 CoordinateWithTeammates: Invalid character"));
 		return false;
 	}
 
@@ -1462,7 +1638,7 @@ bool UTeamComponent::CoordinateWithTeammates(AC_IdleCharacter* Character, const
 
 	if (TeamIndex == -1)
 	{
-		UE_LOG(LogTemp, VeryVerbose, TEXT("🧠👥 CoordinateWithTeammates: Character %s not in any team, no coordination needed"), 
+		UE_LOG(LogIdleTask, VeryVerbose, TEXT("🧠👥 CoordinateWithTeammates: Character %s not in any team, no coordination needed"), 
 			*Character->GetCharacterName());
 		return true; // チーム未所属なら調整不要
 	}
@@ -1483,7 +1659,7 @@ bool UTeamComponent::CoordinateWithTeammates(AC_IdleCharacter* Character, const
 	{
 		// 同じアイテムを複数人で採集しようとしていないかチェック
 		// 現在は許可（実際の採集処理で調整される）
-		UE_LOG(LogTemp, VeryVerbose, TEXT("🧠👥 CoordinateWithTeammates: %s gathering %s - approved"), 
+		UE_LOG(LogIdleTask, VeryVerbose, TEXT("🧠👥 CoordinateWithTeammates: %s gathering %s - approved"), 
 			*Character->GetCharacterName(), *ProposedAction.TargetItem);
 		return true;
 	}
@@ -1491,13 +1667,13 @@ bool UTeamComponent::CoordinateWithTeammates(AC_IdleCharacter* Character, const
 	if (ProposedAction.ActionType == ECharacterActionType::MoveToLocation)
 	{
 		// 移動は基本的に問題なし
-		UE_LOG(LogTemp, VeryVerbose, TEXT("🧠👥 CoordinateWithTeammates: %s moving to %s - approved"), 
+		UE_LOG(LogIdleTask, VeryVerbose, TEXT("🧠👥 CoordinateWithTeammates: %s moving to %s - approved"), 
 			*Character->GetCharacterName(), *ProposedAction.TargetLocation);
 		return true;
 	}
 
 	// その他のアクションも基本的に承認
-	UE_LOG(LogTemp, VeryVerbose, TEXT("🧠👥 CoordinateWithTeammates: %s action %d - approved"), 
+	UE_LOG(LogIdleTask, VeryVerbose, TEXT("🧠👥 CoordinateWithTeammates: %s action %d - approved"), 
 		*Character->GetCharacterName(), (int32)ProposedAction.ActionType);
 	
 	return true;
@@ -1507,7 +1683,7 @@ void UTeamComponent::UpdateTeamStrategy(int32 TeamIndex, const FTeamStrategy& Ne
 {
 	if (!IsValidTeamIndex(TeamIndex))
 	{
-		UE_LOG(LogTemp, Error, TEXT("🧠👥 UpdateTeamStrategy: Invalid team index %d"), TeamIndex);
+		UE_LOG(LogIdleTask, Error, TEXT("🧠👥 UpdateTeamStrategy: Invalid team index %d"), TeamIndex);
 		return;
 	}
 
@@ -1525,13 +1701,13 @@ void UTeamComponent::UpdateTeamStrategy(int32 TeamIndex, const FTeamStrategy& Ne
 	TeamStrategies[TeamIndex] = NewStrategy;
 	StrategyUpdateTimes[TeamIndex] = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
 
-	UE_LOG(LogTemp, Log, TEXT("🧠👥 UpdateTeamStrategy: Team %d strategy updated - %s"), 
+	UE_LOG(LogIdleTask, Log, TEXT("🧠👥 UpdateTeamStrategy: Team %d strategy updated - %s"), 
 		TeamIndex, *NewStrategy.StrategyReason);
 }
 
 void UTeamComponent::ReevaluateAllTeamStrategies()
 {
-	UE_LOG(LogTemp, VeryVerbose, TEXT("🧠👥 ReevaluateAllTeamStrategies: Updating all team strategies"));
+	UE_LOG(LogIdleTask, VeryVerbose, TEXT("🧠👥 ReevaluateAllTeamStrategies: Updating all team strategies"));
 
 	for (int32 i = 0; i < Teams.Num(); i++)
 	{
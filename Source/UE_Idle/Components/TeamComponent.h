@@ -59,6 +59,9 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Team Task Settings")
 	int32 MaxTeamTasks = 3;
 
+	// チーム構成・チームタスクの変更番号（TaskManagerの判定キャッシュ無効化用）
+	uint32 TeamStateVersion = 0;
+
 public:
 	// キャラクターリスト
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Team")
@@ -291,6 +294,9 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Data Access")
 	const TArray<FTeam>& GetTeams() const { return Teams; }
 
+	// チーム構成・チームタスクが変わるたびに増える番号
+	uint32 GetTeamStateVersion() const { return TeamStateVersion; }
+
 	// TimeManagerComponent用のチーム状態更新メソッド
 	UFUNCTION(BlueprintCallable, Category = "Data Access")
 	void SetTeamActionStateInternal(int32 TeamIndex, ETeamActionState NewState, float ActionStartTime = 0.0f, float EstimatedCompletionTime = 0.0f);
@@ -440,6 +446,13 @@ protected:
 	TArray<float> StrategyUpdateTimes;
 
 private:
+	// チーム番号 → 予約済みの戦闘終了イベントID
+	// イベントはIDからチーム番号を引き直すので、DeleteTeamで番号を詰めても正しいチームに届く
+	TMap<int32, int64> CombatEndEvents;
+
+	/** 戦闘が決着したチームの戦闘終了イベントを取り消す */
+	void CancelCombatEndEvent(int32 TeamIndex);
+
 	// 内部管理関数
 	bool IsCharacterInAnyTeam(AC_IdleCharacter* Character) const;
 	void RemoveCharacterFromAllTeams(AC_IdleCharacter* Character);
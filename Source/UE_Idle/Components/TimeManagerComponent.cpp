@@ -1,7 +1,16 @@
 #include "TimeManagerComponent.h"
+#include "../UE_Idle.h"
 #include "../Actor/C_IdleCharacter.h"
 #include "../C_PlayerController.h"
 #include "TeamComponent.h"
+#include "../Managers/CharacterRosterManager.h"
+#include "../Managers/LocationDataTableManager.h"
+#include "../Managers/OfflineProgressCalculator.h"
+#include "CharacterBrain.h"
+#include "TaskManagerComponent.h"
+#include "LocationMovementComponent.h"
+#include "Engine/GameInstance.h"
+#include "Async/ParallelFor.h"
 #include "Engine/World.h"
 #include "Kismet/GameplayStatics.h"
 
@@ -12,7 +21,9 @@
 
 UTimeManagerComponent::UTimeManagerComponent()
 {
-    PrimaryComponentTick.bCanEverTick = false;
+    // Tickは時間分割の未処理コミットがある間だけ有効化する
+    PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.bStartWithTickEnabled = false;
     
     // 簡素化された初期化
     bTimeSystemActive = false;
@@ -27,22 +38,29 @@ UTimeManagerComponent::UTimeManagerComponent()
     GameSpeedPresets.Add("Fast", 0.5f);
     GameSpeedPresets.Add("Ultra", 0.1f);
     
-    UE_LOG(LogTemp, Log, TEXT("🕐 Simplified TimeManagerComponent created with game speed control"));
+    UE_LOG(LogIdleTime, Log, TEXT("🕐 Simplified TimeManagerComponent created with game speed control"));
 }
 
 void UTimeManagerComponent::BeginPlay()
 {
     Super::BeginPlay();
     
-    UE_LOG(LogTemp, Log, TEXT("🕐 Simplified TimeManagerComponent: BeginPlay - Ready for autonomous character system"));
+    ResolveTeamComponent();
+    
+    UE_LOG(LogIdleTime, Log, TEXT("🕐 Simplified TimeManagerComponent: BeginPlay - Ready for autonomous character system"));
 }
 
 void UTimeManagerComponent::BeginDestroy()
 {
+    // 破棄中は未処理コミットを実行しない
+    PendingCharacterTurns.Reset();
+    PendingDecisions.Reset();
+    NextPendingCharacterTurn = 0;
+
     // システム停止
     StopTimeSystem();
     
-    UE_LOG(LogTemp, Log, TEXT("🕐 Simplified TimeManagerComponent: BeginDestroy - Clean shutdown"));
+    UE_LOG(LogIdleTime, Log, TEXT("🕐 Simplified TimeManagerComponent: BeginDestroy - Clean shutdown"));
     
     Super::BeginDestroy();
 }
@@ -55,14 +73,14 @@ void UTimeManagerComponent::StartTimeSystem()
 {
     if (bTimeSystemActive)
     {
-        UE_LOG(LogTemp, Warning, TEXT("🕐 Time system is already active"));
+        UE_LOG(LogIdleTime, Warning, TEXT("🕐 Time system is already active"));
         return;
     }
 
     bTimeSystemActive = true;
     SetupTimer();
     
-    UE_LOG(LogTemp, Log, TEXT("🕐 Autonomous time system started - Turn interval: %.1f seconds"), TimeUpdateInterval);
+    UE_LOG(LogIdleTime, Log, TEXT("🕐 Autonomous time system started - Turn interval: %.1f seconds"), TimeUpdateInterval);
 }
 
 void UTimeManagerComponent::StopTimeSystem()
@@ -74,8 +92,9 @@ void UTimeManagerComponent::StopTimeSystem()
 
     bTimeSystemActive = false;
     ClearTimer();
+    FlushPendingCharacterTurns();
     
-    UE_LOG(LogTemp, Log, TEXT("🕐 Autonomous time system stopped at turn %d"), CurrentTurn);
+    UE_LOG(LogIdleTime, Log, TEXT("🕐 Autonomous time system stopped at turn %d"), CurrentTurn);
 }
 
 void UTimeManagerComponent::ProcessTimeUpdate()
@@ -88,71 +107,209 @@ void UTimeManagerComponent::ProcessTimeUpdate()
         return;
     }
 
+    AdvanceTurn(false);
+}
+
+float UTimeManagerComponent::FastForwardTurns(int32 NumTurns)
+{
+    if (NumTurns <= 0)
+    {
+        UE_LOG(LogIdleTime, Warning, TEXT("🕐❌ FastForwardTurns: Invalid turn count %d"), NumTurns);
+        return 0.0f;
+    }
+
+    if (bFastForwarding)
+    {
+        UE_LOG(LogIdleTime, Warning, TEXT("🕐❌ FastForwardTurns: Already fast-forwarding"));
+        return 0.0f;
+    }
+
+    const int32 StartTurn = CurrentTurn;
+    UE_LOG(LogIdleTime, Log, TEXT("🕐⏩ Fast-forward started: %d turns from turn %d"), NumTurns, StartTurn);
+
+    // 時間分割中のターンを完了させてから開始
+    FlushPendingCharacterTurns();
+
+    bFastForwarding = true;
+    LastFastForwardSkippedTurns = 0;
+    const double StartTime = FPlatformTime::Seconds();
+
+    int32 TurnsDone = 0;
+    while (TurnsDone < NumTurns)
+    {
+        // 全員が到着待ちなら次のイベント・タスクの予測完了（または10ターン毎の戦略再評価）の直前まで飛ばす
+        if (bSkipToNextEventInFastForward && CanSkipIdleTurns())
+        {
+            int32 NextStopTurn = (CurrentTurn / 10 + 1) * 10;
+            const int32 NextEventTurn = EventQueue.GetNextEventTurn();
+            if (NextEventTurn != INDEX_NONE)
+            {
+                NextStopTurn = FMath::Min(NextStopTurn, NextEventTurn);
+            }
+            
+            const UTaskManagerComponent* TaskManager = CachedPlayerController ? CachedPlayerController->TaskManager.Get() : nullptr;
+            const int32 NextCompletionTurn = TaskManager ? TaskManager->GetNextPredictedCompletionTurn() : INDEX_NONE;
+            if (NextCompletionTurn > CurrentTurn)
+            {
+                NextStopTurn = FMath::Min(NextStopTurn, NextCompletionTurn);
+            }
+
+            const int32 SkipTurns = FMath::Min(NextStopTurn - CurrentTurn - 1, NumTurns - TurnsDone);
+            if (SkipTurns > 0)
+            {
+                CurrentTurn += SkipTurns;
+                TurnsDone += SkipTurns;
+                LastFastForwardSkippedTurns += SkipTurns;
+                continue;
+            }
+        }
+
+        AdvanceTurn(true);
+        TurnsDone++;
+    }
+
+    const double ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+    bFastForwarding = false;
+
+    LastFastForwardTurnsPerSecond = ElapsedSeconds > 0.0 ? (float)(NumTurns / ElapsedSeconds) : 0.0f;
+
+    // 高速進行中に省略したUI通知をまとめて1回送る
+    if (UTeamComponent* TeamComp = ResolveTeamComponent())
+    {
+        TeamComp->OnTeamsUpdated.Broadcast();
+    }
+
+    UE_LOG(LogIdleTime, Log, TEXT("🕐⏩ Fast-forward complete: turns %d -> %d in %.3f s (%.1f turns/sec, %d skipped waiting for events)"),
+        StartTurn, CurrentTurn, ElapsedSeconds, LastFastForwardTurnsPerSecond, LastFastForwardSkippedTurns);
+
+    return LastFastForwardTurnsPerSecond;
+}
+
+int32 UTimeManagerComponent::ApplyOfflineProgress(float ElapsedSeconds)
+{
+    if (ElapsedSeconds <= 0.0f)
+    {
+        UE_LOG(LogIdleTime, Warning, TEXT("🕐❌ ApplyOfflineProgress: Invalid elapsed time %.1f"), ElapsedSeconds);
+        return 0;
+    }
+
+    UTeamComponent* TeamComp = ResolveTeamComponent();
+    if (!CachedPlayerController)
+    {
+        UE_LOG(LogIdleTime, Error, TEXT("🕐❌ ApplyOfflineProgress: PlayerController not found"));
+        return 0;
+    }
+
+    FlushPendingCharacterTurns();
+
+    const double StartTime = FPlatformTime::Seconds();
+
+    const FOfflineProgressResult Result = UOfflineProgressCalculator::CalculateOfflineProgress(
+        CachedPlayerController, ElapsedSeconds, TimeUpdateInterval);
+    UOfflineProgressCalculator::ApplyOfflineProgress(CachedPlayerController, Result);
+
+    const int32 StartTurn = CurrentTurn;
+    CurrentTurn += Result.SimulatedTurns;
+
+    // まとめて反映したのでUI通知は1回
+    if (TeamComp)
+    {
+        TeamComp->OnTeamsUpdated.Broadcast();
+    }
+
+    UE_LOG(LogIdleTime, Log, TEXT("🕐🌙 Offline progress: %.1f s, turns %d -> %d, %d segments in %.3f ms"),
+        ElapsedSeconds, StartTurn, CurrentTurn, Result.GetSegmentCount(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+    return Result.GetSegmentCount();
+}
+
+void UTimeManagerComponent::AdvanceTurn(bool bHeadless)
+{
+    SCOPE_CYCLE_COUNTER(STAT_IdleSim_AdvanceTurn);
+    TRACE_CPUPROFILER_EVENT_SCOPE(IdleSim_AdvanceTurn);
+    
+    const double FrameStartTime = FPlatformTime::Seconds();
+    
+    // 前ターンの未処理コミットを先に完了（一括処理と同じ結果を保証）
+    FlushPendingCharacterTurns(true);
+    
+    // ターン単位カウンターをリセット
+    SET_DWORD_STAT(STAT_IdleSim_CharactersProcessed, 0);
+    SET_DWORD_STAT(STAT_IdleSim_PathsComputed, 0);
+    SET_DWORD_STAT(STAT_IdleSim_LogEntries, 0);
+    SET_DWORD_STAT(STAT_IdleSim_TeamDecisionCacheHits, 0);
+    SET_DWORD_STAT(STAT_IdleSim_TeamDecisionCacheMisses, 0);
+    
     // ターン番号を進める
     CurrentTurn++;
     
     // ターン開始の目立つ区切り線を追加
-    UE_LOG(LogTemp, Warning, TEXT("■■■■■■■■■■■■■■■■■■"));
+    if (!bHeadless)
+    {
+        UE_LOG(LogIdleTime, Log, TEXT("■■■■■■■■■■■■■■■■■■"));
+    }
     
-    // UE_LOG(LogTemp, Verbose, TEXT("🕐⏰ Turn %d started - Notifying all autonomous characters"), CurrentTurn);
+    // UE_LOG(LogIdleTime, Verbose, TEXT("🕐⏰ Turn %d started - Notifying all autonomous characters"), CurrentTurn);
+    
+    // 予約イベント（移動到着・時限効果終了など）をキャラクターの判断より先に実行
+    int32 DispatchedEvents = 0;
+    {
+        SCOPE_CYCLE_COUNTER(STAT_IdleSim_EventDispatch);
+        TRACE_CPUPROFILER_EVENT_SCOPE(IdleSim_EventDispatch);
+        DispatchedEvents = EventQueue.DispatchDueEvents(CurrentTurn);
+    }
+    if (DispatchedEvents > 0)
+    {
+        UE_LOG(LogIdleTime, VeryVerbose, TEXT("🕐📅 Turn %d: %d scheduled events dispatched (%d pending)"),
+            CurrentTurn, DispatchedEvents, EventQueue.Num());
+    }
+    
+    UTeamComponent* TeamComp = ResolveTeamComponent();
     
     // 🚨 CRITICAL FIX: チーム戦略の定期更新
     // 実装計画書：「既存機能の完全再現」を保証
     // UIからのタスク変更に加えて、状況変化に応じた戦略更新
-    if (CurrentTurn % 10 == 0) // 10ターン毎に戦略を再評価
+    if (CurrentTurn % 10 == 0 && TeamComp) // 10ターン毎に戦略を再評価
     {
-        AC_PlayerController* PlayerController = Cast<AC_PlayerController>(
-            UGameplayStatics::GetPlayerController(GetWorld(), 0));
-        if (PlayerController)
-        {
-            UTeamComponent* TeamComp = PlayerController->FindComponentByClass<UTeamComponent>();
-            if (TeamComp)
-            {
-                TeamComp->ReevaluateAllTeamStrategies();
-                UE_LOG(LogTemp, VeryVerbose, TEXT("🕐🎯 Turn %d: Team strategies reevaluated"), CurrentTurn);
-            }
-        }
+        TeamComp->ReevaluateAllTeamStrategies();
+        UE_LOG(LogIdleTime, VeryVerbose, TEXT("🕐🎯 Turn %d: Team strategies reevaluated"), CurrentTurn);
     }
     
     // 🚨 UPDATED: グリッドベース移動システム統合
     // 自律的キャラクターが個別に移動を判断するため、TimeManagerは基本的な更新のみ
-    AC_PlayerController* MovementPlayerController = Cast<AC_PlayerController>(
-        UGameplayStatics::GetPlayerController(GetWorld(), 0));
-    if (MovementPlayerController)
+    if (TeamComp && !bHeadless)
     {
-        UTeamComponent* TeamComp = MovementPlayerController->FindComponentByClass<UTeamComponent>();
+        // チーム状況の基本更新のみ実行
+        // 実際の移動はBehavior Treeが各キャラクター個別に処理
         
-        if (TeamComp)
-        {
-            // チーム状況の基本更新のみ実行
-            // 実際の移動はBehavior Treeが各キャラクター個別に処理
-            
-            // UI更新は引き続き実行（チーム状況変化の反映）
-            TeamComp->OnTeamsUpdated.Broadcast();
-            UE_LOG(LogTemp, VeryVerbose, TEXT("🕐🎮 Turn %d: Team status updated for autonomous system"), 
-                CurrentTurn);
-        }
+        // UI更新は引き続き実行（チーム状況変化の反映）
+        TeamComp->OnTeamsUpdated.Broadcast();
+        UE_LOG(LogIdleTime, VeryVerbose, TEXT("🕐🎮 Turn %d: Team status updated for autonomous system"), 
+            CurrentTurn);
     }
     
-    // 全キャラクターにターン開始を通知
-    TArray<AActor*> AllCharacters;
-    UGameplayStatics::GetAllActorsOfClass(GetWorld(), AC_IdleCharacter::StaticClass(), AllCharacters);
+    // 「全て」モードのチームをまとめてタスクへ割り当てる（各キャラクターの判断より先に1回だけ）
+    // 施設で増減したレシピのアンロックもここで反映しておき、判断中の参照では同期しない
+    if (UTaskManagerComponent* TaskManager = CachedPlayerController ? CachedPlayerController->TaskManager.Get() : nullptr)
+    {
+        TaskManager->SyncRecipeGraph();
+        TaskManager->AllocateAllModeTeams();
+    }
     
-    int32 NotifiedCharacters = 0;
+    // 全キャラクターにターン開始を通知（フェーズ分割処理）
+    // 高速進行中は時間分割しない
+    RunCharacterTurnPhases(!bHeadless && bTimeSliceCharacterTurns);
     
-    for (AActor* Actor : AllCharacters)
+    if (!bHeadless)
     {
-        if (AC_IdleCharacter* Character = Cast<AC_IdleCharacter>(Actor))
-        {
-            // 各キャラクターの自律的処理を開始
-            Character->OnTurnTick(CurrentTurn);
-            NotifiedCharacters++;
-        }
+        TurnBudgetStats.LastTurnWorstFrameMs = 0.0f;
+        TurnBudgetStats.LastTurnFrameCount = 0;
+        RecordTurnFrameCost(FPlatformTime::Seconds() - FrameStartTime);
+        
+        TurnBudgetStats.Backlog = GetPendingCharacterTurnCount();
+        TurnBudgetStats.PeakBacklog = FMath::Max(TurnBudgetStats.PeakBacklog, TurnBudgetStats.Backlog);
     }
     
-    // UE_LOG(LogTemp, Verbose, TEXT("🕐✅ Turn %d completed - Notified %d characters"), 
-    //     CurrentTurn, NotifiedCharacters);
-    
     // それだけ！
     // 複雑なタスク処理、チーム管理、リソース監視などは
     // 自律的キャラクターシステムとサービス群が担当
@@ -166,7 +323,7 @@ void UTimeManagerComponent::SetupTimer()
 {
     if (!GetWorld())
     {
-        UE_LOG(LogTemp, Error, TEXT("🕐❌ Cannot setup timer - World is null"));
+        UE_LOG(LogIdleTime, Error, TEXT("🕐❌ Cannot setup timer - World is null"));
         return;
     }
 
@@ -178,7 +335,7 @@ void UTimeManagerComponent::SetupTimer()
         true  // Loop
     );
     
-    UE_LOG(LogTemp, Verbose, TEXT("🕐⏲️ Timer setup complete - Interval: %.1f seconds"), TimeUpdateInterval);
+    UE_LOG(LogIdleTime, Verbose, TEXT("🕐⏲️ Timer setup complete - Interval: %.1f seconds"), TimeUpdateInterval);
 }
 
 void UTimeManagerComponent::ClearTimer()
@@ -188,8 +345,344 @@ void UTimeManagerComponent::ClearTimer()
         GetWorld()->GetTimerManager().ClearTimer(TimeUpdateTimerHandle);
         TimeUpdateTimerHandle.Invalidate();
         
-        UE_LOG(LogTemp, Verbose, TEXT("🕐⏹️ Timer cleared"));
+        UE_LOG(LogIdleTime, Verbose, TEXT("🕐⏹️ Timer cleared"));
+    }
+}
+
+void UTimeManagerComponent::RunCharacterTurnPhases(bool bTimeSliced)
+{
+    UCharacterRosterManager* Roster = UCharacterRosterManager::Get(this);
+    if (!Roster)
+    {
+        UE_LOG(LogIdleTime, Warning, TEXT("🕐❌ Turn %d: CharacterRosterManager not available"), CurrentTurn);
+        return;
+    }
+    
+    const TArray<TObjectPtr<AC_IdleCharacter>>& RosterCharacters = Roster->GetCharacters();
+    const TArray<TObjectPtr<UCharacterBrain>>& RosterBrains = Roster->GetBrains();
+    
+    // ===========================================
+    // 1. スナップショットフェーズ（ゲームスレッド）
+    // ===========================================
+    
+    // 判断フェーズ対象のキャラクター（名簿順）
+    TArray<AC_IdleCharacter*> DecidingCharacters;
+    TArray<UCharacterBrain*> DecidingBrains;
+    TArray<FCharacterSituation> Situations;
+    DecidingCharacters.Reserve(RosterCharacters.Num());
+    DecidingBrains.Reserve(RosterCharacters.Num());
+    Situations.Reserve(RosterCharacters.Num());
+    
+    // 名簿インデックス → 判断結果インデックス（Behavior Tree駆動はINDEX_NONE）
+    TArray<int32> DecisionIndices;
+    DecisionIndices.Init(INDEX_NONE, RosterCharacters.Num());
+    
+    FBrainDecisionSnapshot Snapshot;
+    {
+        SCOPE_CYCLE_COUNTER(STAT_IdleSim_BrainSnapshot);
+        TRACE_CPUPROFILER_EVENT_SCOPE(IdleSim_BrainSnapshot);
+    
+        for (int32 Index = 0; Index < RosterCharacters.Num(); ++Index)
+        {
+            AC_IdleCharacter* Character = RosterCharacters[Index];
+            UCharacterBrain* Brain = RosterBrains[Index];
+            if (!IsValid(Character) || !Brain || !Character->UsesBrainTurnPipeline())
+            {
+                continue;
+            }
+        
+            Character->PrepareTurnSnapshot();
+            DecisionIndices[Index] = DecidingCharacters.Add(Character);
+            DecidingBrains.Add(Brain);
+            Situations.Add(Character->GetCurrentSituation());
+        }
+    
+        if (DecidingCharacters.Num() > 0)
+        {
+            UTeamComponent* TeamComp = ResolveTeamComponent();
+            const UTaskManagerComponent* TaskManager = CachedPlayerController ? CachedPlayerController->TaskManager.Get() : nullptr;
+            const ULocationDataTableManager* LocationManager = nullptr;
+            if (UGameInstance* GameInstance = GetWorld() ? GetWorld()->GetGameInstance() : nullptr)
+            {
+                LocationManager = GameInstance->GetSubsystem<ULocationDataTableManager>();
+            }
+        
+            UCharacterBrain::BuildDecisionSnapshot(TaskManager, TeamComp, LocationManager, DecidingCharacters, Snapshot);
+        }
+    }
+    
+    // ===========================================
+    // 2. 判断フェーズ（ワーカースレッド、スナップショットのみ参照）
+    // ===========================================
+    
+    TArray<FCharacterAction> Decisions;
+    Decisions.SetNum(DecidingCharacters.Num());
+    
+    {
+        SCOPE_CYCLE_COUNTER(STAT_IdleSim_BrainDecide);
+        TRACE_CPUPROFILER_EVENT_SCOPE(IdleSim_BrainDecide);
+        
+        ParallelFor(DecidingCharacters.Num(), [&](int32 DecisionIndex)
+        {
+            Decisions[DecisionIndex] = DecidingBrains[DecisionIndex]->DecideOptimalActionFromSnapshot(Situations[DecisionIndex], Snapshot);
+        }, bParallelDecidePhase ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+    }
+    
+    // ===========================================
+    // 3. コミットフェーズ（ゲームスレッド、名簿順に適用）
+    // ===========================================
+    
+    // 判断はスナップショットから確定済みなので、コミットは後続フレームに分散しても結果は変わらない
+    PendingCharacterTurns.Reset(RosterCharacters.Num());
+    PendingDecisions = MoveTemp(Decisions);
+    NextPendingCharacterTurn = 0;
+    PendingTurnNumber = CurrentTurn;
+    
+    // 採集はコミット中に予約だけ行い、全員のコミット後にまとめて反映する
+    if (UTaskManagerComponent* TaskManager = CachedPlayerController ? CachedPlayerController->TaskManager.Get() : nullptr)
+    {
+        TaskManager->BeginGatheringStage();
+    }
+    
+    for (int32 Index = 0; Index < RosterCharacters.Num(); ++Index)
+    {
+        AC_IdleCharacter* Character = RosterCharacters[Index];
+        if (!IsValid(Character))
+        {
+            continue;
+        }
+        
+        FPendingCharacterTurn& Pending = PendingCharacterTurns.AddDefaulted_GetRef();
+        Pending.Character = Character;
+        Pending.DecisionIndex = DecisionIndices[Index];
+    }
+    
+    const int32 CommittedCharacters = ProcessPendingCharacterTurns(bTimeSliced ? CharacterTurnBudgetMs / 1000.0 : 0.0);
+    
+    UE_LOG(LogIdleTime, VeryVerbose, TEXT("🕐✅ Turn %d started - Committed %d/%d characters (%d brain decisions)"), 
+        CurrentTurn, CommittedCharacters, PendingCharacterTurns.Num(), DecidingCharacters.Num());
+    
+    // 残りは予算内でTickから処理
+    if (GetPendingCharacterTurnCount() > 0)
+    {
+        SetComponentTickEnabled(true);
+    }
+}
+
+void UTimeManagerComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+    
+    if (GetPendingCharacterTurnCount() <= 0)
+    {
+        SetComponentTickEnabled(false);
+        return;
+    }
+    
+    // ポーズ中はターン処理を進めない
+    if (bGamePaused)
+    {
+        return;
+    }
+    
+    const double FrameStartTime = FPlatformTime::Seconds();
+    ProcessPendingCharacterTurns(CharacterTurnBudgetMs / 1000.0);
+    RecordTurnFrameCost(FPlatformTime::Seconds() - FrameStartTime);
+    
+    TurnBudgetStats.Backlog = GetPendingCharacterTurnCount();
+    if (TurnBudgetStats.Backlog <= 0)
+    {
+        SetComponentTickEnabled(false);
+        UE_LOG(LogIdleTime, VeryVerbose, TEXT("🕐✅ Turn %d completed over %d frames (worst %.2f ms)"), 
+            PendingTurnNumber, TurnBudgetStats.LastTurnFrameCount, TurnBudgetStats.LastTurnWorstFrameMs);
+    }
+}
+
+int32 UTimeManagerComponent::ProcessPendingCharacterTurns(double BudgetSeconds)
+{
+    SCOPE_CYCLE_COUNTER(STAT_IdleSim_BrainCommit);
+    TRACE_CPUPROFILER_EVENT_SCOPE(IdleSim_BrainCommit);
+    
+    const double StartTime = FPlatformTime::Seconds();
+    int32 ProcessedCount = 0;
+    
+    while (NextPendingCharacterTurn < PendingCharacterTurns.Num())
+    {
+        const FPendingCharacterTurn& Pending = PendingCharacterTurns[NextPendingCharacterTurn++];
+        
+        if (AC_IdleCharacter* Character = Pending.Character.Get())
+        {
+            INC_DWORD_STAT(STAT_IdleSim_CharactersProcessed);
+            
+            if (Pending.DecisionIndex != INDEX_NONE)
+            {
+                Character->CommitTurnDecision(PendingDecisions[Pending.DecisionIndex]);
+            }
+            else
+            {
+                // Behavior Tree駆動のキャラクターは従来通り
+                Character->OnTurnTick(PendingTurnNumber);
+            }
+        }
+        ProcessedCount++;
+        
+        if (BudgetSeconds > 0.0 && FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
+        {
+            break;
+        }
+    }
+    
+    if (NextPendingCharacterTurn >= PendingCharacterTurns.Num())
+    {
+        PendingCharacterTurns.Reset();
+        PendingDecisions.Reset();
+        NextPendingCharacterTurn = 0;
+        
+        // ターンの採集ステージ（全チーム分を一括反映）
+        if (UTaskManagerComponent* TaskManager = CachedPlayerController ? CachedPlayerController->TaskManager.Get() : nullptr)
+        {
+            TaskManager->EndGatheringStage();
+        }
     }
+    
+    return ProcessedCount;
+}
+
+void UTimeManagerComponent::FlushPendingCharacterTurns(bool bOverBudget)
+{
+    const int32 Remaining = GetPendingCharacterTurnCount();
+    if (Remaining <= 0)
+    {
+        return;
+    }
+    
+    // ターン間隔内に処理しきれなかった（予算が小さすぎるか名簿が大きすぎる）
+    // 停止・高速進行・オフライン進行前の一括処理は予算超過ではないので数えない
+    if (bOverBudget)
+    {
+        TurnBudgetStats.ForcedFlushCount++;
+        UE_LOG(LogIdleTime, Verbose, TEXT("🕐⚠️ Turn %d: flushing %d pending characters over budget"), PendingTurnNumber, Remaining);
+    }
+    
+    ProcessPendingCharacterTurns(0.0);
+    TurnBudgetStats.Backlog = 0;
+    SetComponentTickEnabled(false);
+}
+
+void UTimeManagerComponent::RecordTurnFrameCost(double FrameSeconds)
+{
+    const float FrameMs = static_cast<float>(FrameSeconds * 1000.0);
+    TurnBudgetStats.LastTurnWorstFrameMs = FMath::Max(TurnBudgetStats.LastTurnWorstFrameMs, FrameMs);
+    TurnBudgetStats.WorstFrameMs = FMath::Max(TurnBudgetStats.WorstFrameMs, FrameMs);
+    TurnBudgetStats.LastTurnFrameCount++;
+}
+
+void UTimeManagerComponent::SetCharacterTurnBudget(float BudgetMs)
+{
+    CharacterTurnBudgetMs = FMath::Clamp(BudgetMs, 0.1f, 33.0f);
+    UE_LOG(LogIdleTime, Log, TEXT("🕐⏱️ Character turn budget set to %.2f ms/frame"), CharacterTurnBudgetMs);
+}
+
+void UTimeManagerComponent::ResetTurnBudgetStats()
+{
+    TurnBudgetStats = FTurnBudgetStats();
+    TurnBudgetStats.Backlog = GetPendingCharacterTurnCount();
+}
+
+int64 UTimeManagerComponent::ScheduleTurnEvent(EIdleTimeEventType Type, int32 DelayTurns, TFunction<void()>&& Callback)
+{
+    // 同じターン内で即実行されないよう最低1ターン後
+    const int32 EventTurn = CurrentTurn + FMath::Max(1, DelayTurns);
+    return EventQueue.Schedule(EventTurn, Type, MoveTemp(Callback));
+}
+
+bool UTimeManagerComponent::CancelTurnEvent(int64 EventId)
+{
+    return EventQueue.Cancel(EventId);
+}
+
+void UTimeManagerComponent::RestoreTurn(int32 Turn)
+{
+    FlushPendingCharacterTurns();
+
+    EventQueue.ShiftTurns(Turn - CurrentTurn);
+    CurrentTurn = Turn;
+
+    UE_LOG(LogIdleTime, Log, TEXT("🕐 Turn restored to %d"), CurrentTurn);
+}
+
+UTimeManagerComponent* UTimeManagerComponent::Get(const UObject* WorldContextObject)
+{
+    if (!WorldContextObject)
+    {
+        return nullptr;
+    }
+
+    AC_PlayerController* PC = Cast<AC_PlayerController>(UGameplayStatics::GetPlayerController(WorldContextObject, 0));
+    return PC ? PC->TimeManager : nullptr;
+}
+
+bool UTimeManagerComponent::CanSkipIdleTurns()
+{
+    UTeamComponent* TeamComp = ResolveTeamComponent();
+    UCharacterRosterManager* Roster = UCharacterRosterManager::Get(this);
+    ULocationMovementComponent* MovementComp = CachedPlayerController ? CachedPlayerController->MovementComponent : nullptr;
+    if (!TeamComp || !Roster || !MovementComp)
+    {
+        return false;
+    }
+
+    // 移動中チームのメンバーは到着イベントまで状況が変わらない
+    TSet<const AC_IdleCharacter*> WaitingCharacters;
+    const TArray<FTeam> Teams = TeamComp->GetAllTeams();
+    for (int32 TeamIndex = 0; TeamIndex < Teams.Num(); TeamIndex++)
+    {
+        const EMovementState State = MovementComp->GetMovementState(TeamIndex);
+        if (State == EMovementState::MovingToDestination || State == EMovementState::MovingToBase)
+        {
+            for (const AC_IdleCharacter* Member : Teams[TeamIndex].Members)
+            {
+                WaitingCharacters.Add(Member);
+            }
+        }
+    }
+
+    for (const AC_IdleCharacter* Character : Roster->GetCharacters())
+    {
+        if (!WaitingCharacters.Contains(Character))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+UTeamComponent* UTimeManagerComponent::ResolveTeamComponent()
+{
+    if (IsValid(CachedTeamComponent))
+    {
+        return CachedTeamComponent;
+    }
+
+    // TimeManagerはPlayerControllerのサブオブジェクトなのでOwnerを優先
+    CachedPlayerController = Cast<AC_PlayerController>(GetOwner());
+    if (!CachedPlayerController)
+    {
+        CachedPlayerController = Cast<AC_PlayerController>(
+            UGameplayStatics::GetPlayerController(GetWorld(), 0));
+    }
+
+    if (CachedPlayerController)
+    {
+        CachedTeamComponent = CachedPlayerController->TeamComponent;
+        if (!CachedTeamComponent)
+        {
+            CachedTeamComponent = CachedPlayerController->FindComponentByClass<UTeamComponent>();
+        }
+    }
+
+    return CachedTeamComponent;
 }
 
 // ===============================================
@@ -203,12 +696,12 @@ void UTimeManagerComponent::SetGameSpeed(const FString& SpeedName)
         CurrentGameSpeed = SpeedName;
         SetCustomInterval(*Speed);
         
-        UE_LOG(LogTemp, Log, TEXT("🕐⚡ Game speed set to %s (%.2f seconds per turn)"), 
+        UE_LOG(LogIdleTime, Log, TEXT("🕐⚡ Game speed set to %s (%.2f seconds per turn)"), 
             *SpeedName, *Speed);
     }
     else
     {
-        UE_LOG(LogTemp, Warning, TEXT("🕐❌ Unknown game speed: %s"), *SpeedName);
+        UE_LOG(LogIdleTime, Warning, TEXT("🕐❌ Unknown game speed: %s"), *SpeedName);
     }
 }
 
@@ -216,7 +709,7 @@ void UTimeManagerComponent::SetCustomInterval(float NewInterval)
 {
     if (NewInterval < 0.1f || NewInterval > 10.0f)
     {
-        UE_LOG(LogTemp, Warning, TEXT("🕐❌ Invalid interval: %.2f (must be 0.1-10.0)"), NewInterval);
+        UE_LOG(LogIdleTime, Warning, TEXT("🕐❌ Invalid interval: %.2f (must be 0.1-10.0)"), NewInterval);
         return;
     }
 
@@ -229,7 +722,7 @@ void UTimeManagerComponent::SetCustomInterval(float NewInterval)
         StartTimeSystem();
     }
     
-    UE_LOG(LogTemp, Log, TEXT("🕐⚙️ Custom interval set to %.2f seconds"), NewInterval);
+    UE_LOG(LogIdleTime, Log, TEXT("🕐⚙️ Custom interval set to %.2f seconds"), NewInterval);
 }
 
 void UTimeManagerComponent::PauseGame()
@@ -237,7 +730,7 @@ void UTimeManagerComponent::PauseGame()
     if (!bGamePaused)
     {
         bGamePaused = true;
-        UE_LOG(LogTemp, Log, TEXT("🕐⏸️ Game paused at turn %d"), CurrentTurn);
+        UE_LOG(LogIdleTime, Log, TEXT("🕐⏸️ Game paused at turn %d"), CurrentTurn);
     }
 }
 
@@ -246,6 +739,6 @@ void UTimeManagerComponent::ResumeGame()
     if (bGamePaused)
     {
         bGamePaused = false;
-        UE_LOG(LogTemp, Log, TEXT("🕐▶️ Game resumed at turn %d"), CurrentTurn);
+        UE_LOG(LogIdleTime, Log, TEXT("🕐▶️ Game resumed at turn %d"), CurrentTurn);
     }
 }
\ No newline at end of file
@@ -5,10 +5,48 @@
 #include "Engine/World.h"
 #include "TimerManager.h"
 #include "Kismet/GameplayStatics.h"
+#include "../Types/TimeEventTypes.h"
+#include "../Types/CharacterTypes.h"
 #include "TimeManagerComponent.generated.h"
 
 // Forward declarations
 class AC_IdleCharacter;
+class AC_PlayerController;
+class UTeamComponent;
+
+/**
+ * ターン処理の時間分割統計
+ * キャラクターのコミット処理をフレーム予算内に分散した結果の計測値
+ */
+USTRUCT(BlueprintType)
+struct FTurnBudgetStats
+{
+    GENERATED_BODY()
+
+    // 計測開始以降で最も重かったフレームのターン処理時間（ミリ秒）
+    UPROPERTY(BlueprintReadOnly, Category = "Turn Budget")
+    float WorstFrameMs = 0.0f;
+
+    // 直近ターンで最も重かったフレームのターン処理時間（ミリ秒）
+    UPROPERTY(BlueprintReadOnly, Category = "Turn Budget")
+    float LastTurnWorstFrameMs = 0.0f;
+
+    // 直近ターンの処理に使ったフレーム数
+    UPROPERTY(BlueprintReadOnly, Category = "Turn Budget")
+    int32 LastTurnFrameCount = 0;
+
+    // 現在の未処理キャラクター数
+    UPROPERTY(BlueprintReadOnly, Category = "Turn Budget")
+    int32 Backlog = 0;
+
+    // ターン開始フレーム後に残った未処理数の最大値
+    UPROPERTY(BlueprintReadOnly, Category = "Turn Budget")
+    int32 PeakBacklog = 0;
+
+    // 次のターン開始までに処理しきれず、予算を無視して一括処理した回数
+    UPROPERTY(BlueprintReadOnly, Category = "Turn Budget")
+    int32 ForcedFlushCount = 0;
+};
 
 /**
  * Phase 3: 簡素化されたTimeManagerComponent
@@ -26,6 +64,11 @@ protected:
     virtual void BeginPlay() override;
     virtual void BeginDestroy() override;
 
+public:
+    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+protected:
+
     // ===========================================
     // Phase 3: 簡素化された時間システム
     // ===========================================
@@ -65,6 +108,22 @@ protected:
     UPROPERTY(BlueprintReadOnly, Category = "Autonomous Time System")
     int32 CurrentTurn = 0;
 
+    // 判断フェーズをParallelForで並列実行するか（falseでゲームスレッド逐次実行）
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Autonomous Time System")
+    bool bParallelDecidePhase = true;
+
+    // 高速進行中、全キャラクターが移動到着待ちなら次のイベントまでターンを飛ばす
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Autonomous Time System")
+    bool bSkipToNextEventInFastForward = true;
+
+    // キャラクターのコミット処理をターン間隔のフレームに分散するか（falseでターン開始フレームに一括処理）
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Autonomous Time System")
+    bool bTimeSliceCharacterTurns = true;
+
+    // 1フレームあたりのキャラクターターン処理予算（ミリ秒）
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Autonomous Time System", meta = (ClampMin = "0.1", ClampMax = "33.0"))
+    float CharacterTurnBudgetMs = 2.0f;
+
 public:
     // ===========================================
     // Phase 3: 簡素化されたパブリックAPI
@@ -118,6 +177,88 @@ public:
     UFUNCTION()
     void ProcessTimeUpdate();
 
+    // === 高速シミュレーション ===
+
+    /**
+     * ヘッドレス高速進行：タイマーを待たずにNターンを連続実行する
+     * 毎ターンのUI通知（OnTeamsUpdated）と区切り線ログは省略される
+     * @param NumTurns 進めるターン数
+     * @return 実測のターン/秒
+     */
+    UFUNCTION(BlueprintCallable, Category = "Autonomous Time System")
+    float FastForwardTurns(int32 NumTurns);
+
+    /** 高速進行中か */
+    UFUNCTION(BlueprintPure, Category = "Autonomous Time System")
+    bool IsFastForwarding() const { return bFastForwarding; }
+
+    /** 直近の高速進行のターン/秒 */
+    UFUNCTION(BlueprintPure, Category = "Autonomous Time System")
+    float GetLastFastForwardTurnsPerSecond() const { return LastFastForwardTurnsPerSecond; }
+
+    /** 直近の高速進行でイベント待ちとして飛ばしたターン数 */
+    UFUNCTION(BlueprintPure, Category = "Autonomous Time System")
+    int32 GetLastFastForwardSkippedTurns() const { return LastFastForwardSkippedTurns; }
+
+    // === 離散イベントスケジューラ ===
+
+    /**
+     * ターン時計上にイベントを予約する（1ターン = ゲーム内1秒）
+     * 毎ターンのポーリングの代わりに、各システムが次に状態が変わるターンを予約する
+     * @param DelayTurns 何ターン後に実行するか（最低1）
+     * @return キャンセル用のイベントID
+     */
+    int64 ScheduleTurnEvent(EIdleTimeEventType Type, int32 DelayTurns, TFunction<void()>&& Callback);
+
+    /** 予約済みイベントの取り消し */
+    bool CancelTurnEvent(int64 EventId);
+
+    /** 次のイベントのターン番号（なければ-1） */
+    UFUNCTION(BlueprintPure, Category = "Autonomous Time System")
+    int32 GetNextEventTurn() const { return EventQueue.GetNextEventTurn(); }
+
+    /** 待機中のイベント数 */
+    UFUNCTION(BlueprintPure, Category = "Autonomous Time System")
+    int32 GetPendingEventCount() const { return EventQueue.Num(); }
+
+    /**
+     * ターン番号を復元する（リプレイの開始状態復元用）
+     * 未処理のコミットを完了し、予約済みイベントは残りターン数を保ったまま移す
+     */
+    void RestoreTurn(int32 Turn);
+
+    // === ターン処理の時間分割 ===
+
+    /** 1フレームあたりのキャラクターターン処理予算を設定（ミリ秒） */
+    UFUNCTION(BlueprintCallable, Category = "Autonomous Time System")
+    void SetCharacterTurnBudget(float BudgetMs);
+
+    /** 時間分割の統計取得 */
+    UFUNCTION(BlueprintPure, Category = "Autonomous Time System")
+    FTurnBudgetStats GetTurnBudgetStats() const { return TurnBudgetStats; }
+
+    /** 時間分割の統計リセット */
+    UFUNCTION(BlueprintCallable, Category = "Autonomous Time System")
+    void ResetTurnBudgetStats();
+
+    /** 現ターンで未処理のキャラクター数 */
+    UFUNCTION(BlueprintPure, Category = "Autonomous Time System")
+    int32 GetPendingCharacterTurnCount() const { return PendingCharacterTurns.Num() - NextPendingCharacterTurn; }
+
+    /** ワールドからTimeManagerを取得するヘルパー（PlayerControllerが所有） */
+    static UTimeManagerComponent* Get(const UObject* WorldContextObject);
+
+    // === オフライン進行 ===
+
+    /**
+     * オフライン経過時間分の進行を一括反映する
+     * ターンを1つずつ実行せず、採集・移動・施設生産を区間ごとに閉形式で計算する
+     * @param ElapsedSeconds オフライン経過時間（秒）
+     * @return 評価した区間数
+     */
+    UFUNCTION(BlueprintCallable, Category = "Autonomous Time System")
+    int32 ApplyOfflineProgress(float ElapsedSeconds);
+
 private:
     // ===========================================
     // Phase 3: 簡素化された内部実装
@@ -128,4 +269,74 @@ private:
 
     /** タイマークリア */
     void ClearTimer();
+
+    /**
+     * 1ターン分の処理
+     * @param bHeadless trueの場合UI通知と区切り線ログを省略
+     */
+    void AdvanceTurn(bool bHeadless);
+
+    /**
+     * 全キャラクターのターン処理
+     * スナップショット → 判断（並列） → コミット（逐次）の3フェーズで実行
+     * @param bTimeSliced trueの場合コミットを予算内だけ処理し、残りは後続フレームで処理
+     */
+    void RunCharacterTurnPhases(bool bTimeSliced);
+
+    /**
+     * 未処理のコミットを名簿順に実行
+     * @param BudgetSeconds 処理予算（0以下は全件）。予算があっても最低1件は処理する
+     * @return 処理した件数
+     */
+    int32 ProcessPendingCharacterTurns(double BudgetSeconds);
+
+    /**
+     * 未処理のコミットを予算を無視して全て実行（次ターン開始・高速進行の前に呼ぶ）
+     * @param bOverBudget 次ターン開始までに処理しきれなかったための一括処理か（ForcedFlushCountに数える）
+     */
+    void FlushPendingCharacterTurns(bool bOverBudget = false);
+
+    /** 1フレーム分のターン処理時間を統計に記録 */
+    void RecordTurnFrameCost(double FrameSeconds);
+
+    /** PlayerController/TeamComponent参照を解決してキャッシュ */
+    UTeamComponent* ResolveTeamComponent();
+
+    /** 全キャラクターが移動到着待ちで、ターンを飛ばしても結果が変わらないか */
+    bool CanSkipIdleTurns();
+
+    // ターン時計上の予約イベント
+    FIdleEventQueue EventQueue;
+
+    // 時間分割で未処理のキャラクター（名簿順、判断結果はターン開始時のスナップショットから確定済み）
+    struct FPendingCharacterTurn
+    {
+        TWeakObjectPtr<AC_IdleCharacter> Character;
+
+        // PendingDecisionsのインデックス（Behavior Tree駆動はINDEX_NONE）
+        int32 DecisionIndex = INDEX_NONE;
+    };
+
+    TArray<FPendingCharacterTurn> PendingCharacterTurns;
+    TArray<FCharacterAction> PendingDecisions;
+    int32 NextPendingCharacterTurn = 0;
+
+    // 未処理分が属するターン番号
+    int32 PendingTurnNumber = 0;
+
+    FTurnBudgetStats TurnBudgetStats;
+
+    // キャッシュ済み参照（TimeManagerはPlayerControllerが所有）
+    UPROPERTY()
+    TObjectPtr<AC_PlayerController> CachedPlayerController;
+
+    UPROPERTY()
+    TObjectPtr<UTeamComponent> CachedTeamComponent;
+
+    // 高速進行中フラグ
+    bool bFastForwarding = false;
+
+    // 直近の高速進行計測結果
+    float LastFastForwardTurnsPerSecond = 0.0f;
+    int32 LastFastForwardSkippedTurns = 0;
 };
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "BattleSystemManager.h"
+#include "../UE_Idle.h"
 #include "../Components/LocationEventManager.h"
 #include "../Components/CombatComponent.h"
 #include "../Components/TeamComponent.h"
@@ -14,7 +15,7 @@ void UBattleSystemManager::Initialize(FSubsystemCollectionBase& Collection)
     
     CreateBattleSystemActor();
     
-    UE_LOG(LogTemp, Log, TEXT("BattleSystemManager initialized"));
+    UE_LOG(LogIdleCombat, Log, TEXT("BattleSystemManager initialized"));
 }
 
 void UBattleSystemManager::Deinitialize()
@@ -36,7 +37,7 @@ void UBattleSystemManager::CreateBattleSystemActor()
     UWorld* World = GetWorld();
     if (!World)
     {
-        UE_LOG(LogTemp, Error, TEXT("BattleSystemManager: No world available"));
+        UE_LOG(LogIdleCombat, Error, TEXT("BattleSystemManager: No world available"));
         return;
     }
     
@@ -49,7 +50,7 @@ void UBattleSystemManager::CreateBattleSystemActor()
     
     if (!BattleSystemActor)
     {
-        UE_LOG(LogTemp, Error, TEXT("BattleSystemManager: Failed to create BattleSystemActor"));
+        UE_LOG(LogIdleCombat, Error, TEXT("BattleSystemManager: Failed to create BattleSystemActor"));
         return;
     }
     
@@ -70,14 +71,14 @@ void UBattleSystemManager::CreateBattleSystemActor()
         CombatComponent->OnCombatCompleted.AddDynamic(this, &UBattleSystemManager::OnCombatCompleted);
     }
     
-    UE_LOG(LogTemp, Log, TEXT("BattleSystemManager: Created BattleSystemActor with components"));
+    UE_LOG(LogIdleCombat, Log, TEXT("BattleSystemManager: Created BattleSystemActor with components"));
 }
 
 bool UBattleSystemManager::StartTeamAdventure(const TArray<AC_IdleCharacter*>& TeamMembers, const FString& LocationId)
 {
     if (!LocationEventManager)
     {
-        UE_LOG(LogTemp, Error, TEXT("StartTeamAdventure: LocationEventManager not available"));
+        UE_LOG(LogIdleCombat, Error, TEXT("StartTeamAdventure: LocationEventManager not available"));
         return false;
     }
     
@@ -114,7 +115,7 @@ bool UBattleSystemManager::IsTeamInCombat(const TArray<AC_IdleCharacter*>& TeamM
 
 void UBattleSystemManager::OnCombatCompleted(const TArray<AC_IdleCharacter*>& Winners, const TArray<AC_IdleCharacter*>& Losers, float Duration)
 {
-    UE_LOG(LogTemp, Log, TEXT("BattleSystemManager::OnCombatCompleted - Combat ended"));
+    UE_LOG(LogIdleCombat, Log, TEXT("BattleSystemManager::OnCombatCompleted - Combat ended"));
     
     // PlayerControllerを取得
     UWorld* World = GetWorld();
@@ -127,16 +128,16 @@ void UBattleSystemManager::OnCombatCompleted(const TArray<AC_IdleCharacter*>& Wi
             if (UTeamComponent* TeamComp = PlayerController->GetTeamComponent_Implementation())
             {
                 TeamComp->OnCombatEnd(Winners, Losers);
-                UE_LOG(LogTemp, Log, TEXT("BattleSystemManager: Called TeamComponent->OnCombatEnd"));
+                UE_LOG(LogIdleCombat, Log, TEXT("BattleSystemManager: Called TeamComponent->OnCombatEnd"));
             }
             else
             {
-                UE_LOG(LogTemp, Error, TEXT("BattleSystemManager: TeamComponent not found on PlayerController"));
+                UE_LOG(LogIdleCombat, Error, TEXT("BattleSystemManager: TeamComponent not found on PlayerController"));
             }
         }
         else
         {
-            UE_LOG(LogTemp, Error, TEXT("BattleSystemManager: PlayerController not found"));
+            UE_LOG(LogIdleCombat, Error, TEXT("BattleSystemManager: PlayerController not found"));
         }
     }
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include "../Actor/C_IdleCharacter.h"
 #include "../Components/CharacterStatusComponent.h"
 #include "../Components/InventoryComponent.h"
+#include "SimulationRandomManager.h"
 #include "Engine/World.h"
 #include "GameFramework/PlayerController.h"
 #include "Kismet/GameplayStatics.h"
@@ -180,6 +181,9 @@ AC_IdleCharacter* UCharacterPresetManager::SpawnCharacterFromPreset(
     // キャラクター初期化
     InitializeCharacter(SpawnedCharacter, PresetData);
 
+    // プリセットと呼び出し番号から決まる安定ID（シード設定で番号がリセットされるので再生でも一致する）
+    SpawnedCharacter->SetCharacterId(FGuid::NewDeterministicGuid(PresetId, USimulationRandomManager::NextCallSerial(WorldContextObject)));
+
     return SpawnedCharacter;
 }
 
@@ -278,6 +282,12 @@ FString UCharacterPresetManager::GetRandomEnemyFromLocation(const FString& Locat
     return LocationData.GetRandomEnemyPreset();
 }
 
+FString UCharacterPresetManager::GetRandomEnemyFromLocation(const FString& LocationId, FIdleRandomStream& RandomStream)
+{
+    FLocationDataRow LocationData = GetLocationData(LocationId);
+    return LocationData.GetRandomEnemyPreset(RandomStream.FRand());
+}
+
 void UCharacterPresetManager::LogCharacterPresetError(const FString& PresetId) const
 {
     if (!CharacterPresetDataTable)
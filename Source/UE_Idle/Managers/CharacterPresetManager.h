@@ -5,6 +5,7 @@
 #include "Engine/DataTable.h"
 #include "../Types/CharacterPresetTypes.h"
 #include "../Types/LocationTypes.h"
+#include "../Types/SimulationRandomTypes.h"
 #include "CharacterPresetManager.generated.h"
 
 class AC_IdleCharacter;
@@ -61,6 +62,9 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Location")
     FString GetRandomEnemyFromLocation(const FString& LocationId);
 
+    // 場所からランダム敵取得（シミュレーション乱数ストリーム版）
+    FString GetRandomEnemyFromLocation(const FString& LocationId, FIdleRandomStream& RandomStream);
+
 protected:
     // キャラクターの初期設定
     void InitializeCharacter(AC_IdleCharacter* Character, const FCharacterPresetDataRow& PresetData);
@@ -0,0 +1,92 @@
+#include "CharacterRosterManager.h"
+#include "../UE_Idle.h"
+#include "../Actor/C_IdleCharacter.h"
+#include "../Components/CharacterStatusComponent.h"
+#include "../Components/InventoryComponent.h"
+#include "../Components/CharacterBrain.h"
+#include "Engine/World.h"
+
+void UCharacterRosterManager::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    UE_LOG(LogIdleTime, Log, TEXT("CharacterRosterManager initialized"));
+}
+
+void UCharacterRosterManager::Deinitialize()
+{
+    Characters.Empty();
+    StatusComponents.Empty();
+    InventoryComponents.Empty();
+    Brains.Empty();
+    IndexMap.Empty();
+
+    Super::Deinitialize();
+}
+
+void UCharacterRosterManager::RegisterCharacter(AC_IdleCharacter* Character)
+{
+    if (!IsValid(Character))
+    {
+        return;
+    }
+
+    if (const int32* ExistingIndex = IndexMap.Find(Character))
+    {
+        // 再登録時はコンポーネント参照のみ更新
+        StatusComponents[*ExistingIndex] = Character->GetStatusComponent();
+        InventoryComponents[*ExistingIndex] = Character->GetInventoryComponent();
+        Brains[*ExistingIndex] = Character->GetMyBrain();
+        return;
+    }
+
+    const int32 NewIndex = Characters.Add(Character);
+    StatusComponents.Add(Character->GetStatusComponent());
+    InventoryComponents.Add(Character->GetInventoryComponent());
+    Brains.Add(Character->GetMyBrain());
+    IndexMap.Add(Character, NewIndex);
+
+    UE_LOG(LogIdleTime, Verbose, TEXT("CharacterRosterManager: Registered %s (index %d, total %d)"),
+        *Character->GetName(), NewIndex, Characters.Num());
+}
+
+void UCharacterRosterManager::UnregisterCharacter(AC_IdleCharacter* Character)
+{
+    int32 RemovedIndex = INDEX_NONE;
+    if (!IndexMap.RemoveAndCopyValue(Character, RemovedIndex))
+    {
+        return;
+    }
+
+    const int32 LastIndex = Characters.Num() - 1;
+    if (RemovedIndex != LastIndex)
+    {
+        // 末尾要素を空いた位置へ移動
+        AC_IdleCharacter* MovedCharacter = Characters[LastIndex];
+        IndexMap.Add(MovedCharacter, RemovedIndex);
+    }
+
+    Characters.RemoveAtSwap(RemovedIndex, 1, EAllowShrinking::No);
+    StatusComponents.RemoveAtSwap(RemovedIndex, 1, EAllowShrinking::No);
+    InventoryComponents.RemoveAtSwap(RemovedIndex, 1, EAllowShrinking::No);
+    Brains.RemoveAtSwap(RemovedIndex, 1, EAllowShrinking::No);
+
+    UE_LOG(LogIdleTime, Verbose, TEXT("CharacterRosterManager: Unregistered character (total %d)"), Characters.Num());
+}
+
+int32 UCharacterRosterManager::IndexOf(const AC_IdleCharacter* Character) const
+{
+    const int32* Index = IndexMap.Find(Character);
+    return Index ? *Index : INDEX_NONE;
+}
+
+UCharacterRosterManager* UCharacterRosterManager::Get(const UObject* WorldContextObject)
+{
+    if (!WorldContextObject)
+    {
+        return nullptr;
+    }
+
+    UWorld* World = WorldContextObject->GetWorld();
+    return World ? World->GetSubsystem<UCharacterRosterManager>() : nullptr;
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CharacterRosterManager.generated.h"
+
+class AC_IdleCharacter;
+class UCharacterStatusComponent;
+class UInventoryComponent;
+class UCharacterBrain;
+
+/**
+ * ワールド内のキャラクター名簿
+ * キャラクターはBeginPlayで登録、EndPlayで登録解除される
+ * ターン処理でGetAllActorsOfClass/FindComponentByClassを使わずに済むよう、
+ * キャラクターと主要コンポーネントを密な並列配列で保持する（削除はswap-remove）
+ */
+UCLASS()
+class UE_IDLE_API UCharacterRosterManager : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    // === 登録管理 ===
+
+    /** キャラクターを名簿に登録（登録済みの場合はコンポーネント参照のみ更新） */
+    void RegisterCharacter(AC_IdleCharacter* Character);
+
+    /** キャラクターを名簿から削除（末尾要素と入れ替えて削除） */
+    void UnregisterCharacter(AC_IdleCharacter* Character);
+
+    // === 参照 ===
+
+    /** 登録キャラクター数 */
+    UFUNCTION(BlueprintPure, Category = "Character Roster")
+    int32 Num() const { return Characters.Num(); }
+
+    UFUNCTION(BlueprintPure, Category = "Character Roster")
+    bool Contains(AC_IdleCharacter* Character) const { return IndexMap.Contains(Character); }
+
+    /** 名簿内のインデックス（未登録はINDEX_NONE）。swap-removeにより登録解除で変化する */
+    int32 IndexOf(const AC_IdleCharacter* Character) const;
+
+    // 密な並列配列（同じインデックスが同じキャラクターを指す）
+    const TArray<TObjectPtr<AC_IdleCharacter>>& GetCharacters() const { return Characters; }
+    const TArray<TObjectPtr<UCharacterStatusComponent>>& GetStatusComponents() const { return StatusComponents; }
+    const TArray<TObjectPtr<UInventoryComponent>>& GetInventoryComponents() const { return InventoryComponents; }
+    const TArray<TObjectPtr<UCharacterBrain>>& GetBrains() const { return Brains; }
+
+    // === 能力値の変更番号 ===
+
+    /** キャラクターの能力値（ステータス・才能・装備）が変わったときに呼ぶ */
+    void MarkStatusChanged() { ++StatusVersion; }
+
+    /** 名簿全体の能力値変更番号（タスク完了予測など能力値に依存するキャッシュの無効化用） */
+    uint32 GetStatusVersion() const { return StatusVersion; }
+
+    /** ワールドから名簿を取得するヘルパー */
+    static UCharacterRosterManager* Get(const UObject* WorldContextObject);
+
+private:
+    UPROPERTY()
+    TArray<TObjectPtr<AC_IdleCharacter>> Characters;
+
+    UPROPERTY()
+    TArray<TObjectPtr<UCharacterStatusComponent>> StatusComponents;
+
+    UPROPERTY()
+    TArray<TObjectPtr<UInventoryComponent>> InventoryComponents;
+
+    UPROPERTY()
+    TArray<TObjectPtr<UCharacterBrain>> Brains;
+
+    // キャラクター → 配列インデックス
+    TMap<TObjectKey<AC_IdleCharacter>, int32> IndexMap;
+
+    // ワールドごとに持つ（PIEの複数ワールドで共有しない）
+    uint32 StatusVersion = 0;
+};
@@ -1,10 +1,12 @@
 #include "CombatCalculator.h"
+#include "../UE_Idle.h"
 #include "../Actor/C_IdleCharacter.h"
 #include "../Components/CharacterStatusComponent.h"
 #include "../Components/InventoryComponent.h"
 #include "../Interfaces/IdleCharacterInterface.h"
 #include "ItemDataTableManager.h"
 #include "CharacterPresetManager.h"
+#include "SimulationRandomManager.h"
 #include "Engine/World.h"
 
 FEquipmentPenalty UCombatCalculator::CalculateEquipmentPenalty(AC_IdleCharacter* Character)
@@ -43,7 +45,7 @@ float UCombatCalculator::CalculateAttackSpeed(AC_IdleCharacter* Character, const
     // 事前計算済みの値を取得
     if (!Character || !IsValid(Character))
     {
-        UE_LOG(LogTemp, Warning, TEXT("CalculateAttackSpeed: Invalid character"));
+        UE_LOG(LogIdleCombat, Warning, TEXT("CalculateAttackSpeed: Invalid character"));
         return 1.0f;
     }
 
@@ -55,7 +57,7 @@ float UCombatCalculator::CalculateAttackSpeed(AC_IdleCharacter* Character, const
         {
             CharName = IIdleCharacterInterface::Execute_GetCharacterName(Character);
         }
-        UE_LOG(LogTemp, Warning, TEXT("CalculateAttackSpeed: No status component for character %s"), *CharName);
+        UE_LOG(LogIdleCombat, Warning, TEXT("CalculateAttackSpeed: No status component for character %s"), *CharName);
         return 1.0f;
     }
     
@@ -66,7 +68,7 @@ float UCombatCalculator::CalculateAttackSpeed(AC_IdleCharacter* Character, const
         {
             CharName = IIdleCharacterInterface::Execute_GetCharacterName(Character);
         }
-        UE_LOG(LogTemp, Warning, TEXT("CalculateAttackSpeed: Invalid status component for character %s"), *CharName);
+        UE_LOG(LogIdleCombat, Warning, TEXT("CalculateAttackSpeed: Invalid status component for character %s"), *CharName);
         return 1.0f;
     }
 
@@ -228,6 +230,16 @@ int32 UCombatCalculator::CalculateFinalDamage(int32 BaseDamage, int32 DefenseVal
 }
 
 FCombatCalculationResult UCombatCalculator::PerformCombatCalculation(AC_IdleCharacter* Attacker, AC_IdleCharacter* Defender, const FString& WeaponItemId)
+{
+    // 同じターンに同じ組み合わせで繰り返し呼ばれても別の判定になるよう、呼び出し番号をサブキーに混ぜる
+    const uint64 SubKey = USimulationRandomManager::GetEntityKey(Defender)
+        ^ FIdleRandomStream::Mix(USimulationRandomManager::NextCallSerial(Attacker));
+    FIdleRandomStream RandomStream = USimulationRandomManager::MakeStreamForCurrentTurn(
+        Attacker, EIdleRandomDomain::Combat, USimulationRandomManager::GetEntityKey(Attacker), SubKey);
+    return PerformCombatCalculation(Attacker, Defender, WeaponItemId, RandomStream);
+}
+
+FCombatCalculationResult UCombatCalculator::PerformCombatCalculation(AC_IdleCharacter* Attacker, AC_IdleCharacter* Defender, const FString& WeaponItemId, FIdleRandomStream& RandomStream)
 {
     FCombatCalculationResult Result;
     
@@ -244,7 +256,7 @@ FCombatCalculationResult UCombatCalculator::PerformCombatCalculation(AC_IdleChar
     Result.CriticalChance = CalculateCriticalChance(Attacker, WeaponItemId);
     
     // 判定順序：回避 → 命中 → 受け流し → 盾防御 → クリティカル → ダメージ計算
-    float RandomValue = FMath::FRand() * 100.0f;
+    float RandomValue = RandomStream.FRand() * 100.0f;
     
     // 1. 回避判定
     if (RandomValue < Result.DodgeChance)
@@ -256,7 +268,7 @@ FCombatCalculationResult UCombatCalculator::PerformCombatCalculation(AC_IdleChar
     }
     
     // 2. 命中判定
-    RandomValue = FMath::FRand() * 100.0f;
+    RandomValue = RandomStream.FRand() * 100.0f;
     if (RandomValue >= Result.HitChance)
     {
         Result.bHit = false;
@@ -267,21 +279,21 @@ FCombatCalculationResult UCombatCalculator::PerformCombatCalculation(AC_IdleChar
     Result.bHit = true;
     
     // 3. 受け流し判定
-    RandomValue = FMath::FRand() * 100.0f;
+    RandomValue = RandomStream.FRand() * 100.0f;
     if (RandomValue < Result.ParryChance)
     {
         Result.bParried = true;
     }
     
     // 4. 盾防御判定
-    RandomValue = FMath::FRand() * 100.0f;
+    RandomValue = RandomStream.FRand() * 100.0f;
     if (RandomValue < Result.ShieldChance)
     {
         Result.bShieldBlocked = true;
     }
     
     // 5. クリティカル判定
-    RandomValue = FMath::FRand() * 100.0f;
+    RandomValue = RandomStream.FRand() * 100.0f;
     if (RandomValue < Result.CriticalChance)
     {
         Result.bCritical = true;
@@ -330,7 +342,7 @@ FCharacterTalent UCombatCalculator::GetCharacterTalent(AC_IdleCharacter* Charact
     DefaultTalent.Agility = 10.0f;
     DefaultTalent.Willpower = 10.0f;
     
-    UE_LOG(LogTemp, VeryVerbose, TEXT("GetCharacterTalent: Using safe default values"));
+    UE_LOG(LogIdleCombat, VeryVerbose, TEXT("GetCharacterTalent: Using safe default values"));
     return DefaultTalent;
 }
 
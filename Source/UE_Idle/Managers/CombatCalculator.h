@@ -4,6 +4,7 @@
 #include "UObject/NoExportTypes.h"
 #include "../Types/CombatTypes.h"
 #include "../Types/CharacterTypes.h"
+#include "../Types/SimulationRandomTypes.h"
 #include "CombatCalculator.generated.h"
 
 class AC_IdleCharacter;
@@ -56,10 +57,13 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Combat Calculator")
     static int32 CalculateFinalDamage(int32 BaseDamage, int32 DefenseValue, bool bParried, bool bShieldBlocked, bool bCritical, int32 ShieldDefense = 0, float ShieldSkill = 0.0f);
 
-    // 総合戦闘計算（ワンショット）
+    // 総合戦闘計算（ワンショット、現在ターン・攻撃者・防御者・呼び出し番号をキーにした乱数を使用）
     UFUNCTION(BlueprintCallable, Category = "Combat Calculator")
     static FCombatCalculationResult PerformCombatCalculation(AC_IdleCharacter* Attacker, AC_IdleCharacter* Defender, const FString& WeaponItemId);
 
+    // 総合戦闘計算（呼び出し側が乱数ストリームを指定）
+    static FCombatCalculationResult PerformCombatCalculation(AC_IdleCharacter* Attacker, AC_IdleCharacter* Defender, const FString& WeaponItemId, FIdleRandomStream& RandomStream);
+
 private:
     // ヘルパー関数
     static float GetSkillLevel(AC_IdleCharacter* Character, ESkillType SkillType);
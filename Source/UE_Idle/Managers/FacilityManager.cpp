@@ -1,4 +1,5 @@
 #include "FacilityManager.h"
+#include "../UE_Idle.h"
 #include "Engine/DataTable.h"
 
 void UFacilityManager::Initialize(FSubsystemCollectionBase& Collection)
@@ -30,6 +31,7 @@ void UFacilityManager::ClearAllFacilities()
 {
     UE_LOG(LogTemp, Warning, TEXT("FacilityManager::ClearAllFacilities - Clearing all facility data"));
     FacilityInstances.Empty();
+    ++FacilityStateVersion;
 }
 
 bool UFacilityManager::GetFacilityData(const FString& FacilityId, FFacilityDataRow& OutFacilityData) const
@@ -95,6 +97,7 @@ FGuid UFacilityManager::CreateFacility(const FString& FacilityId, const FVector&
     NewInstance.CompletionProgress = 0.0f;
 
     FacilityInstances.Add(NewInstance.InstanceId, NewInstance);
+    ++FacilityStateVersion;
     
     UE_LOG(LogTemp, Log, TEXT("FacilityManager: Created facility %s at location %s"), 
         *FacilityId, *Location.ToString());
@@ -106,6 +109,7 @@ bool UFacilityManager::DestroyFacility(const FGuid& InstanceId)
 {
     if (FacilityInstances.Remove(InstanceId) > 0)
     {
+        ++FacilityStateVersion;
         UE_LOG(LogTemp, Log, TEXT("FacilityManager: Destroyed facility %s"), *InstanceId.ToString());
         return true;
     }
@@ -210,6 +214,7 @@ bool UFacilityManager::StartConstruction(const FGuid& InstanceId, const TMap<FSt
 
     Instance->State = EFacilityState::Constructing;
     Instance->CompletionProgress = 0.0f;
+    ++FacilityStateVersion;
     
     OnFacilityStateChanged.Broadcast(InstanceId, EFacilityState::Planning, EFacilityState::Constructing);
     
@@ -250,6 +255,7 @@ bool UFacilityManager::StartUpgrade(const FGuid& InstanceId, const TMap<FString,
 
     Instance->State = EFacilityState::Upgrading;
     Instance->CompletionProgress = 0.0f;
+    ++FacilityStateVersion;
     
     OnFacilityStateChanged.Broadcast(InstanceId, EFacilityState::Active, EFacilityState::Upgrading);
     
@@ -332,6 +338,7 @@ bool UFacilityManager::CompleteConstruction(const FGuid& InstanceId)
         return false;
     }
 
+    ++FacilityStateVersion;
     return true;
 }
 
@@ -599,6 +606,7 @@ bool UFacilityManager::SetFacilityState(const FGuid& InstanceId, EFacilityState
 
     EFacilityState OldState = Instance->State;
     Instance->State = NewState;
+    ++FacilityStateVersion;
     
     OnFacilityStateChanged.Broadcast(InstanceId, OldState, NewState);
     
@@ -825,12 +833,26 @@ void UFacilityManager::CheckAndApplyStateTransitions(FFacilityInstance& Instance
     if (NewState != OldState)
     {
         Instance.State = NewState;
+        ++FacilityStateVersion;
         OnFacilityStateChanged.Broadcast(Instance.InstanceId, OldState, NewState);
     }
 }
 
+void UFacilityManager::RestoreFacilities(const TArray<FFacilityInstance>& Instances)
+{
+    FacilityInstances.Empty(Instances.Num());
+    for (const FFacilityInstance& Instance : Instances)
+    {
+        FacilityInstances.Add(Instance.InstanceId, Instance);
+    }
+    ++FacilityStateVersion;
+
+    UE_LOG(LogIdleSim, Log, TEXT("FacilityManager::RestoreFacilities - Restored %d facilities"), Instances.Num());
+}
+
 void UFacilityManager::AddTestFacilityInstance(const FFacilityInstance& Instance)
 {
     FacilityInstances.Add(Instance.InstanceId, Instance);
+    ++FacilityStateVersion;
     UE_LOG(LogTemp, Warning, TEXT("FacilityManager::AddTestFacilityInstance - Added test facility: %s"), *Instance.FacilityId);
 }
\ No newline at end of file
@@ -100,6 +100,9 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Facility Manager")
     TArray<FString> GetUnlockedRecipes() const;
 
+    // 施設の追加・削除・状態・レベルが変わるたびに増える（アンロック結果のキャッシュ無効化用）
+    uint32 GetFacilityStateVersion() const { return FacilityStateVersion; }
+
     UFUNCTION(BlueprintCallable, Category = "Facility Manager")
     TArray<FString> GetUnlockedItems() const;
 
@@ -141,6 +144,9 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Facility Manager")
     void AddTestFacilityInstance(const FFacilityInstance& Instance);
 
+    // 全施設をインスタンスIDごと置き換える（リプレイの開始状態復元用）
+    void RestoreFacilities(const TArray<FFacilityInstance>& Instances);
+
     // イベント
     UPROPERTY(BlueprintAssignable, Category = "Facility Manager")
     FOnFacilityStateChanged OnFacilityStateChanged;
@@ -165,6 +171,9 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings")
     float DurabilityLossPerHour = 10.0f;
 
+    // 施設構成の変更番号
+    uint32 FacilityStateVersion = 0;
+
 private:
     const FFacilityDataRow* FindFacilityByFacilityId(const FString& FacilityId) const;
     TMap<FString, int32> CalculateCostsAtLevel(const TArray<FFacilityResourceCost>& BaseCosts, int32 Level) const;
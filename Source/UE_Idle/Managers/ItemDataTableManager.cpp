@@ -22,6 +22,30 @@ void UItemDataTableManager::SetItemDataTable(UDataTable* InDataTable)
     {
         UE_LOG(LogTemp, Warning, TEXT("ItemDataTable set to null"));
     }
+    
+    BuildItemRowCache();
+}
+
+void UItemDataTableManager::BuildItemRowCache()
+{
+    RowsByItemId.Reset();
+    CachedRowsTable = ItemDataTable;
+    
+    if (!ItemDataTable)
+    {
+        return;
+    }
+    
+    // ItemIdはRowNameとして使用される
+    for (const TPair<FName, uint8*>& Row : ItemDataTable->GetRowMap())
+    {
+        const FSimItemId ItemId = FSimItemId::Intern(Row.Key);
+        if (!RowsByItemId.IsValidIndex(ItemId.GetIndex()))
+        {
+            RowsByItemId.SetNumZeroed(ItemId.GetIndex() + 1);
+        }
+        RowsByItemId[ItemId.GetIndex()] = reinterpret_cast<const FItemDataRow*>(Row.Value);
+    }
 }
 
 bool UItemDataTableManager::GetItemData(const FString& ItemId, FItemDataRow& OutItemData) const
@@ -196,11 +220,32 @@ const FItemDataRow* UItemDataTableManager::FindItemByItemId(const FString& ItemI
         return nullptr;
     }
     
+    // 番号引きの表があれば、FNameを作らずに引く
+    if (CachedRowsTable == ItemDataTable)
+    {
+        return FindItemData(FSimItemId::Find(ItemId));
+    }
+    
     // ItemIdをRowNameとして直接検索
     FItemDataRow* ItemData = ItemDataTable->FindRow<FItemDataRow>(FName(*ItemId), TEXT(""));
     return ItemData;
 }
 
+const FItemDataRow* UItemDataTableManager::FindItemData(FSimItemId ItemId) const
+{
+    if (!ItemDataTable || !ItemId.IsValid())
+    {
+        return nullptr;
+    }
+    
+    if (CachedRowsTable != ItemDataTable)
+    {
+        return ItemDataTable->FindRow<FItemDataRow>(ItemId.ToName(), TEXT(""));
+    }
+    
+    return RowsByItemId.IsValidIndex(ItemId.GetIndex()) ? RowsByItemId[ItemId.GetIndex()] : nullptr;
+}
+
 bool UItemDataTableManager::IsItemEquippable(const FString& ItemId) const
 {
     const FItemDataRow* ItemData = FindItemByItemId(ItemId);
@@ -4,6 +4,7 @@
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "Engine/DataTable.h"
 #include "UE_Idle/Types/ItemDataTable.h"
+#include "UE_Idle/Types/SimIdTypes.h"
 #include "ItemDataTableManager.generated.h"
 
 UCLASS(BlueprintType)
@@ -85,6 +86,9 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Item Manager")
     int32 GetItemModifiedDurability(const FString& ItemId) const;
 
+    // 登録済みアイテムIDからの行参照（番号で配列を引くだけで、文字列検索を行わない）
+    const FItemDataRow* FindItemData(FSimItemId ItemId) const;
+
 protected:
     // DataTable reference - set this in Blueprint or assign programmatically
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Data")
@@ -93,4 +97,13 @@ protected:
 private:
     // Helper function to find item by ItemId field (not row name)
     const FItemDataRow* FindItemByItemId(const FString& ItemId) const;
+
+    // 全行のIDを登録し、アイテムID番号 → 行の表を作る（SetItemDataTableで一度だけ）
+    void BuildItemRowCache();
+
+    // アイテムID番号 → 行（未登録・該当なしはnullptr）
+    TArray<const FItemDataRow*> RowsByItemId;
+
+    // 表を作ったDataTable（SetItemDataTableを経由せずに差し替えられた場合は行名検索に戻す）
+    const UDataTable* CachedRowsTable = nullptr;
 };
\ No newline at end of file
@@ -1,6 +1,22 @@
 #include "LocationDataTableManager.h"
+#include "../UE_Idle.h"
 #include "Engine/DataTable.h"
 
+namespace
+{
+    const TArray<FGatherableItemInfo> EmptyGatherableItems;
+    const TArray<FString> EmptyStringList;
+    
+    // ID番号で引く配列を、新しい番号まで未登録（INDEX_NONE）で伸ばす
+    void GrowIndexMap(TArray<int32>& IndexMap, int32 IdIndex)
+    {
+        while (IndexMap.Num() <= IdIndex)
+        {
+            IndexMap.Add(INDEX_NONE);
+        }
+    }
+}
+
 void ULocationDataTableManager::Initialize(FSubsystemCollectionBase& Collection)
 {
     Super::Initialize(Collection);
@@ -22,6 +38,94 @@ void ULocationDataTableManager::SetLocationDataTable(UDataTable* InDataTable)
     {
         UE_LOG(LogTemp, Warning, TEXT("LocationDataTable set to null"));
     }
+    
+    CompileGatherableMatrix();
+}
+
+void ULocationDataTableManager::CompileGatherableMatrix()
+{
+    LocationIndexById.Reset();
+    LocationRowsById.Reset();
+    CompiledLocationIds.Reset();
+    ItemIndexById.Reset();
+    NumCompiledItems = 0;
+    CompiledTable = LocationDataTable;
+    GatheringCoefficients.Reset();
+    GatherableFlags.Reset();
+    GatherableItemsByLocation.Reset();
+    GatherableItemIdsByLocation.Reset();
+    LocationsByItem.Reset();
+    GatherableLocationIds.Reset();
+    
+    if (!LocationDataTable)
+    {
+        return;
+    }
+    
+    // 1. 全行を一度だけ解析し、場所とアイテムに連番を振る
+    for (const TPair<FName, uint8*>& Row : LocationDataTable->GetRowMap())
+    {
+        const FLocationDataRow* LocationData = reinterpret_cast<const FLocationDataRow*>(Row.Value);
+        if (!LocationData)
+        {
+            continue;
+        }
+        
+        const FString LocationId = Row.Key.ToString();
+        const FSimLocationId LocationKey = FSimLocationId::Intern(LocationId);
+        GrowIndexMap(LocationIndexById, LocationKey.GetIndex());
+        if (!LocationRowsById.IsValidIndex(LocationKey.GetIndex()))
+        {
+            LocationRowsById.SetNumZeroed(LocationKey.GetIndex() + 1);
+        }
+        LocationIndexById[LocationKey.GetIndex()] = CompiledLocationIds.Add(LocationId);
+        LocationRowsById[LocationKey.GetIndex()] = LocationData;
+        
+        TArray<FGatherableItemInfo>& Items = GatherableItemsByLocation.Add_GetRef(LocationData->ParseGatherableItemsList());
+        TArray<FString>& ItemIds = GatherableItemIdsByLocation.AddDefaulted_GetRef();
+        for (const FGatherableItemInfo& Item : Items)
+        {
+            ItemIds.Add(Item.ItemId);
+            
+            const FSimItemId ItemKey = FSimItemId::Intern(Item.ItemId);
+            GrowIndexMap(ItemIndexById, ItemKey.GetIndex());
+            if (ItemIndexById[ItemKey.GetIndex()] == INDEX_NONE)
+            {
+                ItemIndexById[ItemKey.GetIndex()] = LocationsByItem.Num();
+                LocationsByItem.AddDefaulted();
+            }
+        }
+        
+        if (Items.Num() > 0)
+        {
+            GatherableLocationIds.Add(LocationId);
+        }
+    }
+    
+    // 2. 密な係数マトリクスとアイテム別の場所リストを作る
+    NumCompiledItems = LocationsByItem.Num();
+    const int32 NumItems = NumCompiledItems;
+    GatheringCoefficients.SetNumZeroed(CompiledLocationIds.Num() * NumItems);
+    GatherableFlags.Init(false, CompiledLocationIds.Num() * NumItems);
+    
+    for (int32 LocationIndex = 0; LocationIndex < CompiledLocationIds.Num(); ++LocationIndex)
+    {
+        for (const FGatherableItemInfo& Item : GatherableItemsByLocation[LocationIndex])
+        {
+            const int32 ItemIndex = GetCompiledItemIndex(FSimItemId::Find(Item.ItemId));
+            const int32 CellIndex = LocationIndex * NumItems + ItemIndex;
+            GatheringCoefficients[CellIndex] = Item.GatheringCoefficient;
+            
+            if (!GatherableFlags[CellIndex])
+            {
+                GatherableFlags[CellIndex] = true;
+                LocationsByItem[ItemIndex].Add(CompiledLocationIds[LocationIndex]);
+            }
+        }
+    }
+    
+    UE_LOG(LogIdleSim, Log, TEXT("LocationDataTableManager: Compiled gatherable matrix (%d locations x %d items)"), 
+        CompiledLocationIds.Num(), NumItems);
 }
 
 bool ULocationDataTableManager::GetLocationData(const FString& LocationId, FLocationDataRow& OutLocationData) const
@@ -71,12 +175,7 @@ bool ULocationDataTableManager::IsValidLocation(const FString& LocationId) const
 
 bool ULocationDataTableManager::HasGatherableItems(const FString& LocationId) const
 {
-    FLocationDataRow LocationData;
-    if (GetLocationData(LocationId, LocationData))
-    {
-        return LocationData.HasGatherableItems();
-    }
-    return false;
+    return GetGatherableItemInfos(LocationId).Num() > 0;
 }
 
 TArray<FLocationDataRow> ULocationDataTableManager::GetAllLocations() const
@@ -189,12 +288,7 @@ bool ULocationDataTableManager::IsLocationWalkable(const FString& LocationId) co
 
 TArray<FGatherableItemInfo> ULocationDataTableManager::GetGatherableItems(const FString& LocationId) const
 {
-    FLocationDataRow LocationData;
-    if (GetLocationData(LocationId, LocationData))
-    {
-        return LocationData.ParseGatherableItemsList();
-    }
-    return TArray<FGatherableItemInfo>();
+    return GetGatherableItemInfos(LocationId);
 }
 
 TArray<FString> ULocationDataTableManager::GetLocationEnemiesList(const FString& LocationId) const
@@ -236,24 +330,69 @@ TArray<FString> ULocationDataTableManager::GetAllValidLocationIds() const
 
 TArray<FString> ULocationDataTableManager::GetGatherableLocationIds() const
 {
-    TArray<FString> GatherableLocationIds;
-    
-    if (!LocationDataTable)
-    {
-        return GatherableLocationIds;
-    }
+    return GatherableLocationIds;
+}
 
-    TArray<FName> RowNames = LocationDataTable->GetRowNames();
-    for (const FName& RowName : RowNames)
+const TArray<FGatherableItemInfo>& ULocationDataTableManager::GetGatherableItemInfos(const FString& LocationId) const
+{
+    const int32 LocationIndex = GetCompiledLocationIndex(FSimLocationId::Find(LocationId));
+    return LocationIndex != INDEX_NONE ? GatherableItemsByLocation[LocationIndex] : EmptyGatherableItems;
+}
+
+const TArray<FString>& ULocationDataTableManager::GetGatherableItemIds(const FString& LocationId) const
+{
+    const int32 LocationIndex = GetCompiledLocationIndex(FSimLocationId::Find(LocationId));
+    return LocationIndex != INDEX_NONE ? GatherableItemIdsByLocation[LocationIndex] : EmptyStringList;
+}
+
+const TArray<FString>& ULocationDataTableManager::GetLocationsForItem(const FString& ItemId) const
+{
+    return GetLocationsForItem(FSimItemId::Find(ItemId));
+}
+
+const TArray<FString>& ULocationDataTableManager::GetLocationsForItem(FSimItemId ItemId) const
+{
+    const int32 ItemIndex = GetCompiledItemIndex(ItemId);
+    return ItemIndex != INDEX_NONE ? LocationsByItem[ItemIndex] : EmptyStringList;
+}
+
+float ULocationDataTableManager::GetGatheringCoefficient(const FString& LocationId, const FString& ItemId) const
+{
+    return GetGatheringCoefficient(FSimLocationId::Find(LocationId), FSimItemId::Find(ItemId));
+}
+
+float ULocationDataTableManager::GetGatheringCoefficient(FSimLocationId LocationId, FSimItemId ItemId) const
+{
+    const int32 LocationIndex = GetCompiledLocationIndex(LocationId);
+    const int32 ItemIndex = GetCompiledItemIndex(ItemId);
+    if (LocationIndex == INDEX_NONE || ItemIndex == INDEX_NONE)
     {
-        FLocationDataRow* LocationData = LocationDataTable->FindRow<FLocationDataRow>(RowName, TEXT(""));
-        if (LocationData && LocationData->HasGatherableItems())
-        {
-            GatherableLocationIds.Add(RowName.ToString());
-        }
+        return 0.0f;
     }
     
-    return GatherableLocationIds;
+    return GatheringCoefficients[LocationIndex * NumCompiledItems + ItemIndex];
+}
+
+bool ULocationDataTableManager::CanGatherItemAt(const FString& LocationId, const FString& ItemId) const
+{
+    return CanGatherItemAt(FSimLocationId::Find(LocationId), FSimItemId::Find(ItemId));
+}
+
+bool ULocationDataTableManager::CanGatherItemAt(FSimLocationId LocationId, FSimItemId ItemId) const
+{
+    const int32 LocationIndex = GetCompiledLocationIndex(LocationId);
+    const int32 ItemIndex = GetCompiledItemIndex(ItemId);
+    return LocationIndex != INDEX_NONE && ItemIndex != INDEX_NONE && GatherableFlags[LocationIndex * NumCompiledItems + ItemIndex];
+}
+
+int32 ULocationDataTableManager::GetCompiledLocationIndex(FSimLocationId LocationId) const
+{
+    return LocationIndexById.IsValidIndex(LocationId.GetIndex()) ? LocationIndexById[LocationId.GetIndex()] : INDEX_NONE;
+}
+
+int32 ULocationDataTableManager::GetCompiledItemIndex(FSimItemId ItemId) const
+{
+    return ItemIndexById.IsValidIndex(ItemId.GetIndex()) ? ItemIndexById[ItemId.GetIndex()] : INDEX_NONE;
 }
 
 const FLocationDataRow* ULocationDataTableManager::FindLocationByLocationId(const FString& LocationId) const
@@ -263,8 +402,29 @@ const FLocationDataRow* ULocationDataTableManager::FindLocationByLocationId(cons
         return nullptr;
     }
 
+    // マトリクス構築時の番号引きの表があれば、FNameを作らずに引く
+    if (CompiledTable == LocationDataTable)
+    {
+        return FindLocationData(FSimLocationId::Find(LocationId));
+    }
+
     // LocationIdはRowNameとして使用される
     FName RowName(*LocationId);
     return LocationDataTable->FindRow<FLocationDataRow>(RowName, TEXT(""));
 }
 
+const FLocationDataRow* ULocationDataTableManager::FindLocationData(FSimLocationId LocationId) const
+{
+    if (!LocationDataTable || !LocationId.IsValid())
+    {
+        return nullptr;
+    }
+
+    if (CompiledTable != LocationDataTable)
+    {
+        return LocationDataTable->FindRow<FLocationDataRow>(LocationId.ToName(), TEXT(""));
+    }
+
+    return LocationRowsById.IsValidIndex(LocationId.GetIndex()) ? LocationRowsById[LocationId.GetIndex()] : nullptr;
+}
+
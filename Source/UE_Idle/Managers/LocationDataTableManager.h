@@ -4,6 +4,7 @@
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "Engine/DataTable.h"
 #include "UE_Idle/Types/LocationTypes.h"
+#include "UE_Idle/Types/SimIdTypes.h"
 #include "LocationDataTableManager.generated.h"
 
 UCLASS(BlueprintType)
@@ -75,6 +76,34 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Location Manager")
     TArray<FString> GetGatherableLocationIds() const;
 
+    // === 採集可能マトリクス（SetLocationDataTableで一度だけ構築） ===
+
+    // 場所で採集できるアイテム（DataTableの記載順）。未知の場所は空
+    const TArray<FGatherableItemInfo>& GetGatherableItemInfos(const FString& LocationId) const;
+
+    // 場所で採集できるアイテムID（DataTableの記載順）。未知の場所は空
+    const TArray<FString>& GetGatherableItemIds(const FString& LocationId) const;
+
+    // アイテムを採集できる場所ID（DataTableの行順）
+    const TArray<FString>& GetLocationsForItem(const FString& ItemId) const;
+
+    // 採取係数（採集不可は0）
+    UFUNCTION(BlueprintPure, Category = "Location Manager")
+    float GetGatheringCoefficient(const FString& LocationId, const FString& ItemId) const;
+
+    // 場所でアイテムを採集できるか
+    UFUNCTION(BlueprintPure, Category = "Location Manager")
+    bool CanGatherItemAt(const FString& LocationId, const FString& ItemId) const;
+
+    // マトリクスに登録された場所か
+    bool HasCompiledLocation(const FString& LocationId) const { return GetCompiledLocationIndex(FSimLocationId::Find(LocationId)) != INDEX_NONE; }
+
+    // 登録済みIDでの参照（文字列検索なし）
+    const TArray<FString>& GetLocationsForItem(FSimItemId ItemId) const;
+    float GetGatheringCoefficient(FSimLocationId LocationId, FSimItemId ItemId) const;
+    bool CanGatherItemAt(FSimLocationId LocationId, FSimItemId ItemId) const;
+    const FLocationDataRow* FindLocationData(FSimLocationId LocationId) const;
+
 protected:
     // DataTable reference - set this in Blueprint or assign programmatically
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Data")
@@ -83,4 +112,39 @@ protected:
 private:
     // Helper function to find location by LocationId field (not row name)
     const FLocationDataRow* FindLocationByLocationId(const FString& LocationId) const;
+
+    // GatherableItemsStringを全行分解析して場所×アイテムの係数マトリクスを作る
+    void CompileGatherableMatrix();
+
+    // ID番号 → マトリクスのインデックス（未登録はINDEX_NONE）
+    int32 GetCompiledLocationIndex(FSimLocationId LocationId) const;
+    int32 GetCompiledItemIndex(FSimItemId ItemId) const;
+
+    // 場所ID番号 → 場所インデックス / 行（DataTableの行名がそのまま場所ID）
+    TArray<int32> LocationIndexById;
+    TArray<const FLocationDataRow*> LocationRowsById;
+    TArray<FString> CompiledLocationIds;
+
+    // アイテムID番号 → アイテムインデックス
+    TArray<int32> ItemIndexById;
+    int32 NumCompiledItems = 0;
+
+    // マトリクスを作ったDataTable（SetLocationDataTableを経由せずに差し替えられた場合は行名検索に戻す）
+    const UDataTable* CompiledTable = nullptr;
+
+    // 採取係数 [場所インデックス * アイテム数 + アイテムインデックス]（採集不可は0）
+    TArray<float> GatheringCoefficients;
+
+    // 採集可否 [同上]（係数0でも記載があれば採集可能）
+    TBitArray<> GatherableFlags;
+
+    // 場所インデックス → 採集可能アイテム
+    TArray<TArray<FGatherableItemInfo>> GatherableItemsByLocation;
+    TArray<TArray<FString>> GatherableItemIdsByLocation;
+
+    // アイテムインデックス → 採集可能な場所ID
+    TArray<TArray<FString>> LocationsByItem;
+
+    // 採集可能アイテムを持つ場所ID
+    TArray<FString> GatherableLocationIds;
 };
\ No newline at end of file
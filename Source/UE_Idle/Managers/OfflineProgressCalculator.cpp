@@ -0,0 +1,711 @@
+#include "OfflineProgressCalculator.h"
+#include "../UE_Idle.h"
+#include "../C_PlayerController.h"
+#include "../Actor/C_IdleCharacter.h"
+#include "../Components/TeamComponent.h"
+#include "../Components/TaskManagerComponent.h"
+#include "../Components/LocationMovementComponent.h"
+#include "../Components/InventoryComponent.h"
+#include "../Components/BaseComponent.h"
+#include "../Components/CharacterBrain.h"
+#include "LocationDataTableManager.h"
+#include "Engine/GameInstance.h"
+
+namespace
+{
+    /**
+     * 1チーム分の周期モデル
+     * ターン軸: [0, LeadTurns) 初回移動 → FirstGatherTurns 採集 → 以降
+     * (帰還 TravelTurns → 荷下ろし UnloadTurns → 出発 TravelTurns → 採集 SteadyGatherTurns) の繰り返し
+     */
+    struct FOfflineTeamPlan
+    {
+        int32 TeamIndex = -1;
+        FString ItemId;
+        FString LocationId;
+        FString StartLocationId;
+        FString TaskId;
+
+        int32 YieldPerTurn = 0;
+        int32 TravelTurns = 0;
+        int32 UnloadTurns = UOfflineProgressCalculator::UnloadTurns;
+        int32 LeadTurns = 0;
+        int32 FirstGatherTurns = 0;
+        int32 SteadyGatherTurns = 0;
+
+        // 採集前に開始時の所持品を荷下ろしするか（荷下ろし完了ターン）
+        bool bPreUnload = false;
+        int32 PreUnloadTurn = -1;
+
+        // タスク目標到達で採集を止めるターン（INDEX_NONEは打ち切りなし）
+        int32 CutoffTurn = INDEX_NONE;
+
+        int32 GetPeriod() const { return TravelTurns * 2 + UnloadTurns + SteadyGatherTurns; }
+        int32 GetFirstUnloadTurn() const { return LeadTurns + FirstGatherTurns + TravelTurns + UnloadTurns; }
+
+        /** ターン[0, Turn)の総採集量 */
+        int64 GatheredBy(int32 Turn) const
+        {
+            if (CutoffTurn != INDEX_NONE)
+            {
+                Turn = FMath::Min(Turn, CutoffTurn);
+            }
+
+            int32 Elapsed = Turn - LeadTurns;
+            if (Elapsed <= 0)
+            {
+                return 0;
+            }
+            if (Elapsed <= FirstGatherTurns)
+            {
+                return (int64)Elapsed * YieldPerTurn;
+            }
+
+            Elapsed -= FirstGatherTurns;
+            const int32 GatherOffset = TravelTurns * 2 + UnloadTurns;
+            const int64 FullPeriods = Elapsed / GetPeriod();
+            const int32 Remainder = Elapsed % GetPeriod();
+            return ((int64)FirstGatherTurns + FullPeriods * SteadyGatherTurns + FMath::Max(0, Remainder - GatherOffset)) * YieldPerTurn;
+        }
+
+        /** ターン[0, Turn)に荷下ろし済みの採集量（開始時所持品を除く、打ち切りは考慮しない） */
+        int64 DeliveredBy(int32 Turn) const
+        {
+            const int32 FirstUnload = GetFirstUnloadTurn();
+            if (Turn < FirstUnload)
+            {
+                return 0;
+            }
+            const int64 Unloads = 1 + (Turn - FirstUnload) / GetPeriod();
+            return ((int64)FirstGatherTurns + (Unloads - 1) * SteadyGatherTurns) * YieldPerTurn;
+        }
+
+        /** ターン終了時点の滞在場所（移動途中は出発地として扱う） */
+        FString GetLocationAt(int32 Turn) const
+        {
+            if (Turn < LeadTurns)
+            {
+                return (bPreUnload && Turn >= PreUnloadTurn) ? TEXT("base") : StartLocationId;
+            }
+
+            const int32 Elapsed = Turn - LeadTurns - FirstGatherTurns;
+            if (Elapsed < 0)
+            {
+                return LocationId;
+            }
+
+            const int32 Phase = Elapsed % GetPeriod();
+            if (Phase < TravelTurns)
+            {
+                return LocationId;
+            }
+            if (Phase < TravelTurns * 2 + UnloadTurns)
+            {
+                return TEXT("base");
+            }
+            return LocationId;
+        }
+    };
+
+    int32 ClampToInt32(int64 Value)
+    {
+        return (int32)FMath::Clamp<int64>(Value, 0, MAX_int32);
+    }
+
+    void AddSegment(FOfflineProgressResult& Result, const FOfflineTeamPlan& Plan, EOfflineSegmentType Type,
+        int32 StartTurn, int32 EndTurn, const FString& LocationId, int32 Quantity, int32 RepeatCount = 1)
+    {
+        EndTurn = FMath::Min(EndTurn, Result.SimulatedTurns);
+        if (EndTurn <= StartTurn)
+        {
+            return;
+        }
+
+        FOfflineProgressSegment& Segment = Result.Segments.AddDefaulted_GetRef();
+        Segment.TeamIndex = Plan.TeamIndex;
+        Segment.SegmentType = Type;
+        Segment.StartTurn = StartTurn;
+        Segment.EndTurn = EndTurn;
+        Segment.RepeatCount = RepeatCount;
+        Segment.LocationId = LocationId;
+        Segment.ItemId = Type == EOfflineSegmentType::Travel ? FString() : Plan.ItemId;
+        Segment.Quantity = Quantity;
+    }
+
+    /** 区間一覧を生成（レポート用、数量はモデルから算出） */
+    void EmitTeamSegments(FOfflineProgressResult& Result, const FOfflineTeamPlan& Plan, bool bReturnedHome)
+    {
+        const int32 TotalTurns = Result.SimulatedTurns;
+        const int32 GatherEnd = Plan.CutoffTurn != INDEX_NONE ? FMath::Min(Plan.CutoffTurn, TotalTurns) : TotalTurns;
+
+        // 初回移動（必要なら先に拠点で荷下ろし）
+        if (Plan.bPreUnload)
+        {
+            AddSegment(Result, Plan, EOfflineSegmentType::Travel, 0, Plan.PreUnloadTurn - Plan.UnloadTurns, TEXT("base"), 0);
+            AddSegment(Result, Plan, EOfflineSegmentType::Unload, Plan.PreUnloadTurn - Plan.UnloadTurns, Plan.PreUnloadTurn, TEXT("base"), 0);
+            AddSegment(Result, Plan, EOfflineSegmentType::Travel, Plan.PreUnloadTurn, Plan.LeadTurns, Plan.LocationId, 0);
+        }
+        else
+        {
+            AddSegment(Result, Plan, EOfflineSegmentType::Travel, 0, Plan.LeadTurns, Plan.LocationId, 0);
+        }
+
+        // 初回採集
+        const int32 FirstGatherEnd = FMath::Min(Plan.LeadTurns + Plan.FirstGatherTurns, GatherEnd);
+        AddSegment(Result, Plan, EOfflineSegmentType::Gathering, Plan.LeadTurns, FirstGatherEnd, Plan.LocationId,
+            ClampToInt32(Plan.GatheredBy(FirstGatherEnd)));
+
+        // 定常周期はまとめて1区間、端数は1区間
+        const int32 CycleStart = Plan.LeadTurns + Plan.FirstGatherTurns;
+        if (GatherEnd > CycleStart)
+        {
+            const int32 Period = Plan.GetPeriod();
+            const int32 FullPeriods = (GatherEnd - CycleStart) / Period;
+            const int32 FullEnd = CycleStart + FullPeriods * Period;
+            AddSegment(Result, Plan, EOfflineSegmentType::Cycle, CycleStart, FullEnd, Plan.LocationId,
+                ClampToInt32(Plan.GatheredBy(FullEnd) - Plan.GatheredBy(CycleStart)), FullPeriods);
+            AddSegment(Result, Plan, EOfflineSegmentType::Cycle, FullEnd, GatherEnd, Plan.LocationId,
+                ClampToInt32(Plan.GatheredBy(GatherEnd) - Plan.GatheredBy(FullEnd)));
+        }
+
+        // 目標到達後：帰還して待機
+        if (GatherEnd < TotalTurns)
+        {
+            int32 IdleStart = GatherEnd;
+            if (bReturnedHome)
+            {
+                AddSegment(Result, Plan, EOfflineSegmentType::Travel, GatherEnd, GatherEnd + Plan.TravelTurns, TEXT("base"), 0);
+                AddSegment(Result, Plan, EOfflineSegmentType::Unload, GatherEnd + Plan.TravelTurns,
+                    GatherEnd + Plan.TravelTurns + Plan.UnloadTurns, TEXT("base"), 0);
+                IdleStart = GatherEnd + Plan.TravelTurns + Plan.UnloadTurns;
+            }
+            AddSegment(Result, Plan, EOfflineSegmentType::Idle, IdleStart, TotalTurns,
+                bReturnedHome ? TEXT("base") : Plan.LocationId, 0);
+        }
+    }
+
+    int32 CountCarriedItems(const FTeam& Team)
+    {
+        int32 Total = 0;
+        for (AC_IdleCharacter* Member : Team.Members)
+        {
+            if (IsValid(Member) && Member->GetInventoryComponent())
+            {
+                for (const auto& Item : Member->GetInventoryComponent()->GetAllItems())
+                {
+                    Total += Item.Value;
+                }
+            }
+        }
+        return Total;
+    }
+
+    int32 CountTeamItem(const FTeam& Team, const FString& ItemId)
+    {
+        int32 Total = 0;
+        for (AC_IdleCharacter* Member : Team.Members)
+        {
+            if (IsValid(Member) && Member->GetInventoryComponent())
+            {
+                Total += Member->GetInventoryComponent()->GetItemCount(ItemId);
+            }
+        }
+        return Total;
+    }
+
+    /** 採集を行うチームごとの周期モデルを現在の状態から作る（ワールド状態は変更しない） */
+    void BuildTeamPlans(AC_PlayerController* PlayerController, TArray<FOfflineTeamPlan>& OutPlans)
+    {
+        UTeamComponent* TeamComp = PlayerController->TeamComponent;
+        UTaskManagerComponent* TaskManager = PlayerController->TaskManager;
+        ULocationMovementComponent* MovementComp = PlayerController->MovementComponent;
+        if (!TeamComp || !TaskManager || !MovementComp)
+        {
+            return;
+        }
+
+        // Brainと同じ探索候補（拠点 → DataTableの採集可能な場所）
+        UGameInstance* GameInstance = PlayerController->GetGameInstance();
+        TArray<FString> GatheringCandidates;
+        UCharacterBrain::GetGatheringCandidateLocations(
+            GameInstance ? GameInstance->GetSubsystem<ULocationDataTableManager>() : nullptr, GatheringCandidates);
+        GatheringCandidates.Insert(TEXT("base"), 0);
+
+        const TArray<FTeam> Teams = TeamComp->GetAllTeams();
+        for (int32 TeamIndex = 0; TeamIndex < Teams.Num(); TeamIndex++)
+        {
+            const FTeam& Team = Teams[TeamIndex];
+            if (!Team.IsValidTeam() || Team.Members.Num() == 0 || Team.bInCombat)
+            {
+                continue;
+            }
+            if (Team.AssignedTask != ETaskType::Gathering && Team.AssignedTask != ETaskType::All)
+            {
+                continue;
+            }
+
+            // 現在地と移動状態
+            const FMovementInfo MovementInfo = MovementComp->GetMovementInfo(TeamIndex);
+            const bool bMoving = MovementInfo.State == EMovementState::MovingToDestination || MovementInfo.State == EMovementState::MovingToBase;
+            FString CurrentLocation = TEXT("base");
+            if (bMoving)
+            {
+                CurrentLocation = MovementInfo.FromLocation;
+            }
+            else if (MovementInfo.State == EMovementState::Arrived)
+            {
+                CurrentLocation = MovementInfo.ToLocation;
+            }
+            else if (MovementComp->GetCurrentDistanceFromBase(TeamIndex) > 0.1f && !Team.GatheringLocationId.IsEmpty())
+            {
+                CurrentLocation = Team.GatheringLocationId;
+            }
+
+            // 採集場所とターゲットアイテム（開始時点で固定、Brainと同じ探索順）
+            TArray<FString> Candidates;
+            if (MovementInfo.State == EMovementState::MovingToDestination)
+            {
+                Candidates.Add(MovementInfo.ToLocation);
+            }
+            else if (!bMoving && CurrentLocation != TEXT("base"))
+            {
+                Candidates.Add(CurrentLocation);
+            }
+            if (!Team.GatheringLocationId.IsEmpty())
+            {
+                Candidates.AddUnique(Team.GatheringLocationId);
+            }
+            for (const FString& Location : GatheringCandidates)
+            {
+                Candidates.AddUnique(Location);
+            }
+
+            FOfflineTeamPlan Plan;
+            Plan.TeamIndex = TeamIndex;
+            for (const FString& Candidate : Candidates)
+            {
+                const FString Item = TaskManager->GetTargetItemForTeam(TeamIndex, Candidate);
+                if (!Item.IsEmpty())
+                {
+                    Plan.ItemId = Item;
+                    Plan.LocationId = Candidate;
+                    break;
+                }
+            }
+            if (Plan.ItemId.IsEmpty())
+            {
+                continue;
+            }
+
+            // 1ターンあたりの採集量（ExecuteGatheringと同じ配分を、行動する全メンバー分）
+            int32 ValidMembers = 0;
+            for (AC_IdleCharacter* Member : Team.Members)
+            {
+                if (IsValid(Member))
+                {
+                    ValidMembers++;
+                }
+            }
+            const int32 GatheringAmount = TaskManager->CalculateGatheringAmount(TeamIndex, Plan.ItemId, Plan.LocationId);
+            const int32 AmountPerMember = FMath::Max(1, GatheringAmount / Team.Members.Num());
+            const int32 AmountPerAction = FMath::Min(GatheringAmount, AmountPerMember * ValidMembers);
+            Plan.YieldPerTurn = AmountPerAction * ValidMembers;
+            if (Plan.YieldPerTurn <= 0)
+            {
+                continue;
+            }
+
+            // 移動ターン数（ProcessMovementは1ターンで1秒分進む）
+            const float Speed = MovementComp->CalculateTeamMovementSpeed(TeamIndex);
+            auto TravelTurnsTo = [&](const FString& Location)
+            {
+                const float Distance = MovementComp->GetLocationDistanceFromBase(Location);
+                return (Distance > 0.0f && Speed > 0.0f) ? FMath::CeilToInt(Distance / Speed) : 0;
+            };
+            Plan.TravelTurns = TravelTurnsTo(Plan.LocationId);
+
+            const int32 CarryLimit = CarryLimitPerMember * ValidMembers;
+            const int32 InitialCarried = CountCarriedItems(Team);
+
+            // 拠点での採集は所持品があれば毎ターン荷下ろしする
+            Plan.SteadyGatherTurns = Plan.LocationId == TEXT("base") ? 1 : FMath::Max(1, FMath::DivideAndRoundUp(CarryLimit, Plan.YieldPerTurn));
+            Plan.StartLocationId = CurrentLocation;
+
+            const int32 RemainingTravel = bMoving ? FMath::CeilToInt(MovementInfo.RemainingTime) : 0;
+            if (MovementInfo.State == EMovementState::MovingToDestination && MovementInfo.ToLocation == Plan.LocationId)
+            {
+                Plan.LeadTurns = RemainingTravel;
+            }
+            else if (MovementInfo.State == EMovementState::MovingToBase)
+            {
+                Plan.bPreUnload = true;
+                Plan.PreUnloadTurn = RemainingTravel + Plan.UnloadTurns;
+            }
+            else if (bMoving)
+            {
+                // 別の場所へ移動中：到着後に拠点経由で向かう
+                Plan.bPreUnload = true;
+                Plan.PreUnloadTurn = RemainingTravel + TravelTurnsTo(MovementInfo.ToLocation) + Plan.UnloadTurns;
+            }
+            else if (CurrentLocation == TEXT("base"))
+            {
+                if (InitialCarried > 0)
+                {
+                    Plan.bPreUnload = true;
+                    Plan.PreUnloadTurn = Plan.UnloadTurns;
+                }
+            }
+            else if (CurrentLocation != Plan.LocationId || InitialCarried >= CarryLimit)
+            {
+                Plan.bPreUnload = true;
+                Plan.PreUnloadTurn = TravelTurnsTo(CurrentLocation) + Plan.UnloadTurns;
+            }
+
+            if (Plan.bPreUnload)
+            {
+                Plan.LeadTurns = Plan.PreUnloadTurn + Plan.TravelTurns;
+                Plan.FirstGatherTurns = Plan.SteadyGatherTurns;
+            }
+            else
+            {
+                if (CurrentLocation == TEXT("base") && Plan.LocationId != TEXT("base"))
+                {
+                    Plan.LeadTurns = Plan.TravelTurns;
+                }
+                Plan.FirstGatherTurns = Plan.LocationId == TEXT("base") ? 1 :
+                    FMath::Max(1, FMath::DivideAndRoundUp(CarryLimit - InitialCarried, Plan.YieldPerTurn));
+            }
+
+            const FGlobalTask ActiveTask = TaskManager->FindActiveGatheringTask(Plan.ItemId);
+            Plan.TaskId = ActiveTask.TaskId;
+
+            OutPlans.Add(Plan);
+        }
+    }
+
+    /**
+     * 個数指定・キープ型タスクの目標到達ターンを求め、担当チームの採集打ち切りターンに設定する
+     * 同じタスクを共有するチームの累積採集量は単調増加なので、目標に届く最小ターンを二分探索する
+     * @param HorizonTurns 探索範囲（これ以内に届かないタスクは打ち切りなし）
+     * @param OutCutoffs タスクID → 目標到達ターン（nullptr可、届かないタスクは含めない）
+     */
+    void ResolveTaskCutoffs(AC_PlayerController* PlayerController, TArray<FOfflineTeamPlan>& Plans, int32 HorizonTurns,
+        TMap<FString, int32>* OutCutoffs)
+    {
+        UTeamComponent* TeamComp = PlayerController->TeamComponent;
+        UTaskManagerComponent* TaskManager = PlayerController->TaskManager;
+        UInventoryComponent* Storage = PlayerController->GlobalInventory;
+        if (!TeamComp || !TaskManager)
+        {
+            return;
+        }
+
+        TMap<FString, TArray<int32>> PlansByTask;
+        for (int32 PlanIndex = 0; PlanIndex < Plans.Num(); PlanIndex++)
+        {
+            if (!Plans[PlanIndex].TaskId.IsEmpty())
+            {
+                PlansByTask.FindOrAdd(Plans[PlanIndex].TaskId).Add(PlanIndex);
+            }
+        }
+
+        for (const auto& TaskPlans : PlansByTask)
+        {
+            const int32 TaskIndex = TaskManager->FindTaskByID(TaskPlans.Key);
+            if (TaskIndex < 0)
+            {
+                continue;
+            }
+
+            const FGlobalTask& Task = TaskManager->GetGlobalTasks()[TaskIndex];
+            int64 Remaining = 0;
+            if (Task.GatheringQuantityType == EGatheringQuantityType::Specified)
+            {
+                Remaining = Task.TargetQuantity - Task.CurrentProgress;
+            }
+            else if (Task.GatheringQuantityType == EGatheringQuantityType::Keep)
+            {
+                int64 Available = Storage ? Storage->GetItemCount(Task.TargetItemId) : 0;
+                for (int32 PlanIndex : TaskPlans.Value)
+                {
+                    Available += CountTeamItem(TeamComp->GetTeam(Plans[PlanIndex].TeamIndex), Task.TargetItemId);
+                }
+                Remaining = Task.TargetQuantity - Available;
+            }
+            else
+            {
+                continue;
+            }
+
+            auto TotalGatheredBy = [&](int32 Turn)
+            {
+                int64 Total = 0;
+                for (int32 PlanIndex : TaskPlans.Value)
+                {
+                    Total += Plans[PlanIndex].GatheredBy(Turn);
+                }
+                return Total;
+            };
+
+            int32 Cutoff = INDEX_NONE;
+            if (Remaining <= 0)
+            {
+                Cutoff = 0;
+            }
+            else if (TotalGatheredBy(HorizonTurns) >= Remaining)
+            {
+                int32 Low = 1;
+                int32 High = HorizonTurns;
+                while (Low < High)
+                {
+                    const int32 Mid = Low + (High - Low) / 2;
+                    if (TotalGatheredBy(Mid) >= Remaining)
+                    {
+                        High = Mid;
+                    }
+                    else
+                    {
+                        Low = Mid + 1;
+                    }
+                }
+                Cutoff = Low;
+            }
+
+            for (int32 PlanIndex : TaskPlans.Value)
+            {
+                Plans[PlanIndex].CutoffTurn = Cutoff;
+            }
+
+            if (OutCutoffs && Cutoff != INDEX_NONE)
+            {
+                OutCutoffs->Add(TaskPlans.Key, Cutoff);
+            }
+        }
+    }
+
+    /** 目標到達までのターン数（OnlyTaskIdsがあればそのタスクを担当するチームだけ評価する） */
+    TMap<FString, int32> ForecastCompletionTurns(AC_PlayerController* PlayerController, int32 HorizonTurns,
+        const TSet<FString>* OnlyTaskIds)
+    {
+        TMap<FString, int32> TurnsByTask;
+        if (!IsValid(PlayerController) || HorizonTurns <= 0)
+        {
+            return TurnsByTask;
+        }
+
+        // オフライン進行と同じ周期モデルで、目標到達までのターン数だけを求める
+        TArray<FOfflineTeamPlan> Plans;
+        BuildTeamPlans(PlayerController, Plans);
+        if (OnlyTaskIds)
+        {
+            Plans.RemoveAll([OnlyTaskIds](const FOfflineTeamPlan& Plan) { return !OnlyTaskIds->Contains(Plan.TaskId); });
+        }
+        ResolveTaskCutoffs(PlayerController, Plans, HorizonTurns, &TurnsByTask);
+
+        return TurnsByTask;
+    }
+}
+
+TMap<FString, int32> UOfflineProgressCalculator::ForecastTaskCompletionTurns(AC_PlayerController* PlayerController, int32 HorizonTurns)
+{
+    return ForecastCompletionTurns(PlayerController, HorizonTurns, nullptr);
+}
+
+TMap<FString, int32> UOfflineProgressCalculator::ForecastTaskCompletionTurnsFor(AC_PlayerController* PlayerController, int32 HorizonTurns,
+    const TSet<FString>& TaskIds)
+{
+    return ForecastCompletionTurns(PlayerController, HorizonTurns, &TaskIds);
+}
+
+FOfflineProgressResult UOfflineProgressCalculator::CalculateOfflineProgress(AC_PlayerController* PlayerController, float ElapsedSeconds, float TurnInterval)
+{
+    FOfflineProgressResult Result;
+    if (!IsValid(PlayerController) || ElapsedSeconds <= 0.0f || TurnInterval <= 0.0f)
+    {
+        UE_LOG(LogIdleTime, Warning, TEXT("🌙❌ CalculateOfflineProgress: Invalid input (%.1f s, interval %.2f)"), ElapsedSeconds, TurnInterval);
+        return Result;
+    }
+
+    Result.ElapsedSeconds = ElapsedSeconds;
+    Result.SimulatedTurns = FMath::FloorToInt(ElapsedSeconds / TurnInterval);
+
+    // === チームごとの周期モデル構築 ===
+    TArray<FOfflineTeamPlan> Plans;
+    if (Result.SimulatedTurns > 0)
+    {
+        BuildTeamPlans(PlayerController, Plans);
+    }
+
+    // === 個数指定・キープ型の打ち切りターンを二分探索 ===
+    ResolveTaskCutoffs(PlayerController, Plans, Result.SimulatedTurns, nullptr);
+
+    // === 最終状態の集計 ===
+    const int32 TotalTurns = Result.SimulatedTurns;
+    for (const FOfflineTeamPlan& Plan : Plans)
+    {
+        FOfflineTeamOutcome& Outcome = Result.TeamOutcomes.AddDefaulted_GetRef();
+        Outcome.TeamIndex = Plan.TeamIndex;
+        Outcome.ItemId = Plan.ItemId;
+
+        const int64 Gathered = Plan.GatheredBy(TotalTurns);
+        int64 Delivered = 0;
+        bool bReturnedHome = false;
+
+        if (Plan.CutoffTurn != INDEX_NONE && Plan.CutoffTurn < TotalTurns)
+        {
+            Outcome.CutoffTurn = Plan.CutoffTurn;
+            if (Plan.CutoffTurn <= Plan.LeadTurns)
+            {
+                // 採集開始前に目標到達：開始地点（荷下ろし済みなら拠点）で待機
+                Outcome.FinalLocationId = Plan.GetLocationAt(FMath::Min(Plan.CutoffTurn, Plan.PreUnloadTurn));
+                Outcome.bInitialItemsUnloaded = Plan.bPreUnload && Plan.CutoffTurn >= Plan.PreUnloadTurn;
+            }
+            else
+            {
+                // 目標到達後は帰還して荷下ろし、時間が足りなければ採集場所で待機
+                bReturnedHome = Plan.CutoffTurn + Plan.TravelTurns + Plan.UnloadTurns <= TotalTurns;
+                Delivered = bReturnedHome ? Gathered : Plan.DeliveredBy(Plan.CutoffTurn);
+                Outcome.FinalLocationId = bReturnedHome ? TEXT("base") : Plan.LocationId;
+                Outcome.bInitialItemsUnloaded = Plan.bPreUnload || bReturnedHome || Plan.CutoffTurn >= Plan.GetFirstUnloadTurn();
+            }
+        }
+        else
+        {
+            Delivered = Plan.DeliveredBy(TotalTurns);
+            Outcome.FinalLocationId = Plan.GetLocationAt(TotalTurns);
+            Outcome.bInitialItemsUnloaded = Plan.bPreUnload ? TotalTurns >= Plan.PreUnloadTurn : TotalTurns >= Plan.GetFirstUnloadTurn();
+        }
+
+        Outcome.TotalGathered = ClampToInt32(Gathered);
+        Outcome.CarriedToAdd = ClampToInt32(Gathered - Delivered);
+        if (Delivered > 0)
+        {
+            Result.StorageGains.FindOrAdd(Plan.ItemId) += ClampToInt32(Delivered);
+        }
+        if (!Plan.TaskId.IsEmpty() && Gathered > 0)
+        {
+            Result.TaskProgress.FindOrAdd(Plan.TaskId) += ClampToInt32(Gathered);
+        }
+
+        EmitTeamSegments(Result, Plan, bReturnedHome);
+    }
+
+    // === 施設の自動生産（実時間の生産間隔ごと、閉形式） ===
+    if (UBaseComponent* BaseComp = PlayerController->BaseComponent)
+    {
+        const float Interval = BaseComp->GetProductionInterval();
+        const int32 ProductionTicks = Interval > 0.0f ? FMath::FloorToInt(ElapsedSeconds / Interval) : 0;
+        if (ProductionTicks > 0)
+        {
+            for (const auto& Produced : BaseComp->CalculateAutoProduction(Interval))
+            {
+                const int32 Quantity = ClampToInt32((int64)Produced.Value * ProductionTicks);
+                Result.StorageGains.FindOrAdd(Produced.Key) += Quantity;
+
+                FOfflineProgressSegment& Segment = Result.Segments.AddDefaulted_GetRef();
+                Segment.SegmentType = EOfflineSegmentType::Production;
+                Segment.StartTurn = 0;
+                Segment.EndTurn = TotalTurns;
+                Segment.RepeatCount = ProductionTicks;
+                Segment.LocationId = TEXT("base");
+                Segment.ItemId = Produced.Key;
+                Segment.Quantity = Quantity;
+            }
+        }
+    }
+
+    UE_LOG(LogIdleTime, Log, TEXT("🌙📊 CalculateOfflineProgress: %.1f s = %d turns, %d teams, %d segments evaluated"),
+        ElapsedSeconds, TotalTurns, Plans.Num(), Result.GetSegmentCount());
+
+    return Result;
+}
+
+bool UOfflineProgressCalculator::ApplyOfflineProgress(AC_PlayerController* PlayerController, const FOfflineProgressResult& Result)
+{
+    if (!IsValid(PlayerController))
+    {
+        return false;
+    }
+
+    UInventoryComponent* Storage = PlayerController->GlobalInventory;
+    UTeamComponent* TeamComp = PlayerController->TeamComponent;
+    UTaskManagerComponent* TaskManager = PlayerController->TaskManager;
+    ULocationMovementComponent* MovementComp = PlayerController->MovementComponent;
+    if (!Storage || !TeamComp)
+    {
+        UE_LOG(LogIdleTime, Error, TEXT("🌙❌ ApplyOfflineProgress: Storage or TeamComponent unavailable"));
+        return false;
+    }
+
+    // 1. 倉庫への追加（アイテムごとに1回）
+    for (const auto& Gain : Result.StorageGains)
+    {
+        if (Gain.Value > 0 && !Storage->AddItem(Gain.Key, Gain.Value))
+        {
+            UE_LOG(LogIdleTime, Warning, TEXT("🌙⚠️ ApplyOfflineProgress: Failed to add %s x%d to storage"), *Gain.Key, Gain.Value);
+        }
+    }
+
+    // 2. チームの所持品と位置
+    for (const FOfflineTeamOutcome& Outcome : Result.TeamOutcomes)
+    {
+        const FTeam Team = TeamComp->GetTeam(Outcome.TeamIndex);
+        TArray<UInventoryComponent*> MemberInventories;
+        for (AC_IdleCharacter* Member : Team.Members)
+        {
+            if (IsValid(Member) && Member->GetInventoryComponent())
+            {
+                MemberInventories.Add(Member->GetInventoryComponent());
+            }
+        }
+
+        if (Outcome.bInitialItemsUnloaded)
+        {
+            for (UInventoryComponent* MemberInventory : MemberInventories)
+            {
+                for (const auto& Item : MemberInventory->GetTransferableItems())
+                {
+                    if (Storage->AddItem(Item.Key, Item.Value))
+                    {
+                        MemberInventory->RemoveItem(Item.Key, Item.Value);
+                    }
+                }
+            }
+        }
+
+        if (Outcome.CarriedToAdd > 0 && MemberInventories.Num() > 0)
+        {
+            const int32 PerMember = Outcome.CarriedToAdd / MemberInventories.Num();
+            int32 Extra = Outcome.CarriedToAdd % MemberInventories.Num();
+            for (UInventoryComponent* MemberInventory : MemberInventories)
+            {
+                const int32 Amount = PerMember + (Extra > 0 ? 1 : 0);
+                Extra = FMath::Max(0, Extra - 1);
+                if (Amount > 0 && !MemberInventory->AddItem(Outcome.ItemId, Amount))
+                {
+                    UE_LOG(LogIdleTime, Warning, TEXT("🌙⚠️ ApplyOfflineProgress: Team %d member could not carry %s x%d"),
+                        Outcome.TeamIndex, *Outcome.ItemId, Amount);
+                }
+            }
+        }
+
+        if (MovementComp && !Outcome.FinalLocationId.IsEmpty())
+        {
+            MovementComp->PlaceTeamAtLocation(Outcome.TeamIndex, Outcome.FinalLocationId);
+        }
+    }
+
+    // 3. タスク進捗（タスクごとに1回、個数指定型はここで完了・削除される）
+    if (TaskManager)
+    {
+        for (const auto& Progress : Result.TaskProgress)
+        {
+            TaskManager->UpdateTaskProgress(Progress.Key, Progress.Value);
+        }
+    }
+
+    UE_LOG(LogIdleTime, Log, TEXT("🌙✅ ApplyOfflineProgress: %d turns applied (%d segments, %d teams, %d item types to storage)"),
+        Result.SimulatedTurns, Result.GetSegmentCount(), Result.TeamOutcomes.Num(), Result.StorageGains.Num());
+
+    return true;
+}
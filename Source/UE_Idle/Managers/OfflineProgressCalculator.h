@@ -0,0 +1,53 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/NoExportTypes.h"
+#include "../Types/OfflineProgressTypes.h"
+#include "OfflineProgressCalculator.generated.h"
+
+class AC_PlayerController;
+
+/**
+ * オフライン進行計算
+ * 経過時間分のターンを1つずつ実行せず、チームごとの行動を
+ * 「移動 → 採集 → 帰還 → 荷下ろし」の周期として区分線形に解き、一括で反映する
+ * 計算コストはターン数ではなく区間数に比例する
+ */
+UCLASS(BlueprintType)
+class UE_IDLE_API UOfflineProgressCalculator : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * オフライン進行を計算する（ワールド状態は変更しない）
+     * @param PlayerController 各コンポーネントの所有者
+     * @param ElapsedSeconds オフライン経過時間（秒）
+     * @param TurnInterval 1ターンの実時間（秒）
+     */
+    UFUNCTION(BlueprintCallable, Category = "Offline Progress")
+    static FOfflineProgressResult CalculateOfflineProgress(AC_PlayerController* PlayerController, float ElapsedSeconds, float TurnInterval);
+
+    /** 計算結果を倉庫・メンバーインベントリ・タスク進捗・チーム位置へ一括反映 */
+    UFUNCTION(BlueprintCallable, Category = "Offline Progress")
+    static bool ApplyOfflineProgress(AC_PlayerController* PlayerController, const FOfflineProgressResult& Result);
+
+    /**
+     * 採集タスクの目標到達までのターン数を現在の状態から予測する（ワールド状態は変更しない）
+     * チームの採集量・移動時間・所持品からオフライン進行と同じ周期モデルを作って求める
+     * @param HorizonTurns 予測する範囲（これ以内に届かないタスクは結果に含めない）
+     * @return タスクID → 何ターン後に目標へ届くか（0は達成済み）
+     */
+    UFUNCTION(BlueprintCallable, Category = "Offline Progress")
+    static TMap<FString, int32> ForecastTaskCompletionTurns(AC_PlayerController* PlayerController, int32 HorizonTurns);
+
+    /** ForecastTaskCompletionTurnsのうち、TaskIdsのタスクだけを求める（一部のタスクの予測だけ差し替えるとき用） */
+    static TMap<FString, int32> ForecastTaskCompletionTurnsFor(AC_PlayerController* PlayerController, int32 HorizonTurns,
+        const TSet<FString>& TaskIds);
+
+    // キャラクター1人あたりの帰還しきい値（UCharacterBrain::ShouldReturnToBaseと同じ値）
+    static constexpr int32 CarryLimitPerMember = 20;
+
+    // 荷下ろしに要するターン数
+    static constexpr int32 UnloadTurns = 1;
+};
@@ -0,0 +1,250 @@
+#include "ResourceLedgerManager.h"
+#include "../UE_Idle.h"
+#include "../Components/InventoryComponent.h"
+#include "Engine/World.h"
+
+void UResourceLedgerManager::Deinitialize()
+{
+    BaseTotals.Empty();
+    TeamTotals.Empty();
+    GrandTotals.Empty();
+    ItemVersions.Empty();
+    InventoryBuckets.Empty();
+    ThresholdWatches.Empty();
+    WatchesByItem.Empty();
+
+    Super::Deinitialize();
+}
+
+void UResourceLedgerManager::RegisterBaseInventory(UInventoryComponent* Inventory)
+{
+    if (!IsValid(Inventory))
+    {
+        return;
+    }
+
+    UnassignInventory(Inventory);
+
+    InventoryBuckets.Add(Inventory, BaseBucket);
+    ApplyInventoryContents(Inventory, BaseBucket, 1);
+
+    UE_LOG(LogIdleInventory, Log, TEXT("ResourceLedger: Base inventory registered (%s)"), *Inventory->OwnerId);
+}
+
+void UResourceLedgerManager::AssignInventoryToTeam(UInventoryComponent* Inventory, int32 TeamIndex)
+{
+    if (!IsValid(Inventory) || TeamIndex < 0)
+    {
+        return;
+    }
+
+    const int32* CurrentBucket = InventoryBuckets.Find(Inventory);
+    if (CurrentBucket && *CurrentBucket == TeamIndex)
+    {
+        return;
+    }
+
+    UnassignInventory(Inventory);
+
+    if (!TeamTotals.IsValidIndex(TeamIndex))
+    {
+        TeamTotals.SetNum(TeamIndex + 1);
+    }
+
+    InventoryBuckets.Add(Inventory, TeamIndex);
+    ApplyInventoryContents(Inventory, TeamIndex, 1);
+
+    UE_LOG(LogIdleInventory, Verbose, TEXT("ResourceLedger: %s assigned to team %d"), *Inventory->OwnerId, TeamIndex);
+}
+
+void UResourceLedgerManager::UnassignInventory(UInventoryComponent* Inventory)
+{
+    int32 Bucket = BaseBucket;
+    if (!Inventory || !InventoryBuckets.RemoveAndCopyValue(Inventory, Bucket))
+    {
+        return;
+    }
+
+    ApplyInventoryContents(Inventory, Bucket, -1);
+}
+
+void UResourceLedgerManager::RemoveTeam(int32 TeamIndex)
+{
+    if (!TeamTotals.IsValidIndex(TeamIndex))
+    {
+        return;
+    }
+
+    // メンバーは削除前に集計から外されている前提。残っていれば合計からも差し引く
+    for (const TPair<FSimItemId, int32>& Entry : TeamTotals[TeamIndex])
+    {
+        AddToTotals(GrandTotals, Entry.Key, -Entry.Value);
+        ++ItemVersions.FindOrAdd(Entry.Key);
+    }
+    
+    TArray<FSimItemId> RemovedItems;
+    TeamTotals[TeamIndex].GetKeys(RemovedItems);
+    TeamTotals.RemoveAt(TeamIndex);
+    
+    for (FSimItemId ItemId : RemovedItems)
+    {
+        NotifyThresholdWatches(ItemId);
+    }
+
+    for (auto It = InventoryBuckets.CreateIterator(); It; ++It)
+    {
+        if (It.Value() == TeamIndex)
+        {
+            It.RemoveCurrent();
+        }
+        else if (It.Value() > TeamIndex)
+        {
+            It.Value()--;
+        }
+    }
+}
+
+void UResourceLedgerManager::ApplyDelta(const UInventoryComponent* Inventory, const FString& ItemId, int32 Delta)
+{
+    if (Delta == 0)
+    {
+        return;
+    }
+
+    if (const int32* Bucket = InventoryBuckets.Find(Inventory))
+    {
+        ApplyBucketDelta(*Bucket, FSimItemId::Intern(ItemId), Delta);
+    }
+}
+
+int32 UResourceLedgerManager::GetTeamAmount(int32 TeamIndex, const FString& ItemId) const
+{
+    return TeamTotals.IsValidIndex(TeamIndex) ? TeamTotals[TeamIndex].FindRef(FSimItemId::Find(ItemId)) : 0;
+}
+
+void UResourceLedgerManager::ApplyInventoryContents(const UInventoryComponent* Inventory, int32 Bucket, int32 Sign)
+{
+    for (const TPair<FString, int32>& Item : Inventory->GetAllItems())
+    {
+        ApplyBucketDelta(Bucket, FSimItemId::Intern(Item.Key), Item.Value * Sign);
+    }
+}
+
+void UResourceLedgerManager::ApplyBucketDelta(int32 Bucket, FSimItemId ItemId, int32 Delta)
+{
+    if (Bucket == BaseBucket)
+    {
+        AddToTotals(BaseTotals, ItemId, Delta);
+    }
+    else
+    {
+        if (!TeamTotals.IsValidIndex(Bucket))
+        {
+            TeamTotals.SetNum(Bucket + 1);
+        }
+        AddToTotals(TeamTotals[Bucket], ItemId, Delta);
+    }
+
+    AddToTotals(GrandTotals, ItemId, Delta);
+    ++ItemVersions.FindOrAdd(ItemId);
+    
+    NotifyThresholdWatches(ItemId);
+}
+
+int32 UResourceLedgerManager::AddThresholdWatch(FSimItemId ItemId, int32 Threshold, ELedgerWatchScope Scope, FOnLedgerThresholdCrossed Callback)
+{
+    if (!ItemId.IsValid())
+    {
+        return INDEX_NONE;
+    }
+    
+    FThresholdWatch Watch;
+    Watch.ItemId = ItemId;
+    Watch.Threshold = Threshold;
+    Watch.Scope = Scope;
+    Watch.bAtOrAbove = GetScopedAmount(ItemId, Scope) >= Threshold;
+    Watch.Callback = MoveTemp(Callback);
+    
+    const int32 WatchHandle = ThresholdWatches.Add(MoveTemp(Watch));
+    WatchesByItem.FindOrAdd(ItemId).Add(WatchHandle);
+    return WatchHandle;
+}
+
+void UResourceLedgerManager::RemoveThresholdWatch(int32 WatchHandle)
+{
+    if (!ThresholdWatches.IsValidIndex(WatchHandle))
+    {
+        return;
+    }
+    
+    const FSimItemId ItemId = ThresholdWatches[WatchHandle].ItemId;
+    if (TArray<int32>* Handles = WatchesByItem.Find(ItemId))
+    {
+        Handles->RemoveSingleSwap(WatchHandle);
+        if (Handles->Num() == 0)
+        {
+            WatchesByItem.Remove(ItemId);
+        }
+    }
+    ThresholdWatches.RemoveAt(WatchHandle);
+}
+
+bool UResourceLedgerManager::IsWatchAtOrAbove(int32 WatchHandle) const
+{
+    return ThresholdWatches.IsValidIndex(WatchHandle) && ThresholdWatches[WatchHandle].bAtOrAbove;
+}
+
+int32 UResourceLedgerManager::GetScopedAmount(FSimItemId ItemId, ELedgerWatchScope Scope) const
+{
+    return Scope == ELedgerWatchScope::Base ? BaseTotals.FindRef(ItemId) : GrandTotals.FindRef(ItemId);
+}
+
+void UResourceLedgerManager::NotifyThresholdWatches(FSimItemId ItemId)
+{
+    const TArray<int32>* Handles = WatchesByItem.Find(ItemId);
+    if (!Handles)
+    {
+        return;
+    }
+    
+    // 通知先が監視を付け外しできるよう、状態を更新してから通知する
+    TArray<TPair<FOnLedgerThresholdCrossed, bool>, TInlineAllocator<4>> Crossings;
+    for (int32 WatchHandle : *Handles)
+    {
+        FThresholdWatch& Watch = ThresholdWatches[WatchHandle];
+        const bool bAtOrAbove = GetScopedAmount(ItemId, Watch.Scope) >= Watch.Threshold;
+        if (bAtOrAbove != Watch.bAtOrAbove)
+        {
+            Watch.bAtOrAbove = bAtOrAbove;
+            Crossings.Emplace(Watch.Callback, bAtOrAbove);
+        }
+    }
+    
+    for (const TPair<FOnLedgerThresholdCrossed, bool>& Crossing : Crossings)
+    {
+        Crossing.Key.ExecuteIfBound(ItemId, Crossing.Value);
+    }
+}
+
+void UResourceLedgerManager::AddToTotals(TMap<FSimItemId, int32>& Totals, FSimItemId ItemId, int32 Delta)
+{
+    int32& Amount = Totals.FindOrAdd(ItemId);
+    Amount += Delta;
+    ensureMsgf(Amount >= 0, TEXT("ResourceLedger: %s went negative (%d)"), *ItemId.ToString(), Amount);
+
+    if (Amount <= 0)
+    {
+        Totals.Remove(ItemId);
+    }
+}
+
+UResourceLedgerManager* UResourceLedgerManager::Get(const UObject* WorldContextObject)
+{
+    if (!WorldContextObject)
+    {
+        return nullptr;
+    }
+
+    UWorld* World = WorldContextObject->GetWorld();
+    return World ? World->GetSubsystem<UResourceLedgerManager>() : nullptr;
+}
@@ -0,0 +1,140 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "../Types/SimIdTypes.h"
+#include "ResourceLedgerManager.generated.h"
+
+class UInventoryComponent;
+
+// しきい値監視の対象範囲
+enum class ELedgerWatchScope : uint8
+{
+    Total,  // 拠点倉庫 + 全チーム
+    Base    // 拠点倉庫のみ
+};
+
+// 在庫がしきい値をまたいだときの通知（bAtOrAbove: しきい値以上になった）
+DECLARE_DELEGATE_TwoParams(FOnLedgerThresholdCrossed, FSimItemId /*ItemId*/, bool /*bAtOrAbove*/);
+
+/**
+ * 拠点全体の資源台帳
+ * 拠点倉庫・チーム別・合計のアイテム数を保持し、UInventoryComponentの増減を差分で反映する
+ * GetTotalResourceAmountなどの集計をアクターを辿らずにO(1)で返すためのもの
+ *
+ * 集計対象は「拠点倉庫として登録されたインベントリ」と「チームに所属するメンバーのインベントリ」のみ
+ * （チーム未所属キャラクターの所持品は従来通り合計に含めない）
+ */
+UCLASS()
+class UE_IDLE_API UResourceLedgerManager : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+
+    // === 集計対象の登録 ===
+
+    /** 拠点倉庫インベントリを登録（既存の所持品も台帳に反映） */
+    void RegisterBaseInventory(UInventoryComponent* Inventory);
+
+    /** メンバーインベントリをチームの集計に割り当てる（所属変更時は旧チームから移し替え） */
+    void AssignInventoryToTeam(UInventoryComponent* Inventory, int32 TeamIndex);
+
+    /** インベントリを集計対象から外す（所持品分を台帳から差し引く） */
+    void UnassignInventory(UInventoryComponent* Inventory);
+
+    /** チーム削除時に呼ぶ。以降のチームインデックスを1つ詰める */
+    void RemoveTeam(int32 TeamIndex);
+
+    // === 差分反映（UInventoryComponentから呼ばれる） ===
+
+    void ApplyDelta(const UInventoryComponent* Inventory, const FString& ItemId, int32 Delta);
+
+    // === 参照（O(1)） ===
+
+    /** 拠点倉庫 + 全チーム所持の合計 */
+    UFUNCTION(BlueprintPure, Category = "Resource Ledger")
+    int32 GetTotalAmount(const FString& ItemId) const { return GetTotalAmount(FSimItemId::Find(ItemId)); }
+    int32 GetTotalAmount(FSimItemId ItemId) const { return GrandTotals.FindRef(ItemId); }
+
+    /** 拠点倉庫の在庫数 */
+    UFUNCTION(BlueprintPure, Category = "Resource Ledger")
+    int32 GetBaseAmount(const FString& ItemId) const { return BaseTotals.FindRef(FSimItemId::Find(ItemId)); }
+
+    /** チームメンバー所持の合計 */
+    UFUNCTION(BlueprintPure, Category = "Resource Ledger")
+    int32 GetTeamAmount(int32 TeamIndex, const FString& ItemId) const;
+
+    /** 合計在庫が変わるたびに増える、アイテム別の変更番号（判定キャッシュの無効化用） */
+    uint32 GetItemVersion(FSimItemId ItemId) const { return ItemVersions.FindRef(ItemId); }
+
+    /** インベントリが集計対象として登録されているか */
+    bool IsTracked(const UInventoryComponent* Inventory) const { return InventoryBuckets.Contains(Inventory); }
+
+    // === しきい値監視 ===
+
+    /**
+     * 在庫がThresholdをまたいだときだけ通知する監視を登録する
+     * 在庫の増減ごとに監視対象のアイテムだけを比較するので、利用側は毎ターン在庫を集計し直さなくてよい
+     * @return 解除用のハンドル
+     */
+    int32 AddThresholdWatch(FSimItemId ItemId, int32 Threshold, ELedgerWatchScope Scope, FOnLedgerThresholdCrossed Callback);
+
+    void RemoveThresholdWatch(int32 WatchHandle);
+
+    /** 監視対象の在庫が現在しきい値以上か（不明なハンドルはfalse） */
+    bool IsWatchAtOrAbove(int32 WatchHandle) const;
+
+    int32 GetThresholdWatchCount() const { return ThresholdWatches.Num(); }
+
+    /** ワールドから台帳を取得するヘルパー */
+    static UResourceLedgerManager* Get(const UObject* WorldContextObject);
+
+    // 拠点倉庫を表すバケット番号（0以上はチームインデックス）
+    static constexpr int32 BaseBucket = INDEX_NONE;
+
+private:
+    /** インベントリの全所持品をバケットへ加算（Sign=-1で減算） */
+    void ApplyInventoryContents(const UInventoryComponent* Inventory, int32 Bucket, int32 Sign);
+
+    void ApplyBucketDelta(int32 Bucket, FSimItemId ItemId, int32 Delta);
+
+    static void AddToTotals(TMap<FSimItemId, int32>& Totals, FSimItemId ItemId, int32 Delta);
+
+    int32 GetScopedAmount(FSimItemId ItemId, ELedgerWatchScope Scope) const;
+
+    /** アイテムの監視を再評価し、しきい値をまたいだものに通知する */
+    void NotifyThresholdWatches(FSimItemId ItemId);
+
+    struct FThresholdWatch
+    {
+        FSimItemId ItemId;
+        int32 Threshold = 0;
+        ELedgerWatchScope Scope = ELedgerWatchScope::Total;
+        bool bAtOrAbove = false;
+        FOnLedgerThresholdCrossed Callback;
+    };
+
+    // 拠点倉庫の在庫
+    TMap<FSimItemId, int32> BaseTotals;
+
+    // チームインデックス → メンバー所持合計
+    TArray<TMap<FSimItemId, int32>> TeamTotals;
+
+    // 拠点倉庫 + 全チーム
+    TMap<FSimItemId, int32> GrandTotals;
+
+    // アイテムID → 合計在庫の変更番号
+    TMap<FSimItemId, uint32> ItemVersions;
+
+    // 集計対象インベントリ → バケット番号
+    TMap<TObjectKey<UInventoryComponent>, int32> InventoryBuckets;
+
+    // しきい値監視（添字がハンドル）
+    TSparseArray<FThresholdWatch> ThresholdWatches;
+
+    // アイテムID → 監視ハンドル
+    TMap<FSimItemId, TArray<int32>> WatchesByItem;
+};
@@ -0,0 +1,87 @@
+#include "SimulationRandomManager.h"
+#include "../UE_Idle.h"
+#include "../Components/TimeManagerComponent.h"
+#include "../Actor/C_IdleCharacter.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+
+void USimulationRandomManager::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    // 明示的に設定されるまではセッションごとのシード
+    Seed = static_cast<int64>(FIdleRandomStream::MakeNondeterministic().NextUInt32());
+
+    UE_LOG(LogIdleSim, Log, TEXT("🎲 SimulationRandomManager initialized (seed %lld)"), Seed);
+}
+
+void USimulationRandomManager::SetSeed(int64 NewSeed)
+{
+    Seed = NewSeed;
+    CallSerial = 0;
+    UE_LOG(LogIdleSim, Log, TEXT("🎲 Simulation seed set to %lld"), Seed);
+}
+
+FIdleRandomStream USimulationRandomManager::MakeStream(EIdleRandomDomain Domain, int32 Turn, uint64 EntityKey, uint64 SubKey) const
+{
+    return FIdleRandomStream::Make(static_cast<uint64>(Seed), Domain, Turn, EntityKey, SubKey);
+}
+
+FIdleRandomStream USimulationRandomManager::MakeStreamForCurrentTurn(const UObject* WorldContextObject, EIdleRandomDomain Domain, uint64 EntityKey, uint64 SubKey)
+{
+    const USimulationRandomManager* RandomManager = Get(WorldContextObject);
+    if (!RandomManager)
+    {
+        return FIdleRandomStream::MakeNondeterministic();
+    }
+
+    const UTimeManagerComponent* TimeManager = UTimeManagerComponent::Get(WorldContextObject);
+    const int32 Turn = TimeManager ? TimeManager->GetCurrentTurn() : 0;
+    return RandomManager->MakeStream(Domain, Turn, EntityKey, SubKey);
+}
+
+uint64 USimulationRandomManager::GetEntityKey(const AC_IdleCharacter* Character)
+{
+    return Character ? GetEntityKey(Character->GetCharacterId()) : 0;
+}
+
+uint64 USimulationRandomManager::GetEntityKey(const FGuid& EntityId)
+{
+    if (!EntityId.IsValid())
+    {
+        return 0;
+    }
+    const uint64 High = (static_cast<uint64>(EntityId.A) << 32) | EntityId.B;
+    const uint64 Low = (static_cast<uint64>(EntityId.C) << 32) | EntityId.D;
+    return FIdleRandomStream::Mix(High ^ FIdleRandomStream::Mix(Low));
+}
+
+uint64 USimulationRandomManager::GetEntityKey(const UObject* Entity)
+{
+    if (const AC_IdleCharacter* Character = Cast<AC_IdleCharacter>(Entity))
+    {
+        return GetEntityKey(Character);
+    }
+
+    // 実行時生成オブジェクトの名前の連番は生成順で変わるため、レベル配置のパス名を使う
+    return Entity ? GetStringKey(Entity->GetPathName()) : 0;
+}
+
+uint64 USimulationRandomManager::GetStringKey(const FString& Value)
+{
+    // FNameの比較インデックスは実行ごとに変わるため文字列のCRCを使う
+    return FIdleRandomStream::Mix(FCrc::StrCrc32(*Value));
+}
+
+uint64 USimulationRandomManager::NextCallSerial(const UObject* WorldContextObject)
+{
+    USimulationRandomManager* RandomManager = Get(WorldContextObject);
+    return RandomManager ? RandomManager->CallSerial++ : 0;
+}
+
+USimulationRandomManager* USimulationRandomManager::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+    return GameInstance ? GameInstance->GetSubsystem<USimulationRandomManager>() : nullptr;
+}
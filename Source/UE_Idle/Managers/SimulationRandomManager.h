@@ -0,0 +1,65 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "../Types/SimulationRandomTypes.h"
+#include "SimulationRandomManager.generated.h"
+
+class AC_IdleCharacter;
+
+/**
+ * シミュレーション乱数サービス
+ * セッションのシードを保持し、(シード, ターン, エンティティ) をキーにした乱数ストリームを配る
+ * 戦闘判定・キャラクター生成・敵出現などはここからストリームを受け取り、FMath::FRandは使わない
+ */
+UCLASS()
+class UE_IDLE_API USimulationRandomManager : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+    /** シード設定（同じシードなら同じ乱数系列を再現する） */
+    UFUNCTION(BlueprintCallable, Category = "Simulation Random")
+    void SetSeed(int64 NewSeed);
+
+    UFUNCTION(BlueprintPure, Category = "Simulation Random")
+    int64 GetSeed() const { return Seed; }
+
+    /** ターン・エンティティ指定でストリーム生成 */
+    FIdleRandomStream MakeStream(EIdleRandomDomain Domain, int32 Turn, uint64 EntityKey, uint64 SubKey = 0) const;
+
+    /**
+     * 現在のターンでストリーム生成
+     * サービスが取得できない場合は非決定的なストリームを返す
+     */
+    static FIdleRandomStream MakeStreamForCurrentTurn(const UObject* WorldContextObject, EIdleRandomDomain Domain, uint64 EntityKey, uint64 SubKey = 0);
+
+    /** キャラクターの安定キー（CharacterIdから算出、セッションをまたいでも一致） */
+    static uint64 GetEntityKey(const AC_IdleCharacter* Character);
+
+    /** 安定IDからのキー */
+    static uint64 GetEntityKey(const FGuid& EntityId);
+
+    /** キャラクター以外のエンティティのキー（パス名から算出、レベル配置アクター向け） */
+    static uint64 GetEntityKey(const UObject* Entity);
+
+    /** 文字列の安定キー（場所IDなど） */
+    static uint64 GetStringKey(const FString& Value);
+
+    /**
+     * 呼び出し通し番号（同じターン・同じエンティティで繰り返される判定のサブキー用）
+     * 呼び出し順が同じなら実行間で一致する。サービスが取得できない場合は0
+     */
+    static uint64 NextCallSerial(const UObject* WorldContextObject);
+
+    static USimulationRandomManager* Get(const UObject* WorldContextObject);
+
+private:
+    UPROPERTY()
+    int64 Seed = 0;
+
+    // NextCallSerialの通し番号（シード設定でリセット）
+    uint64 CallSerial = 0;
+};
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "../Types/ReplayTypes.h"
+#include "SimulationReplayManager.generated.h"
+
+class AC_PlayerController;
+class AC_IdleCharacter;
+
+/**
+ * プレイヤー操作の記録・再生
+ * 記録開始時のシード・ワールド状態とターン番号付きの操作列を保存し、ヘッドレス高速進行で同じ負荷を再現する
+ * ビルドごとのターン/秒・メモリ比較用
+ */
+UCLASS()
+class UE_IDLE_API USimulationReplayManager : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // === 記録 ===
+
+    /** 記録開始（現在のシード・ターン・ワールド状態を起点にする） */
+    UFUNCTION(BlueprintCallable, Category = "Simulation Replay")
+    void StartRecording();
+
+    /** 記録終了（記録内容は保持され、SaveRecordingで保存できる） */
+    UFUNCTION(BlueprintCallable, Category = "Simulation Replay")
+    void StopRecording();
+
+    UFUNCTION(BlueprintPure, Category = "Simulation Replay")
+    bool IsRecording() const { return bRecording; }
+
+    UFUNCTION(BlueprintPure, Category = "Simulation Replay")
+    bool IsReplaying() const { return bReplaying; }
+
+    /** 操作を記録（記録中でなければ、または再生中は無視） */
+    void RecordCommand(FIdleReplayCommand Command);
+
+    /** 記録ヘルパー：サブシステムを解決して記録する */
+    static void Record(const UObject* WorldContextObject, const FIdleReplayCommand& Command);
+
+    UFUNCTION(BlueprintPure, Category = "Simulation Replay")
+    const FIdleReplayRecording& GetCurrentRecording() const { return CurrentRecording; }
+
+    // === 保存・読み込み（Saved/IdleReplays/<Name>.json） ===
+
+    UFUNCTION(BlueprintCallable, Category = "Simulation Replay")
+    bool SaveRecording(const FString& RecordingName) const;
+
+    UFUNCTION(BlueprintCallable, Category = "Simulation Replay")
+    bool LoadRecording(const FString& RecordingName, FIdleReplayRecording& OutRecording) const;
+
+    // === 再生 ===
+
+    /**
+     * 記録を再生する
+     * 記録開始時のワールド状態を復元してから、操作ターンまでヘッドレス高速進行し、
+     * 操作を適用して、最後に記録終了ターンまで進める
+     * 記録時のプレイヤーキャラクターが現在のワールドに揃っていない場合は再生しない
+     */
+    UFUNCTION(BlueprintCallable, Category = "Simulation Replay")
+    FIdleReplayBenchmarkResult RunReplay(const FIdleReplayRecording& Recording);
+
+    static USimulationReplayManager* Get(const UObject* WorldContextObject);
+
+private:
+    /** 現在のワールド状態を記録用に取り込む */
+    FIdleReplayWorldSnapshot CaptureWorldSnapshot(AC_PlayerController* PlayerController) const;
+
+    /**
+     * 記録開始時のワールド状態を復元する
+     * @return 記録時のキャラクターが揃っていて復元できたか（falseの場合は何も変更しない）
+     */
+    bool RestoreWorldSnapshot(AC_PlayerController* PlayerController, const FIdleReplayWorldSnapshot& Snapshot);
+
+    /** 安定IDからプレイヤーキャラクターを探す */
+    static AC_IdleCharacter* FindCharacterById(const AC_PlayerController* PlayerController, const FGuid& CharacterId);
+
+    /** 1件の操作を適用 */
+    bool ApplyCommand(AC_PlayerController* PlayerController, const FIdleReplayCommand& Command);
+
+    /** 記録ファイルのパス */
+    static FString GetRecordingPath(const FString& RecordingName);
+
+    UPROPERTY()
+    FIdleReplayRecording CurrentRecording;
+
+    bool bRecording = false;
+    bool bReplaying = false;
+
+    // 記録時の施設ID → 再生時の施設ID
+    TMap<FGuid, FGuid> ReplayFacilityIds;
+};
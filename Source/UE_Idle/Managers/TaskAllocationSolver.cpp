@@ -0,0 +1,315 @@
+#include "TaskAllocationSolver.h"
+#include "../UE_Idle.h"
+#include "Math/RandomStream.h"
+#include "HAL/PlatformTime.h"
+
+namespace
+{
+    /**
+     * ハンガリアン法（ポテンシャル法）
+     * 行数Rows ≤ 列数Columnsの長方形行列で、各行に異なる列を割り当てる
+     * 計算量O(Rows² × Columns)
+     */
+    double SolveRectangular(const TArray<float>& Costs, const TArray<int32>& Rows, int32 NumColumns, TArray<int32>& OutColumnForRow)
+    {
+        const int32 NumRows = Rows.Num();
+        const double Infinity = TNumericLimits<double>::Max();
+
+        // 1始まりの添字。列0は番兵
+        TArray<double> RowPotential;
+        TArray<double> ColumnPotential;
+        TArray<int32> RowForColumn;
+        TArray<int32> Way;
+        TArray<double> MinSlack;
+        TArray<bool> Used;
+        RowPotential.SetNumZeroed(NumRows + 1);
+        ColumnPotential.SetNumZeroed(NumColumns + 1);
+        RowForColumn.SetNumZeroed(NumColumns + 1);
+        Way.SetNumZeroed(NumColumns + 1);
+        MinSlack.SetNumUninitialized(NumColumns + 1);
+        Used.SetNumUninitialized(NumColumns + 1);
+
+        for (int32 Row = 1; Row <= NumRows; ++Row)
+        {
+            RowForColumn[0] = Row;
+            int32 Column0 = 0;
+            for (int32 Column = 0; Column <= NumColumns; ++Column)
+            {
+                MinSlack[Column] = Infinity;
+                Used[Column] = false;
+            }
+
+            do
+            {
+                Used[Column0] = true;
+                const int32 Row0 = RowForColumn[Column0];
+                const float* CostRow = Costs.GetData() + static_cast<int64>(Rows[Row0 - 1]) * NumColumns;
+                double Delta = Infinity;
+                int32 Column1 = 0;
+
+                for (int32 Column = 1; Column <= NumColumns; ++Column)
+                {
+                    if (Used[Column])
+                    {
+                        continue;
+                    }
+
+                    const double Slack = CostRow[Column - 1] - RowPotential[Row0] - ColumnPotential[Column];
+                    if (Slack < MinSlack[Column])
+                    {
+                        MinSlack[Column] = Slack;
+                        Way[Column] = Column0;
+                    }
+                    if (MinSlack[Column] < Delta)
+                    {
+                        Delta = MinSlack[Column];
+                        Column1 = Column;
+                    }
+                }
+
+                for (int32 Column = 0; Column <= NumColumns; ++Column)
+                {
+                    if (Used[Column])
+                    {
+                        RowPotential[RowForColumn[Column]] += Delta;
+                        ColumnPotential[Column] -= Delta;
+                    }
+                    else
+                    {
+                        MinSlack[Column] -= Delta;
+                    }
+                }
+                Column0 = Column1;
+            }
+            while (RowForColumn[Column0] != 0);
+
+            // 増加路に沿って割り当てを入れ替える
+            do
+            {
+                const int32 Column1 = Way[Column0];
+                RowForColumn[Column0] = RowForColumn[Column1];
+                Column0 = Column1;
+            }
+            while (Column0 != 0);
+        }
+
+        double TotalCost = 0.0;
+        for (int32 Column = 1; Column <= NumColumns; ++Column)
+        {
+            if (RowForColumn[Column] != 0)
+            {
+                const int32 Row = Rows[RowForColumn[Column] - 1];
+                OutColumnForRow[Row] = Column - 1;
+                TotalCost += Costs[static_cast<int64>(Row) * NumColumns + Column - 1];
+            }
+        }
+        return TotalCost;
+    }
+
+    int32 CountDistinct(const TArray<int32>& ColumnForRow)
+    {
+        TSet<int32> Distinct;
+        for (int32 Column : ColumnForRow)
+        {
+            if (Column != INDEX_NONE)
+            {
+                Distinct.Add(Column);
+            }
+        }
+        return Distinct.Num();
+    }
+}
+
+void UTaskAllocationSolver::BuildCostMatrix(const TArray<FTaskAllocationTeam>& Teams, const TArray<FTaskAllocationCandidate>& Tasks,
+    const FTaskAllocationWeights& Weights, TArray<float>& OutCosts, TArray<int32>& OutSites)
+{
+    const int32 NumTasks = Tasks.Num();
+    OutCosts.SetNumUninitialized(Teams.Num() * NumTasks);
+    OutSites.SetNumUninitialized(Teams.Num() * NumTasks);
+
+    for (int32 TeamRow = 0; TeamRow < Teams.Num(); ++TeamRow)
+    {
+        const FTaskAllocationTeam& Team = Teams[TeamRow];
+        const float YieldPerCoefficient = Weights.YieldWeight * Team.GatheringPower / GatheringEfficiencyMultiplier;
+
+        for (int32 TaskColumn = 0; TaskColumn < NumTasks; ++TaskColumn)
+        {
+            const FTaskAllocationCandidate& Task = Tasks[TaskColumn];
+            float BestSiteCost = 0.0f;
+            int32 BestSite = INDEX_NONE;
+
+            // 移動コストと見込み採集量が最も有利な場所を選ぶ
+            for (int32 SiteIndex = 0; SiteIndex < Task.Sites.Num(); ++SiteIndex)
+            {
+                const FTaskAllocationSite& Site = Task.Sites[SiteIndex];
+                const float SiteCost = Weights.TravelWeight * FMath::Abs(Team.DistanceFromBase - Site.DistanceFromBase)
+                    - YieldPerCoefficient * Site.GatheringCoefficient;
+                if (BestSite == INDEX_NONE || SiteCost < BestSiteCost)
+                {
+                    BestSiteCost = SiteCost;
+                    BestSite = SiteIndex;
+                }
+            }
+
+            const int32 Cell = TeamRow * NumTasks + TaskColumn;
+            OutCosts[Cell] = Weights.PriorityWeight * Task.PriorityPosition + BestSiteCost;
+            OutSites[Cell] = BestSite;
+        }
+    }
+}
+
+float UTaskAllocationSolver::SolveAssignment(const TArray<float>& Costs, int32 NumRows, int32 NumColumns, TArray<int32>& OutColumnForRow)
+{
+    OutColumnForRow.Init(INDEX_NONE, NumRows);
+    if (NumRows <= 0 || NumColumns <= 0 || Costs.Num() < NumRows * NumColumns)
+    {
+        return 0.0f;
+    }
+
+    // 列数ずつ行を区切って解く（チーム数がタスク数を超えたら、余ったチームは同じタスク群を分担する）
+    double TotalCost = 0.0;
+    TArray<int32> ChunkRows;
+    for (int32 FirstRow = 0; FirstRow < NumRows; FirstRow += NumColumns)
+    {
+        const int32 ChunkSize = FMath::Min(NumColumns, NumRows - FirstRow);
+        ChunkRows.Reset(ChunkSize);
+        for (int32 Row = FirstRow; Row < FirstRow + ChunkSize; ++Row)
+        {
+            ChunkRows.Add(Row);
+        }
+        TotalCost += SolveRectangular(Costs, ChunkRows, NumColumns, OutColumnForRow);
+    }
+
+    return static_cast<float>(TotalCost);
+}
+
+float UTaskAllocationSolver::SolveGreedy(const TArray<float>& Costs, int32 NumRows, int32 NumColumns, TArray<int32>& OutColumnForRow)
+{
+    OutColumnForRow.Init(INDEX_NONE, NumRows);
+    if (NumRows <= 0 || NumColumns <= 0 || Costs.Num() < NumRows * NumColumns)
+    {
+        return 0.0f;
+    }
+
+    double TotalCost = 0.0;
+    for (int32 Row = 0; Row < NumRows; ++Row)
+    {
+        const float* CostRow = Costs.GetData() + static_cast<int64>(Row) * NumColumns;
+        int32 BestColumn = 0;
+        for (int32 Column = 1; Column < NumColumns; ++Column)
+        {
+            if (CostRow[Column] < CostRow[BestColumn])
+            {
+                BestColumn = Column;
+            }
+        }
+        OutColumnForRow[Row] = BestColumn;
+        TotalCost += CostRow[BestColumn];
+    }
+
+    return static_cast<float>(TotalCost);
+}
+
+TArray<FTeamTaskAllocation> UTaskAllocationSolver::Allocate(const TArray<FTaskAllocationTeam>& Teams, const TArray<FTaskAllocationCandidate>& Tasks,
+    const FTaskAllocationWeights& Weights)
+{
+    TArray<FTeamTaskAllocation> Allocations;
+    if (Teams.Num() == 0 || Tasks.Num() == 0)
+    {
+        return Allocations;
+    }
+
+    TArray<float> Costs;
+    TArray<int32> Sites;
+    BuildCostMatrix(Teams, Tasks, Weights, Costs, Sites);
+
+    TArray<int32> TaskForTeam;
+    SolveAssignment(Costs, Teams.Num(), Tasks.Num(), TaskForTeam);
+
+    Allocations.Reserve(Teams.Num());
+    for (int32 TeamRow = 0; TeamRow < Teams.Num(); ++TeamRow)
+    {
+        const int32 TaskColumn = TaskForTeam[TeamRow];
+        if (TaskColumn == INDEX_NONE)
+        {
+            continue;
+        }
+
+        const int32 Cell = TeamRow * Tasks.Num() + TaskColumn;
+        const FTaskAllocationCandidate& Task = Tasks[TaskColumn];
+
+        FTeamTaskAllocation& Allocation = Allocations.AddDefaulted_GetRef();
+        Allocation.TeamIndex = Teams[TeamRow].TeamIndex;
+        Allocation.TaskId = Task.TaskId;
+        Allocation.LocationId = Task.Sites.IsValidIndex(Sites[Cell]) ? Task.Sites[Sites[Cell]].LocationId : FString();
+        Allocation.Cost = Costs[Cell];
+    }
+
+    return Allocations;
+}
+
+FTaskAllocationBenchmarkResult UTaskAllocationSolver::RunBenchmark(int32 NumTeams, int32 NumTasks, int32 Seed)
+{
+    FTaskAllocationBenchmarkResult Result;
+    Result.TeamCount = FMath::Max(NumTeams, 0);
+    Result.TaskCount = FMath::Max(NumTasks, 0);
+
+    // 合成データ：場所は拠点からの距離が異なる4箇所、タスクは1〜3箇所で作業できる
+    FRandomStream Stream(Seed);
+    static const float SiteDistances[] = { 100.0f, 200.0f, 300.0f, 400.0f };
+
+    TArray<FTaskAllocationTeam> Teams;
+    Teams.SetNum(Result.TeamCount);
+    for (int32 Index = 0; Index < Teams.Num(); ++Index)
+    {
+        Teams[Index].TeamIndex = Index;
+        Teams[Index].DistanceFromBase = SiteDistances[Stream.RandRange(0, 3)] * Stream.RandRange(0, 1);
+        Teams[Index].GatheringPower = Stream.FRandRange(20.0f, 200.0f);
+    }
+
+    TArray<FTaskAllocationCandidate> Tasks;
+    Tasks.SetNum(Result.TaskCount);
+    for (int32 Index = 0; Index < Tasks.Num(); ++Index)
+    {
+        FTaskAllocationCandidate& Task = Tasks[Index];
+        Task.TaskIndex = Index;
+        Task.TaskId = FString::Printf(TEXT("bench_%d"), Index);
+        Task.PriorityPosition = Index;
+
+        const int32 NumSites = Stream.RandRange(1, 3);
+        for (int32 SiteIndex = 0; SiteIndex < NumSites; ++SiteIndex)
+        {
+            const int32 Location = Stream.RandRange(0, 3);
+            FTaskAllocationSite& Site = Task.Sites.AddDefaulted_GetRef();
+            Site.LocationId = FString::Printf(TEXT("site_%d"), Location);
+            Site.DistanceFromBase = SiteDistances[Location];
+            Site.GatheringCoefficient = Stream.FRandRange(0.5f, 2.0f);
+        }
+    }
+
+    const FTaskAllocationWeights Weights;
+    TArray<float> Costs;
+    TArray<int32> Sites;
+
+    const double BuildStart = FPlatformTime::Seconds();
+    BuildCostMatrix(Teams, Tasks, Weights, Costs, Sites);
+    Result.BuildMatrixMs = static_cast<float>((FPlatformTime::Seconds() - BuildStart) * 1000.0);
+
+    TArray<int32> Assignment;
+    const double SolveStart = FPlatformTime::Seconds();
+    Result.TotalCost = SolveAssignment(Costs, Teams.Num(), Tasks.Num(), Assignment);
+    Result.SolveMs = static_cast<float>((FPlatformTime::Seconds() - SolveStart) * 1000.0);
+    Result.DistinctTasks = CountDistinct(Assignment);
+
+    TArray<int32> GreedyAssignment;
+    const double GreedyStart = FPlatformTime::Seconds();
+    Result.GreedyTotalCost = SolveGreedy(Costs, Teams.Num(), Tasks.Num(), GreedyAssignment);
+    Result.GreedyMs = static_cast<float>((FPlatformTime::Seconds() - GreedyStart) * 1000.0);
+    Result.GreedyDistinctTasks = CountDistinct(GreedyAssignment);
+
+    UE_LOG(LogIdleTask, Log, TEXT("TaskAllocation benchmark: %d teams x %d tasks, build %.3f ms, solve %.3f ms (cost %.1f, %d tasks), greedy %.3f ms (cost %.1f, %d tasks)"),
+        Result.TeamCount, Result.TaskCount, Result.BuildMatrixMs, Result.SolveMs, Result.TotalCost, Result.DistinctTasks,
+        Result.GreedyMs, Result.GreedyTotalCost, Result.GreedyDistinctTasks);
+
+    return Result;
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/NoExportTypes.h"
+#include "../Types/TaskAllocationTypes.h"
+#include "TaskAllocationSolver.generated.h"
+
+/**
+ * 「全て」モードのチーム × タスク割り当てソルバー
+ * チームごとに貪欲にタスクを選ぶと同じタスクに集中するため、
+ * 全チーム分のコスト行列（優先度・移動距離・採集力）を1回で作り、割り当て問題としてまとめて解く
+ * 求解はハンガリアン法（チーム数n ≤ タスク数mでO(n²m)）
+ */
+UCLASS(BlueprintType)
+class UE_IDLE_API UTaskAllocationSolver : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * コスト行列を作る（行=チーム、列=タスク）
+     * @param OutSites 各セルで選んだ作業場所の添字（場所を問わないタスクはINDEX_NONE）
+     */
+    static void BuildCostMatrix(const TArray<FTaskAllocationTeam>& Teams, const TArray<FTaskAllocationCandidate>& Tasks,
+        const FTaskAllocationWeights& Weights, TArray<float>& OutCosts, TArray<int32>& OutSites);
+
+    /**
+     * 割り当て問題を解く。各行に異なる列を割り当てて合計コストを最小化する
+     * 行数が列数を超える場合は、余った行を次の周回で同じ列集合に割り当てる
+     * @return 合計コスト
+     */
+    static float SolveAssignment(const TArray<float>& Costs, int32 NumRows, int32 NumColumns, TArray<int32>& OutColumnForRow);
+
+    /** チームごとに最小コストのタスクを選ぶ（比較用の貪欲選択） */
+    static float SolveGreedy(const TArray<float>& Costs, int32 NumRows, int32 NumColumns, TArray<int32>& OutColumnForRow);
+
+    /** コスト行列の構築と求解をまとめて行う */
+    static TArray<FTeamTaskAllocation> Allocate(const TArray<FTaskAllocationTeam>& Teams, const TArray<FTaskAllocationCandidate>& Tasks,
+        const FTaskAllocationWeights& Weights);
+
+    /** 合成データでの計測（既定は100チーム × 1000タスク） */
+    UFUNCTION(BlueprintCallable, Category = "Task Allocation")
+    static FTaskAllocationBenchmarkResult RunBenchmark(int32 NumTeams = 100, int32 NumTasks = 1000, int32 Seed = 12345);
+
+    // 1ターンあたり採集量の換算係数（CalculateTeamGatheringAmountと同じ値）
+    static constexpr float GatheringEfficiencyMultiplier = 40.0f;
+};
@@ -100,6 +100,9 @@ struct UE_IDLE_API FTimedModifier
     UPROPERTY(BlueprintReadWrite, Category = "Timed Modifier")
     FTimerHandle TimerHandle;
 
+    // ターン時計で管理する場合のイベントID（0はタイマー管理）
+    int64 ScheduledEventId = 0;
+
     FTimedModifier()
     {
         // デフォルト値は不要
@@ -0,0 +1,226 @@
+#include "ItemInstanceStoreTypes.h"
+#include "ItemTypes.h"
+
+FItemInstanceHandle FItemInstanceStore::Add(const FItemInstance& Instance)
+{
+    const FSimItemId ItemId = FSimItemId::Intern(Instance.ItemId);
+    if (!ItemId.IsValid())
+    {
+        return FItemInstanceHandle();
+    }
+
+    uint32 Index;
+    if (FreeHead < FreeIndices.Num())
+    {
+        Index = FreeIndices[FreeHead++];
+
+        // 払い出し済みの先頭部分は空になったとき・半分を超えたときにまとめて詰める
+        if (FreeHead == FreeIndices.Num())
+        {
+            FreeIndices.Reset();
+            FreeHead = 0;
+        }
+        else if (FreeHead >= 64 && FreeHead * 2 >= FreeIndices.Num())
+        {
+            FreeIndices.RemoveAt(0, FreeHead, EAllowShrinking::No);
+            FreeHead = 0;
+        }
+    }
+    else
+    {
+        Index = static_cast<uint32>(Generations.Num());
+        if (!ensureMsgf(Index <= FItemInstanceHandle::IndexMask, TEXT("FItemInstanceStore: too many instances")))
+        {
+            return FItemInstanceHandle();
+        }
+
+        ItemIds.AddDefaulted();
+        Durabilities.AddZeroed();
+        EquippedSlots.Add(EEquipmentSlot::None);
+        Generations.Add(1);
+    }
+
+    ItemIds[Index] = ItemId;
+    Durabilities[Index] = Instance.CurrentDurability;
+    EquippedSlots[Index] = Instance.bIsEquipped ? Instance.EquippedSlot : EEquipmentSlot::None;
+    if (Instance.CustomData.Num() > 0)
+    {
+        CustomData.Add(Index, Instance.CustomData);
+    }
+
+    ++NumLive;
+    return FItemInstanceHandle(Index, Generations[Index]);
+}
+
+bool FItemInstanceStore::Remove(FItemInstanceHandle Handle, FItemInstance* OutInstance)
+{
+    if (!IsValid(Handle))
+    {
+        return false;
+    }
+
+    if (OutInstance)
+    {
+        *OutInstance = MakeView(Handle);
+    }
+
+    const uint32 Index = Handle.GetIndex();
+    CustomData.Remove(Index);
+    ItemIds[Index] = FSimItemId();
+    EquippedSlots[Index] = EEquipmentSlot::None;
+
+    // 世代を進めて古いハンドルを無効にする
+    // 世代を使い切った格納位置は一周して古いハンドルと一致しないよう、フリーリストに戻さず廃止する
+    uint16& Generation = Generations[Index];
+    ++Generation;
+    if (Generation < FItemInstanceHandle::GenerationMask)
+    {
+        FreeIndices.Add(Index);
+    }
+    --NumLive;
+    return true;
+}
+
+void FItemInstanceStore::Reset()
+{
+    ItemIds.Reset();
+    Durabilities.Reset();
+    EquippedSlots.Reset();
+    Generations.Reset();
+    FreeIndices.Reset();
+    FreeHead = 0;
+    CustomData.Reset();
+    NumLive = 0;
+}
+
+bool FItemInstanceStore::IsValid(FItemInstanceHandle Handle) const
+{
+    const uint32 Index = Handle.GetIndex();
+    return Handle.IsValid() && Generations.IsValidIndex(Index) && Generations[Index] == Handle.GetGeneration()
+        && ItemIds[Index].IsValid();
+}
+
+FSimItemId FItemInstanceStore::GetItemId(FItemInstanceHandle Handle) const
+{
+    return IsValid(Handle) ? ItemIds[Handle.GetIndex()] : FSimItemId();
+}
+
+int32 FItemInstanceStore::GetDurability(FItemInstanceHandle Handle) const
+{
+    return IsValid(Handle) ? Durabilities[Handle.GetIndex()] : 0;
+}
+
+void FItemInstanceStore::SetDurability(FItemInstanceHandle Handle, int32 Durability)
+{
+    if (IsValid(Handle))
+    {
+        Durabilities[Handle.GetIndex()] = Durability;
+    }
+}
+
+EEquipmentSlot FItemInstanceStore::GetEquippedSlot(FItemInstanceHandle Handle) const
+{
+    return IsValid(Handle) ? EquippedSlots[Handle.GetIndex()] : EEquipmentSlot::None;
+}
+
+bool FItemInstanceStore::IsEquipped(FItemInstanceHandle Handle) const
+{
+    return GetEquippedSlot(Handle) != EEquipmentSlot::None;
+}
+
+void FItemInstanceStore::SetEquippedSlot(FItemInstanceHandle Handle, EEquipmentSlot Slot)
+{
+    if (IsValid(Handle))
+    {
+        EquippedSlots[Handle.GetIndex()] = Slot;
+    }
+}
+
+const TMap<FString, float>* FItemInstanceStore::FindCustomData(FItemInstanceHandle Handle) const
+{
+    return IsValid(Handle) ? CustomData.Find(Handle.GetIndex()) : nullptr;
+}
+
+TMap<FString, float>* FItemInstanceStore::FindOrAddCustomData(FItemInstanceHandle Handle)
+{
+    return IsValid(Handle) ? &CustomData.FindOrAdd(Handle.GetIndex()) : nullptr;
+}
+
+bool FItemInstanceStore::Serialize(FArchive& Ar)
+{
+    int32 NumIndices = Generations.Num();
+    Ar << NumIndices;
+    if (Ar.IsLoading())
+    {
+        Reset();
+        ItemIds.SetNum(NumIndices);
+        Durabilities.SetNumZeroed(NumIndices);
+        EquippedSlots.Init(EEquipmentSlot::None, NumIndices);
+        Generations.SetNumZeroed(NumIndices);
+    }
+
+    for (int32 Index = 0; Index < NumIndices; Index++)
+    {
+        // 番号ではなくID文字列で保存し、読み込み時に登録し直す（解放済みの位置は空文字列）
+        FString ItemId = Ar.IsLoading() ? FString() : ItemIds[Index].ToString();
+        Ar << ItemId;
+        if (Ar.IsLoading())
+        {
+            ItemIds[Index] = FSimItemId::Intern(ItemId);
+        }
+
+        uint8 Slot = static_cast<uint8>(EquippedSlots[Index]);
+        Ar << Slot;
+        EquippedSlots[Index] = static_cast<EEquipmentSlot>(Slot);
+
+        Ar << Durabilities[Index];
+        Ar << Generations[Index];
+    }
+
+    Ar << FreeIndices;
+    Ar << FreeHead;
+    Ar << CustomData;
+    Ar << NumLive;
+    return true;
+}
+
+bool FItemInstanceStore::Identical(const FItemInstanceStore* Other, uint32 PortFlags) const
+{
+    if (!Other || ItemIds != Other->ItemIds || Durabilities != Other->Durabilities || EquippedSlots != Other->EquippedSlots
+        || Generations != Other->Generations || FreeIndices != Other->FreeIndices || FreeHead != Other->FreeHead
+        || NumLive != Other->NumLive || CustomData.Num() != Other->CustomData.Num())
+    {
+        return false;
+    }
+
+    for (const TPair<uint32, TMap<FString, float>>& Entry : CustomData)
+    {
+        const TMap<FString, float>* OtherData = Other->CustomData.Find(Entry.Key);
+        if (!OtherData || !Entry.Value.OrderIndependentCompareEqual(*OtherData))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+FItemInstance FItemInstanceStore::MakeView(FItemInstanceHandle Handle) const
+{
+    FItemInstance View;
+    if (!IsValid(Handle))
+    {
+        return View;
+    }
+
+    const uint32 Index = Handle.GetIndex();
+    View.InstanceHandle = static_cast<int32>(Handle.GetValue());
+    View.ItemId = ItemIds[Index].ToString();
+    View.CurrentDurability = Durabilities[Index];
+    View.EquippedSlot = EquippedSlots[Index];
+    View.bIsEquipped = View.EquippedSlot != EEquipmentSlot::None;
+    if (const TMap<FString, float>* Data = CustomData.Find(Index))
+    {
+        View.CustomData = *Data;
+    }
+    return View;
+}
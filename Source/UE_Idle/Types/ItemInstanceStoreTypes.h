@@ -0,0 +1,126 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SimIdTypes.h"
+#include "ItemInstanceStoreTypes.generated.h"
+
+enum class EEquipmentSlot : uint8;
+struct FItemInstance;
+
+/**
+ * 個体アイテムの32bitハンドル（下位20bit: 格納位置、上位12bit: 世代）
+ * 格納位置は解放後に再利用されるが、世代が変わるので古いハンドルは無効になる
+ * 世代0は発行しないので、値0は常に無効
+ */
+USTRUCT()
+struct FItemInstanceHandle
+{
+    GENERATED_BODY()
+
+    static constexpr uint32 IndexBits = 20;
+    static constexpr uint32 IndexMask = (1u << IndexBits) - 1;
+    static constexpr uint32 GenerationBits = 32 - IndexBits;
+    static constexpr uint32 GenerationMask = (1u << GenerationBits) - 1;
+
+    FItemInstanceHandle() = default;
+
+    FItemInstanceHandle(uint32 InIndex, uint16 InGeneration)
+        : Value(((static_cast<uint32>(InGeneration) & GenerationMask) << IndexBits) | (InIndex & IndexMask)) {}
+
+    bool IsValid() const { return Value != 0; }
+    uint32 GetIndex() const { return Value & IndexMask; }
+    uint16 GetGeneration() const { return static_cast<uint16>(Value >> IndexBits); }
+    uint32 GetValue() const { return Value; }
+
+    static FItemInstanceHandle FromValue(uint32 InValue)
+    {
+        FItemInstanceHandle Handle;
+        Handle.Value = InValue;
+        return Handle;
+    }
+
+    bool operator==(FItemInstanceHandle Other) const { return Value == Other.Value; }
+    bool operator!=(FItemInstanceHandle Other) const { return Value != Other.Value; }
+
+    friend uint32 GetTypeHash(FItemInstanceHandle Handle) { return ::GetTypeHash(Handle.Value); }
+
+private:
+    UPROPERTY()
+    uint32 Value = 0;
+};
+
+/**
+ * 個体アイテム（武器・防具など1個ずつ管理するもの）の格納庫
+ * 個体のデータは項目ごとの連続した配列に置き、解放した位置はフリーリスト（先に解放したものから）で再利用する
+ * 世代を使い切った格納位置は再利用しないので、古いハンドルが別の個体に一致することはない
+ * CustomDataは使う個体が少ないので、格納位置をキーにした疎な表に分けて持つ
+ * インベントリごとに値として持つので、インベントリをコピーすればそのまま複製される
+ * アイテムIDの番号はプロセスごとに異なるのでUPROPERTYにはせず、Serializeで文字列として保存・複製する
+ */
+USTRUCT()
+struct UE_IDLE_API FItemInstanceStore
+{
+    GENERATED_BODY()
+
+public:
+    /** 個体を格納してハンドルを返す（InstanceのInstanceHandleは無視する） */
+    FItemInstanceHandle Add(const FItemInstance& Instance);
+
+    /** 個体を解放する。OutInstanceを渡すと解放前の内容を書き出す */
+    bool Remove(FItemInstanceHandle Handle, FItemInstance* OutInstance = nullptr);
+
+    void Reset();
+
+    bool IsValid(FItemInstanceHandle Handle) const;
+
+    int32 Num() const { return NumLive; }
+
+    // === 個体データ（無効なハンドルは既定値を返す・何もしない） ===
+
+    FSimItemId GetItemId(FItemInstanceHandle Handle) const;
+
+    int32 GetDurability(FItemInstanceHandle Handle) const;
+    void SetDurability(FItemInstanceHandle Handle, int32 Durability);
+
+    EEquipmentSlot GetEquippedSlot(FItemInstanceHandle Handle) const;
+    bool IsEquipped(FItemInstanceHandle Handle) const;
+    void SetEquippedSlot(FItemInstanceHandle Handle, EEquipmentSlot Slot);
+
+    /** CustomData（持たない個体はnullptr） */
+    const TMap<FString, float>* FindCustomData(FItemInstanceHandle Handle) const;
+    TMap<FString, float>* FindOrAddCustomData(FItemInstanceHandle Handle);
+
+    /** Blueprint・UI向けにFItemInstanceとして組み立てる */
+    FItemInstance MakeView(FItemInstanceHandle Handle) const;
+
+    // === リフレクション（セーブ・PIE複製・差分判定用。TStructOpsTypeTraitsで有効化） ===
+
+    bool Serialize(FArchive& Ar);
+    bool Identical(const FItemInstanceStore* Other, uint32 PortFlags) const;
+
+private:
+    // 格納位置ごとの個体データ
+    TArray<FSimItemId> ItemIds;
+    TArray<int32> Durabilities;
+    TArray<EEquipmentSlot> EquippedSlots;
+    TArray<uint16> Generations;
+
+    // 解放済みの格納位置（FreeHeadより前は払い出し済み。古いものから再利用して世代の進みを分散させる）
+    TArray<uint32> FreeIndices;
+    int32 FreeHead = 0;
+
+    // 格納位置 → CustomData（空でない個体のみ）
+    TMap<uint32, TMap<FString, float>> CustomData;
+
+    int32 NumLive = 0;
+};
+
+template<>
+struct TStructOpsTypeTraits<FItemInstanceStore> : public TStructOpsTypeTraitsBase2<FItemInstanceStore>
+{
+    enum
+    {
+        WithSerializer = true,
+        WithIdentical = true,
+    };
+};
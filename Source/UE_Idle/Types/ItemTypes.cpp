@@ -1,6 +1,7 @@
 #include "ItemTypes.h"
 #include "UE_Idle/Managers/ItemDataTableManager.h"
 #include "UE_Idle/Types/ItemDataTable.h"
+#include "UE_Idle/UE_Idle.h"
 
 float FEquipmentSlots::GetTotalWeight(UItemDataTableManager* ItemManager) const
 {
@@ -96,7 +97,12 @@ bool FInventory::AddItem(const FString& ItemId, int32 Quantity, UItemDataTableMa
         FInventorySlot* ExistingSlot = FindSlot(ItemId);
         if (ExistingSlot)
         {
+            if (ExistingSlot->UnitWeight < 0.0f)
+            {
+                ExistingSlot->UnitWeight = ItemWeight;
+            }
             ExistingSlot->AddStackableItem(Quantity);
+            AdjustTotalWeight(*ExistingSlot, Quantity);
             return true;
         }
         else
@@ -106,8 +112,9 @@ bool FInventory::AddItem(const FString& ItemId, int32 Quantity, UItemDataTableMa
                 return false;
             }
             FInventorySlot NewSlot(ItemId);
+            NewSlot.UnitWeight = ItemWeight;
             NewSlot.AddStackableItem(Quantity);
-            Slots.Add(NewSlot);
+            AddSlot(NewSlot);
             return true;
         }
     }
@@ -142,13 +149,26 @@ bool FInventory::AddItemInstance(const FItemInstance& Instance, UItemDataTableMa
         {
             return false;
         }
+        const FItemInstanceHandle Handle = Instances.Add(Instance);
+        if (!Handle.IsValid())
+        {
+            return false;
+        }
         FInventorySlot NewSlot(Instance.ItemId);
-        NewSlot.AddInstance(Instance);
-        Slots.Add(NewSlot);
+        EnsureUnitWeight(NewSlot, ItemManager);
+        NewSlot.AddInstance(Handle);
+        AddSlot(NewSlot);
     }
     else
     {
-        Slot->AddInstance(Instance);
+        const FItemInstanceHandle Handle = Instances.Add(Instance);
+        if (!Handle.IsValid())
+        {
+            return false;
+        }
+        EnsureUnitWeight(*Slot, ItemManager);
+        Slot->AddInstance(Handle);
+        AdjustTotalWeight(*Slot, 1);
     }
     return true;
 }
@@ -160,116 +180,278 @@ bool FInventory::RemoveItem(const FString& ItemId, int32 Quantity)
         return false;
     }
 
-    FInventorySlot* Slot = FindSlot(ItemId);
-    if (!Slot || Slot->Quantity < Quantity)
+    const int32 SlotIndex = FindSlotIndex(ItemId);
+    if (SlotIndex == INDEX_NONE || Slots[SlotIndex].Quantity < Quantity)
     {
         return false;
     }
 
+    FInventorySlot& Slot = Slots[SlotIndex];
+
     // Stackable items
-    if (Slot->ItemInstances.Num() == 0)
+    if (!Slot.HasInstances())
     {
-        bool bSuccess = Slot->RemoveStackableItem(Quantity);
-        if (bSuccess && Slot->Quantity == 0)
+        bool bSuccess = Slot.RemoveStackableItem(Quantity);
+        if (bSuccess)
         {
-            Slots.RemoveAll([&ItemId](const FInventorySlot& InSlot)
-            {
-                return InSlot.ItemId == ItemId;
-            });
+            AdjustTotalWeight(Slot, -Quantity);
+        }
+        if (bSuccess && Slot.Quantity == 0)
+        {
+            RemoveSlotAt(SlotIndex);
         }
         return bSuccess;
     }
     // Non-stackable items
     else
     {
+        // 装備中の個体は取り除かない（装備参照が無効なハンドルを指さないように）
+        if (GetUnequippedItemCount(ItemId) < Quantity)
+        {
+            return false;
+        }
+
+        // 装備していないものを古い順に取り除き、残りは順序を保って詰める
         int32 RemovedCount = 0;
-        while (RemovedCount < Quantity && Slot->ItemInstances.Num() > 0)
+        int32 WriteIndex = 0;
+        for (int32 ReadIndex = 0; ReadIndex < Slot.InstanceHandles.Num(); ++ReadIndex)
         {
-            Slot->ItemInstances.RemoveAt(0);
-            RemovedCount++;
+            const FItemInstanceHandle Handle = Slot.InstanceHandles[ReadIndex];
+            if (RemovedCount < Quantity && !Instances.IsEquipped(Handle))
+            {
+                Instances.Remove(Handle);
+                ++RemovedCount;
+            }
+            else
+            {
+                Slot.InstanceHandles[WriteIndex++] = Handle;
+            }
         }
-        Slot->Quantity = Slot->ItemInstances.Num();
+        Slot.InstanceHandles.SetNum(WriteIndex, EAllowShrinking::No);
+        Slot.Quantity = Slot.InstanceHandles.Num();
+        AdjustTotalWeight(Slot, -RemovedCount);
         
-        if (Slot->Quantity == 0)
+        if (Slot.Quantity == 0)
         {
-            Slots.RemoveAll([&ItemId](const FInventorySlot& InSlot)
-            {
-                return InSlot.ItemId == ItemId;
-            });
+            RemoveSlotAt(SlotIndex);
         }
         
-        return RemovedCount == Quantity;
+        return true;
     }
 }
 
-bool FInventory::RemoveItemInstance(const FGuid& InstanceId, FItemInstance& OutInstance)
+bool FInventory::RemoveItemInstance(FItemInstanceHandle Handle, FItemInstance& OutInstance)
 {
-    for (FInventorySlot& Slot : Slots)
+    // ハンドル → アイテムID → スロットの順に引く（スロットの走査はしない）
+    if (!Instances.IsValid(Handle))
     {
-        if (FItemInstance* Instance = Slot.GetInstance(InstanceId))
-        {
-            OutInstance = *Instance;
-            Slot.RemoveInstance(InstanceId);
-            
-            if (Slot.Quantity == 0)
-            {
-                Slots.RemoveAll([&Slot](const FInventorySlot& InSlot)
-                {
-                    return InSlot.ItemId == Slot.ItemId;
-                });
-            }
-            return true;
-        }
+        return false;
+    }
+
+    const int32 SlotIndex = FindSlotIndex(Instances.GetItemId(Handle).ToString());
+    if (SlotIndex == INDEX_NONE || !Slots[SlotIndex].RemoveInstance(Handle))
+    {
+        return false;
+    }
+
+    Instances.Remove(Handle, &OutInstance);
+
+    FInventorySlot& Slot = Slots[SlotIndex];
+    AdjustTotalWeight(Slot, -1);
+    if (Slot.Quantity == 0)
+    {
+        RemoveSlotAt(SlotIndex);
     }
-    return false;
+    return true;
 }
 
 FInventorySlot* FInventory::FindSlot(const FString& ItemId)
 {
-    for (FInventorySlot& Slot : Slots)
+    const int32 SlotIndex = FindSlotIndex(ItemId);
+    return SlotIndex != INDEX_NONE ? &Slots[SlotIndex] : nullptr;
+}
+
+const FInventorySlot* FInventory::FindSlot(const FString& ItemId) const
+{
+    const int32 SlotIndex = FindSlotIndex(ItemId);
+    return SlotIndex != INDEX_NONE ? &Slots[SlotIndex] : nullptr;
+}
+
+int32 FInventory::FindSlotIndex(const FString& ItemId) const
+{
+    if (IndexedSlotCount != Slots.Num())
     {
-        if (Slot.ItemId == ItemId)
-        {
-            return &Slot;
-        }
+        RebuildSlotIndex();
+    }
+
+    const int32* SlotIndex = SlotIndexByItem.Find(ItemId);
+    if (!SlotIndex)
+    {
+        return INDEX_NONE;
+    }
+
+    // Slotsが直接書き換えられていた場合は作り直してから引き直す
+    if (!Slots.IsValidIndex(*SlotIndex) || Slots[*SlotIndex].ItemId != ItemId)
+    {
+        RebuildSlotIndex();
+        SlotIndex = SlotIndexByItem.Find(ItemId);
+        return SlotIndex ? *SlotIndex : INDEX_NONE;
+    }
+
+    return *SlotIndex;
+}
+
+int32 FInventory::AddSlot(const FInventorySlot& NewSlot)
+{
+    if (IndexedSlotCount != Slots.Num())
+    {
+        RebuildSlotIndex();
+    }
+
+    const int32 SlotIndex = Slots.Add(NewSlot);
+    SlotIndexByItem.Add(NewSlot.ItemId, SlotIndex);
+    IndexedSlotCount = Slots.Num();
+    AdjustTotalWeight(NewSlot, NewSlot.Quantity);
+    return SlotIndex;
+}
+
+void FInventory::RemoveSlotAt(int32 SlotIndex)
+{
+    if (!Slots.IsValidIndex(SlotIndex))
+    {
+        return;
+    }
+
+    if (IndexedSlotCount != Slots.Num())
+    {
+        RebuildSlotIndex();
+    }
+
+    AdjustTotalWeight(Slots[SlotIndex], -Slots[SlotIndex].Quantity);
+    for (FItemInstanceHandle Handle : Slots[SlotIndex].InstanceHandles)
+    {
+        Instances.Remove(Handle);
+    }
+    SlotIndexByItem.Remove(Slots[SlotIndex].ItemId);
+    Slots.RemoveAtSwap(SlotIndex);
+
+    // 末尾から移ってきたスロットの添字を付け替える
+    if (Slots.IsValidIndex(SlotIndex))
+    {
+        SlotIndexByItem.Add(Slots[SlotIndex].ItemId, SlotIndex);
+    }
+    IndexedSlotCount = Slots.Num();
+
+    // 空になれば誤差の蓄積もリセットできる
+    if (Slots.Num() == 0)
+    {
+        CachedTotalWeight = 0.0;
+        bTotalWeightValid = true;
     }
-    return nullptr;
 }
 
-FItemInstance* FInventory::FindInstance(const FGuid& InstanceId)
+void FInventory::RebuildSlotIndex() const
 {
-    for (FInventorySlot& Slot : Slots)
+    SlotIndexByItem.Reset();
+    SlotIndexByItem.Reserve(Slots.Num());
+    for (int32 SlotIndex = 0; SlotIndex < Slots.Num(); ++SlotIndex)
     {
-        if (FItemInstance* Instance = Slot.GetInstance(InstanceId))
+        // 同じIDのスロットが重複していれば先頭を使う（従来の線形探索と同じ）
+        if (!SlotIndexByItem.Contains(Slots[SlotIndex].ItemId))
         {
-            return Instance;
+            SlotIndexByItem.Add(Slots[SlotIndex].ItemId, SlotIndex);
         }
     }
-    return nullptr;
+    IndexedSlotCount = Slots.Num();
+
+    // Slotsが直接書き換えられていたので総重量も次の参照時に数え直す
+    bTotalWeightValid = false;
 }
 
-const FItemInstance* FInventory::FindInstance(const FGuid& InstanceId) const
+void FInventory::AdjustTotalWeight(const FInventorySlot& Slot, int32 QuantityDelta)
 {
-    for (const FInventorySlot& Slot : Slots)
+    if (QuantityDelta == 0 || !bTotalWeightValid)
     {
-        if (const FItemInstance* Instance = Slot.GetInstance(InstanceId))
+        return;
+    }
+
+    if (Slot.UnitWeight < 0.0f)
+    {
+        bTotalWeightValid = false;
+        return;
+    }
+
+    CachedTotalWeight += static_cast<double>(Slot.UnitWeight) * QuantityDelta;
+}
+
+void FInventory::EnsureUnitWeight(FInventorySlot& Slot, UItemDataTableManager* ItemManager)
+{
+    if (Slot.UnitWeight >= 0.0f || !ItemManager)
+    {
+        return;
+    }
+
+    FItemDataRow ItemData;
+    if (ItemManager->GetItemData(Slot.ItemId, ItemData))
+    {
+        Slot.UnitWeight = ItemData.Weight;
+    }
+}
+
+FItemInstanceHandle FInventory::FindUnequippedInstance(const FString& ItemId) const
+{
+    if (const FInventorySlot* Slot = FindSlot(ItemId))
+    {
+        for (FItemInstanceHandle Handle : Slot->InstanceHandles)
         {
-            return Instance;
+            if (!Instances.IsEquipped(Handle))
+            {
+                return Handle;
+            }
         }
     }
-    return nullptr;
+    return FItemInstanceHandle();
+}
+
+TArray<FItemInstance> FInventory::MakeInstanceViews(const FInventorySlot& Slot) const
+{
+    TArray<FItemInstance> Views;
+    Views.Reserve(Slot.InstanceHandles.Num());
+    for (FItemInstanceHandle Handle : Slot.InstanceHandles)
+    {
+        Views.Add(Instances.MakeView(Handle));
+    }
+    return Views;
 }
 
 int32 FInventory::GetItemCount(const FString& ItemId) const
 {
-    for (const FInventorySlot& Slot : Slots)
+    const FInventorySlot* Slot = FindSlot(ItemId);
+    return Slot ? Slot->Quantity : 0;
+}
+
+int32 FInventory::GetUnequippedItemCount(const FString& ItemId) const
+{
+    const FInventorySlot* Slot = FindSlot(ItemId);
+    if (!Slot)
+    {
+        return 0;
+    }
+
+    if (!Slot->HasInstances())
+    {
+        return Slot->Quantity;
+    }
+
+    int32 Count = 0;
+    for (FItemInstanceHandle Handle : Slot->InstanceHandles)
     {
-        if (Slot.ItemId == ItemId)
+        if (!Instances.IsEquipped(Handle))
         {
-            return Slot.Quantity;
+            ++Count;
         }
     }
-    return 0;
+    return Count;
 }
 
 float FInventory::GetTotalWeight(UItemDataTableManager* ItemManager) const
@@ -279,6 +461,48 @@ float FInventory::GetTotalWeight(UItemDataTableManager* ItemManager) const
         return 0.0f;
     }
 
+    // Slotsが直接書き換えられていれば索引と一緒に作り直す
+    if (IndexedSlotCount != Slots.Num())
+    {
+        RebuildSlotIndex();
+    }
+
+    if (!bTotalWeightValid)
+    {
+        CachedTotalWeight = ComputeTotalWeight(ItemManager);
+        bTotalWeightValid = true;
+    }
+#if IDLE_SIM_VALIDATE_INVENTORY_WEIGHT
+    else
+    {
+        ValidateTotalWeight(ItemManager);
+    }
+#endif
+
+    return static_cast<float>(CachedTotalWeight);
+}
+
+bool FInventory::ValidateTotalWeight(UItemDataTableManager* ItemManager) const
+{
+    if (!bTotalWeightValid)
+    {
+        return true;
+    }
+
+    const float FullWeight = ComputeTotalWeight(ItemManager);
+    const bool bMatches = FMath::IsNearlyEqual(static_cast<float>(CachedTotalWeight), FullWeight, 0.01f);
+    ensureMsgf(bMatches, TEXT("FInventory: cached weight %.3f differs from recomputed %.3f (%d slots)"),
+        CachedTotalWeight, FullWeight, Slots.Num());
+    return bMatches;
+}
+
+float FInventory::ComputeTotalWeight(UItemDataTableManager* ItemManager) const
+{
+    if (!ItemManager)
+    {
+        return 0.0f;
+    }
+
     float TotalWeight = 0.0f;
     for (const FInventorySlot& Slot : Slots)
     {
@@ -299,14 +523,14 @@ int32 FInventory::GetUsedSlots() const
     for (const FInventorySlot& Slot : Slots)
     {
         // Stackable items take 1 slot
-        if (Slot.ItemInstances.Num() == 0)
+        if (!Slot.HasInstances())
         {
             UsedSlots += 1;
         }
         // Non-stackable items take 1 slot per instance
         else
         {
-            UsedSlots += Slot.ItemInstances.Num();
+            UsedSlots += Slot.InstanceHandles.Num();
         }
     }
     return UsedSlots;
@@ -332,17 +556,12 @@ bool FInventory::HasSpace(const FString& ItemId, int32 Quantity, UItemDataTableM
         return false;
     }
 
-    FItemDataRow CheckItemData;
-    if (!ItemManager->GetItemData(ItemId, CheckItemData))
-    {
-        return false;
-    }
-    int32 StackSize = CheckItemData.StackSize;
+    int32 StackSize = ItemData.StackSize;
     
     // Stackable items
     if (StackSize > 1)
     {
-        const FInventorySlot* ExistingSlot = const_cast<FInventory*>(this)->FindSlot(ItemId);
+        const FInventorySlot* ExistingSlot = FindSlot(ItemId);
         if (ExistingSlot)
         {
             return true; // Can add to existing stack
@@ -356,4 +575,56 @@ bool FInventory::HasSpace(const FString& ItemId, int32 Quantity, UItemDataTableM
     }
 }
 
+bool FInventory::HasSpaceForAll(const TMap<FString, int32>& Manifest, UItemDataTableManager* ItemManager) const
+{
+    if (!ItemManager)
+    {
+        return false;
+    }
+
+    float TotalWeight = GetTotalWeight(ItemManager);
+    int32 UsedSlots = GetUsedSlots();
+    for (const TPair<FString, int32>& Entry : Manifest)
+    {
+        if (Entry.Value <= 0)
+        {
+            continue;
+        }
+
+        FItemDataRow ItemData;
+        if (!ItemManager->IsValidItem(Entry.Key) || !ItemManager->GetItemData(Entry.Key, ItemData))
+        {
+            return false;
+        }
+
+        TotalWeight += ItemData.Weight * Entry.Value;
+        if (TotalWeight > MaxWeight)
+        {
+            return false;
+        }
+
+        // AddItemと同じスロットの数え方（スタック品は新規スロットのみ1、個体品は1個につき1）
+        if (ItemData.StackSize > 1)
+        {
+            if (!FindSlot(Entry.Key))
+            {
+                if (UsedSlots >= MaxSlots)
+                {
+                    return false;
+                }
+                UsedSlots++;
+            }
+        }
+        else
+        {
+            if (UsedSlots + Entry.Value > MaxSlots)
+            {
+                return false;
+            }
+            UsedSlots += Entry.Value;
+        }
+    }
+    return true;
+}
+
 // FItemDataRowの実装メソッドはItemDataTable.cppに移動されました
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Engine/DataTable.h"
+#include "ItemInstanceStoreTypes.h"
 #include "ItemTypes.generated.h"
 
 UENUM(BlueprintType)
@@ -73,13 +74,15 @@ enum class EConsumableType : uint8
 // 古いFItemData関連の構造体は削除されました
 // 新しいFItemDataRowシステム（ItemDataTable.h）を使用してください
 
+// 個体アイテムの内容（インベントリ内ではFItemInstanceStoreに格納し、これは受け渡し・表示用）
 USTRUCT(BlueprintType)
 struct FItemInstance
 {
     GENERATED_BODY()
 
-    UPROPERTY(EditAnywhere, BlueprintReadWrite)
-    FGuid InstanceId;
+    // 格納先インベントリでのハンドル値（FItemInstanceHandle。未格納は0）
+    UPROPERTY(BlueprintReadOnly)
+    int32 InstanceHandle = 0;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
     FString ItemId;
@@ -97,16 +100,10 @@ struct FItemInstance
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
     EEquipmentSlot EquippedSlot = EEquipmentSlot::None;
 
-    FItemInstance() 
-    {
-        InstanceId = FGuid::NewGuid();
-    }
+    FItemInstance() {}
 
     FItemInstance(const FString& InItemId, int32 InDurability = 100)
-        : ItemId(InItemId), CurrentDurability(InDurability)
-    {
-        InstanceId = FGuid::NewGuid();
-    }
+        : ItemId(InItemId), CurrentDurability(InDurability) {}
 };
 
 USTRUCT(BlueprintType)
@@ -120,9 +117,17 @@ struct FInventorySlot
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
     int32 Quantity = 0;
 
+    // 個体の内容（表示用。UInventoryComponent::GetAllSlotsで埋める。インベントリ内部ではInstanceHandlesを使う）
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
     TArray<FItemInstance> ItemInstances;
 
+    // 個体アイテムのハンドル（古い順）。空ならスタック可能アイテム
+    UPROPERTY()
+    TArray<FItemInstanceHandle> InstanceHandles;
+
+    // 1個あたりの重量（スロット作成時にDataTableから取得。負は未取得）
+    float UnitWeight = -1.0f;
+
     FInventorySlot() {}
 
     FInventorySlot(const FString& InItemId)
@@ -133,10 +138,15 @@ struct FInventorySlot
         Quantity += Amount;
     }
 
-    void AddInstance(const FItemInstance& Instance)
+    bool HasInstances() const
     {
-        ItemInstances.Add(Instance);
-        Quantity = ItemInstances.Num();
+        return InstanceHandles.Num() > 0;
+    }
+
+    void AddInstance(FItemInstanceHandle Handle)
+    {
+        InstanceHandles.Add(Handle);
+        Quantity = InstanceHandles.Num();
     }
 
     bool RemoveStackableItem(int32 Amount)
@@ -149,38 +159,11 @@ struct FInventorySlot
         return false;
     }
 
-    bool RemoveInstance(const FGuid& InstanceId)
+    bool RemoveInstance(FItemInstanceHandle Handle)
     {
-        int32 RemovedCount = ItemInstances.RemoveAll([&InstanceId](const FItemInstance& Instance)
-        {
-            return Instance.InstanceId == InstanceId;
-        });
-        Quantity = ItemInstances.Num();
-        return RemovedCount > 0;
-    }
-
-    FItemInstance* GetInstance(const FGuid& InstanceId)
-    {
-        for (FItemInstance& Instance : ItemInstances)
-        {
-            if (Instance.InstanceId == InstanceId)
-            {
-                return &Instance;
-            }
-        }
-        return nullptr;
-    }
-    
-    const FItemInstance* GetInstance(const FGuid& InstanceId) const
-    {
-        for (const FItemInstance& Instance : ItemInstances)
-        {
-            if (Instance.InstanceId == InstanceId)
-            {
-                return &Instance;
-            }
-        }
-        return nullptr;
+        const bool bRemoved = InstanceHandles.RemoveSingle(Handle) > 0;
+        Quantity = InstanceHandles.Num();
+        return bRemoved;
     }
 };
 
@@ -192,23 +175,24 @@ struct FEquipmentReference
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
     FString ItemId;
 
-    UPROPERTY(EditAnywhere, BlueprintReadWrite)
-    FGuid InstanceId;
+    // 装備中の個体（所持インベントリのFItemInstanceStoreのハンドル）
+    UPROPERTY()
+    FItemInstanceHandle InstanceHandle;
 
     FEquipmentReference() {}
 
-    FEquipmentReference(const FString& InItemId, const FGuid& InInstanceId)
-        : ItemId(InItemId), InstanceId(InInstanceId) {}
+    FEquipmentReference(const FString& InItemId, FItemInstanceHandle InInstanceHandle)
+        : ItemId(InItemId), InstanceHandle(InInstanceHandle) {}
 
     bool IsEmpty() const 
     { 
-        return ItemId.IsEmpty() || !InstanceId.IsValid(); 
+        return ItemId.IsEmpty() || !InstanceHandle.IsValid(); 
     }
 
     void Clear()
     {
         ItemId.Empty();
-        InstanceId.Invalidate();
+        InstanceHandle = FItemInstanceHandle();
     }
 };
 
@@ -309,12 +293,106 @@ struct FInventory
     bool AddItem(const FString& ItemId, int32 Quantity, class UItemDataTableManager* ItemManager);
     bool AddItemInstance(const FItemInstance& Instance, class UItemDataTableManager* ItemManager);
     bool RemoveItem(const FString& ItemId, int32 Quantity);
-    bool RemoveItemInstance(const FGuid& InstanceId, FItemInstance& OutInstance);
+    bool RemoveItemInstance(FItemInstanceHandle Handle, FItemInstance& OutInstance);
     FInventorySlot* FindSlot(const FString& ItemId);
-    FItemInstance* FindInstance(const FGuid& InstanceId);
-    const FItemInstance* FindInstance(const FGuid& InstanceId) const;
+    const FInventorySlot* FindSlot(const FString& ItemId) const;
     int32 GetItemCount(const FString& ItemId) const;
+
+    /** 装備していない個数（RemoveItemで取り除ける上限。スタック品は所持数と同じ） */
+    int32 GetUnequippedItemCount(const FString& ItemId) const;
     float GetTotalWeight(class UItemDataTableManager* ItemManager) const;
     bool HasSpace(const FString& ItemId, int32 Quantity, class UItemDataTableManager* ItemManager) const;
+
+    /** 複数品目をまとめて追加できるか（AddItemを順に呼んだときの重量・スロット判定を累積で行う） */
+    bool HasSpaceForAll(const TMap<FString, int32>& Manifest, class UItemDataTableManager* ItemManager) const;
     int32 GetUsedSlots() const;
+
+    // === スロット索引 ===
+
+    /** アイテムIDのスロット添字（なければINDEX_NONE） */
+    int32 FindSlotIndex(const FString& ItemId) const;
+
+    /** スロットを末尾に追加して索引に登録し、添字を返す */
+    int32 AddSlot(const FInventorySlot& NewSlot);
+
+    /** スロットを末尾のスロットと入れ替えて削除する（スロットの並び順は保たれない） */
+    void RemoveSlotAt(int32 SlotIndex);
+
+    /** Slotsから索引を作り直す */
+    void RebuildSlotIndex() const;
+
+    // === 個体アイテム ===
+
+    /** 個体がこのインベントリにあるか */
+    bool ContainsInstance(FItemInstanceHandle Handle) const { return Instances.IsValid(Handle); }
+
+    /** 装備していない最も古い個体（なければ無効なハンドル） */
+    FItemInstanceHandle FindUnequippedInstance(const FString& ItemId) const;
+
+    /** 個体の装備先を設定する（Noneで外す） */
+    void SetInstanceEquippedSlot(FItemInstanceHandle Handle, EEquipmentSlot Slot) { Instances.SetEquippedSlot(Handle, Slot); }
+
+    /** スロットの個体をFItemInstanceとして組み立てる（表示用） */
+    TArray<FItemInstance> MakeInstanceViews(const FInventorySlot& Slot) const;
+
+    const FItemInstanceStore& GetInstanceStore() const { return Instances; }
+
+    // === 重量 ===
+
+    /** DataTableを引き直して全スロットの重量を合計する（キャッシュを使わない） */
+    float ComputeTotalWeight(class UItemDataTableManager* ItemManager) const;
+
+    /** キャッシュした総重量と全再計算を照合する（検証用） */
+    bool ValidateTotalWeight(class UItemDataTableManager* ItemManager) const;
+
+private:
+    /** スロットの個数変化を総重量キャッシュに反映する（単位重量が未取得ならキャッシュを無効化） */
+    void AdjustTotalWeight(const FInventorySlot& Slot, int32 QuantityDelta);
+
+    /** 単位重量が未取得のスロットに設定する */
+    static void EnsureUnitWeight(FInventorySlot& Slot, class UItemDataTableManager* ItemManager);
+
+    // 個体アイテムの格納庫（スロットはハンドルだけを持つ）
+    UPROPERTY()
+    FItemInstanceStore Instances;
+
+    // 総重量（追加・削除のたびに差分で更新する）
+    mutable double CachedTotalWeight = 0.0;
+    mutable bool bTotalWeightValid = false;
+
+    // アイテムID → Slotsの添字（スロットの追加・削除と同時に更新する）
+    mutable TMap<FString, int32> SlotIndexByItem;
+
+    // 索引を作った時点のスロット数。Slotsを直接書き換えられた場合（エディタ設定・ロード）はずれるので作り直す
+    mutable int32 IndexedSlotCount = 0;
+};
+
+// インベントリのスロット索引のベンチマーク結果
+USTRUCT(BlueprintType)
+struct FInventorySlotBenchmarkResult
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Inventory")
+    int32 ItemTypeCount = 0;
+
+    // 計測した検索・削除の回数
+    UPROPERTY(BlueprintReadOnly, Category = "Inventory")
+    int32 OperationCount = 0;
+
+    // 比較用：従来の線形探索での個数取得（ミリ秒）
+    UPROPERTY(BlueprintReadOnly, Category = "Inventory")
+    float LinearLookupMs = 0.0f;
+
+    // 索引を使った個数取得（ミリ秒）
+    UPROPERTY(BlueprintReadOnly, Category = "Inventory")
+    float IndexedLookupMs = 0.0f;
+
+    // 比較用：従来の線形探索 + RemoveAllでのスロット削除と再追加（ミリ秒）
+    UPROPERTY(BlueprintReadOnly, Category = "Inventory")
+    float LinearChurnMs = 0.0f;
+
+    // 索引 + 入れ替え削除でのスロット削除と再追加（ミリ秒）
+    UPROPERTY(BlueprintReadOnly, Category = "Inventory")
+    float IndexedChurnMs = 0.0f;
 };
\ No newline at end of file
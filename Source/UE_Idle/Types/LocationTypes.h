@@ -142,6 +142,12 @@ struct FLocationDataRow : public FTableRowBase
 
     // ランダムに敵を選択するヘルパー関数
     FString GetRandomEnemyPreset() const
+    {
+        return GetRandomEnemyPreset(FMath::FRand());
+    }
+
+    // 乱数値 [0, 1) を指定して敵を選択するヘルパー関数
+    FString GetRandomEnemyPreset(float RandomRatio) const
     {
         TArray<FEnemySpawnInfo> SpawnList = ParseEnemySpawnList();
         
@@ -158,7 +164,7 @@ struct FLocationDataRow : public FTableRowBase
         }
 
         // ランダム値生成
-        float RandomValue = FMath::FRand() * TotalProbability;
+        float RandomValue = RandomRatio * TotalProbability;
 
         // 累積確率で選択
         float CurrentSum = 0.0f;
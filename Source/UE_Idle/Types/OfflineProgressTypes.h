@@ -0,0 +1,113 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OfflineProgressTypes.generated.h"
+
+// オフライン進行の区間タイプ
+UENUM(BlueprintType)
+enum class EOfflineSegmentType : uint8
+{
+    Travel      UMETA(DisplayName = "移動"),
+    Gathering   UMETA(DisplayName = "採集"),
+    Unload      UMETA(DisplayName = "荷下ろし"),
+    Cycle       UMETA(DisplayName = "採集周期"),      // 帰還→荷下ろし→出発→採集 の繰り返しをまとめた区間
+    Idle        UMETA(DisplayName = "待機"),
+    Production  UMETA(DisplayName = "施設生産")
+};
+
+// オフライン進行の1区間（ターン単位の区分線形モデル）
+USTRUCT(BlueprintType)
+struct FOfflineProgressSegment
+{
+    GENERATED_BODY()
+
+    // 対象チーム（施設生産は-1）
+    UPROPERTY(BlueprintReadOnly, Category = "Offline Progress")
+    int32 TeamIndex = -1;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Offline Progress")
+    EOfflineSegmentType SegmentType = EOfflineSegmentType::Idle;
+
+    // 区間 [StartTurn, EndTurn)
+    UPROPERTY(BlueprintReadOnly, Category = "Offline Progress")
+    int32 StartTurn = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Offline Progress")
+    int32 EndTurn = 0;
+
+    // Cycle区間の繰り返し回数
+    UPROPERTY(BlueprintReadOnly, Category = "Offline Progress")
+    int32 RepeatCount = 1;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Offline Progress")
+    FString LocationId;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Offline Progress")
+    FString ItemId;
+
+    // 区間内で得られる数量
+    UPROPERTY(BlueprintReadOnly, Category = "Offline Progress")
+    int32 Quantity = 0;
+};
+
+// チームごとのオフライン進行結果
+USTRUCT(BlueprintType)
+struct FOfflineTeamOutcome
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Offline Progress")
+    int32 TeamIndex = -1;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Offline Progress")
+    FString ItemId;
+
+    // 最終的な滞在場所（"base" または採集場所）
+    UPROPERTY(BlueprintReadOnly, Category = "Offline Progress")
+    FString FinalLocationId;
+
+    // 期間中の総採集量
+    UPROPERTY(BlueprintReadOnly, Category = "Offline Progress")
+    int32 TotalGathered = 0;
+
+    // メンバーインベントリに追加する数量（未荷下ろし分）
+    UPROPERTY(BlueprintReadOnly, Category = "Offline Progress")
+    int32 CarriedToAdd = 0;
+
+    // 開始時の所持品を荷下ろし済みか（trueならメンバーの所持品を倉庫へ移す）
+    UPROPERTY(BlueprintReadOnly, Category = "Offline Progress")
+    bool bInitialItemsUnloaded = false;
+
+    // タスク目標到達によって途中で採集を打ち切ったターン（-1は打ち切りなし）
+    UPROPERTY(BlueprintReadOnly, Category = "Offline Progress")
+    int32 CutoffTurn = -1;
+};
+
+// オフライン進行の計算結果（ApplyOfflineProgressで一括反映）
+USTRUCT(BlueprintType)
+struct FOfflineProgressResult
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Offline Progress")
+    float ElapsedSeconds = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Offline Progress")
+    int32 SimulatedTurns = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Offline Progress")
+    TArray<FOfflineProgressSegment> Segments;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Offline Progress")
+    TArray<FOfflineTeamOutcome> TeamOutcomes;
+
+    // 拠点倉庫に追加される数量（荷下ろし分 + 施設生産分、開始時所持品は含まない）
+    UPROPERTY(BlueprintReadOnly, Category = "Offline Progress")
+    TMap<FString, int32> StorageGains;
+
+    // タスクID → 進捗加算量
+    UPROPERTY(BlueprintReadOnly, Category = "Offline Progress")
+    TMap<FString, int32> TaskProgress;
+
+    int32 GetSegmentCount() const { return Segments.Num(); }
+};
@@ -0,0 +1,179 @@
+#include "RecipeGraphTypes.h"
+
+void FRecipeGraph::AddRecipe(const FString& RecipeId, const FString& OutputItemId, int32 OutputQuantity,
+                             const TMap<FString, int32>& Inputs, bool bRequiresUnlock)
+{
+    const FSimItemId OutputId = FSimItemId::Intern(OutputItemId);
+    if (!OutputId.IsValid())
+    {
+        return;
+    }
+
+    FRecipeNode Node;
+    Node.RecipeId = FSimItemId::Intern(RecipeId);
+    Node.OutputItemId = OutputId;
+    Node.OutputQuantity = FMath::Max(1, OutputQuantity);
+    Node.bRequiresUnlock = bRequiresUnlock;
+    Node.Inputs.Reserve(Inputs.Num());
+    for (const TPair<FString, int32>& Input : Inputs)
+    {
+        if (Input.Value > 0)
+        {
+            Node.Inputs.Emplace(FSimItemId::Intern(Input.Key), Input.Value);
+        }
+    }
+
+    if (const int32* ExistingIndex = RecipeIndexByOutput.Find(OutputId))
+    {
+        Recipes[*ExistingIndex] = MoveTemp(Node);
+    }
+    else
+    {
+        RecipeIndexByOutput.Add(OutputId, Recipes.Add(MoveTemp(Node)));
+    }
+
+    Invalidate();
+}
+
+void FRecipeGraph::Reset()
+{
+    Recipes.Reset();
+    RecipeIndexByOutput.Reset();
+    UnlockedRecipes.Reset();
+    Invalidate();
+}
+
+bool FRecipeGraph::SetUnlockedRecipes(const TArray<FString>& UnlockedRecipeIds)
+{
+    TSet<FSimItemId> NewUnlocked;
+    NewUnlocked.Reserve(UnlockedRecipeIds.Num());
+    for (const FString& RecipeId : UnlockedRecipeIds)
+    {
+        NewUnlocked.Add(FSimItemId::Intern(RecipeId));
+    }
+
+    if (NewUnlocked.Num() == UnlockedRecipes.Num() && NewUnlocked.Includes(UnlockedRecipes))
+    {
+        return false;
+    }
+
+    UnlockedRecipes = MoveTemp(NewUnlocked);
+    Invalidate();
+    return true;
+}
+
+const FRecipeGraph::FRecipeNode* FRecipeGraph::FindAvailableRecipe(FSimItemId ItemId) const
+{
+    const int32* RecipeIndex = RecipeIndexByOutput.Find(ItemId);
+    if (!RecipeIndex)
+    {
+        return nullptr;
+    }
+
+    const FRecipeNode& Recipe = Recipes[*RecipeIndex];
+    if (Recipe.bRequiresUnlock && !UnlockedRecipes.Contains(Recipe.RecipeId))
+    {
+        return nullptr;
+    }
+
+    return &Recipe;
+}
+
+TArray<FRecipeMaterial> FRecipeGraph::Expand(FSimItemId ItemId, int32 Quantity) const
+{
+    TArray<FRecipeMaterial> Result;
+    if (Quantity <= 0)
+    {
+        return Result;
+    }
+
+    const FRecipeNode* Recipe = FindAvailableRecipe(ItemId);
+    if (!Recipe)
+    {
+        Result.Emplace(ItemId, Quantity);
+        return Result;
+    }
+
+    const FBatchExpansion& Batch = ExpandBatch(*Recipe);
+    if (Batch.bScalable)
+    {
+        const int32 Batches = FMath::DivideAndRoundUp(Quantity, Recipe->OutputQuantity);
+        Result.Reserve(Batch.Materials.Num());
+        for (const FRecipeMaterial& Material : Batch.Materials)
+        {
+            Result.Emplace(Material.Key, Material.Value * Batches);
+        }
+        return Result;
+    }
+
+    // 下位に複数個できるレシピがあると端数の切り上げが製作回数に比例しないので、その都度展開する
+    TMap<FSimItemId, int32> Materials;
+    TArray<FSimItemId> Path;
+    bool bScalable = true;
+    ExpandInto(ItemId, Quantity, Materials, Path, bScalable);
+
+    Result.Reserve(Materials.Num());
+    for (const TPair<FSimItemId, int32>& Material : Materials)
+    {
+        Result.Emplace(Material.Key, Material.Value);
+    }
+
+    return Result;
+}
+
+const FRecipeGraph::FBatchExpansion& FRecipeGraph::ExpandBatch(const FRecipeNode& Recipe) const
+{
+    if (const FBatchExpansion* Cached = Expansions.Find(Recipe.OutputItemId))
+    {
+        return *Cached;
+    }
+
+    TMap<FSimItemId, int32> Materials;
+    TArray<FSimItemId> Path;
+    FBatchExpansion Batch;
+    ExpandInto(Recipe.OutputItemId, Recipe.OutputQuantity, Materials, Path, Batch.bScalable);
+
+    Batch.Materials.Reserve(Materials.Num());
+    for (const TPair<FSimItemId, int32>& Material : Materials)
+    {
+        Batch.Materials.Emplace(Material.Key, Material.Value);
+    }
+
+    return Expansions.Add(Recipe.OutputItemId, MoveTemp(Batch));
+}
+
+void FRecipeGraph::Invalidate()
+{
+    ++Version;
+    Expansions.Reset();
+}
+
+void FRecipeGraph::ExpandInto(FSimItemId ItemId, int32 Quantity, TMap<FSimItemId, int32>& OutMaterials, TArray<FSimItemId>& Path,
+                              bool& bOutScalable) const
+{
+    if (Quantity <= 0)
+    {
+        return;
+    }
+
+    // 作れないアイテムと、循環しているレシピの途中のアイテムは原材料として扱う
+    const FRecipeNode* Recipe = FindAvailableRecipe(ItemId);
+    if (!Recipe || Path.Contains(ItemId))
+    {
+        OutMaterials.FindOrAdd(ItemId) += Quantity;
+        return;
+    }
+
+    const int32 Batches = FMath::DivideAndRoundUp(Quantity, Recipe->OutputQuantity);
+    if (Path.Num() > 0 && Recipe->OutputQuantity > 1)
+    {
+        bOutScalable = false;
+    }
+
+    Path.Push(ItemId);
+    for (const FRecipeMaterial& Input : Recipe->Inputs)
+    {
+        ExpandInto(Input.Key, Input.Value * Batches, OutMaterials, Path, bOutScalable);
+    }
+    Path.Pop();
+}
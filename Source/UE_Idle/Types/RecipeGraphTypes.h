@@ -0,0 +1,89 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SimIdTypes.h"
+
+// 原材料要件（アイテムID, 個数）
+using FRecipeMaterial = TPair<FSimItemId, int32>;
+
+/**
+ * レシピの依存関係グラフ
+ * 完成品を、中間素材のレシピを辿って「原材料（作れるレシピがない素材）」の必要数まで展開する
+ * 展開結果は完成品ごとに1回分の製作（OutputQuantity個）だけ記憶し、製作回数倍して再利用する
+ * 記憶する件数はレシピの数までで、レシピ構成や施設でアンロックされたレシピ集合が変わったときだけ破棄する
+ */
+class UE_IDLE_API FRecipeGraph
+{
+public:
+    struct FRecipeNode
+    {
+        FSimItemId RecipeId;
+        FSimItemId OutputItemId;
+
+        // 1回の製作でできる個数
+        int32 OutputQuantity = 1;
+
+        // 1回の製作に使う材料
+        TArray<FRecipeMaterial> Inputs;
+
+        // 施設のUnlockRecipe効果でアンロックされるまで使えない
+        bool bRequiresUnlock = false;
+    };
+
+    /** レシピを登録する（同じ完成品のレシピは上書き） */
+    void AddRecipe(const FString& RecipeId, const FString& OutputItemId, int32 OutputQuantity,
+                   const TMap<FString, int32>& Inputs, bool bRequiresUnlock);
+
+    void Reset();
+
+    /**
+     * アンロック済みレシピ集合を反映する。集合が変わったときだけ展開結果を破棄する
+     * @return 集合が変わったか
+     */
+    bool SetUnlockedRecipes(const TArray<FString>& UnlockedRecipeIds);
+
+    /** 完成品を作れるレシピ（未登録・未アンロックはnullptr） */
+    const FRecipeNode* FindAvailableRecipe(FSimItemId ItemId) const;
+
+    bool HasRecipe(FSimItemId ItemId) const { return RecipeIndexByOutput.Contains(ItemId); }
+
+    /**
+     * Quantity個の完成品に必要な原材料
+     * 作れるレシピがないアイテムはそれ自体が原材料になる
+     */
+    TArray<FRecipeMaterial> Expand(FSimItemId ItemId, int32 Quantity) const;
+
+    /** レシピ構成かアンロック状態が変わるたびに増える（展開結果を使う側のキャッシュ無効化用） */
+    uint32 GetVersion() const { return Version; }
+
+    int32 GetCachedExpansionCount() const { return Expansions.Num(); }
+
+private:
+    void Invalidate();
+
+    // 1回分の製作の展開結果
+    struct FBatchExpansion
+    {
+        TArray<FRecipeMaterial> Materials;
+
+        // 下位の中間素材がすべて1個ずつ作れる（製作回数倍しても端数の切り上げが変わらない）
+        bool bScalable = true;
+    };
+
+    const FBatchExpansion& ExpandBatch(const FRecipeNode& Recipe) const;
+
+    void ExpandInto(FSimItemId ItemId, int32 Quantity, TMap<FSimItemId, int32>& OutMaterials, TArray<FSimItemId>& Path,
+                    bool& bOutScalable) const;
+
+    TArray<FRecipeNode> Recipes;
+
+    // 完成品 → Recipesの添字
+    TMap<FSimItemId, int32> RecipeIndexByOutput;
+
+    TSet<FSimItemId> UnlockedRecipes;
+
+    uint32 Version = 0;
+
+    // 完成品 → 1回分の製作に必要な原材料
+    mutable TMap<FSimItemId, FBatchExpansion> Expansions;
+};
@@ -0,0 +1,225 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TaskTypes.h"
+#include "TeamTypes.h"
+#include "CharacterTypes.h"
+#include "ItemTypes.h"
+#include "FacilityDataTable.h"
+#include "ReplayTypes.generated.h"
+
+// 記録対象のプレイヤー操作
+UENUM(BlueprintType)
+enum class EIdleReplayCommandType : uint8
+{
+    CreateTeam                  UMETA(DisplayName = "チーム作成"),
+    AssignCharacterToTeam       UMETA(DisplayName = "メンバー割り当て"),
+    SetTeamTask                 UMETA(DisplayName = "チームタスク設定"),
+    AddTeamTask                 UMETA(DisplayName = "チームタスク追加"),
+    RemoveTeamTask              UMETA(DisplayName = "チームタスク削除"),
+    AddGlobalTask               UMETA(DisplayName = "グローバルタスク追加"),
+    RemoveGlobalTask            UMETA(DisplayName = "グローバルタスク削除"),
+    PlanFacility                UMETA(DisplayName = "施設計画"),
+    StartFacilityConstruction   UMETA(DisplayName = "施設建設開始")
+};
+
+// 1件のプレイヤー操作（ターン番号付き）
+USTRUCT(BlueprintType)
+struct FIdleReplayCommand
+{
+    GENERATED_BODY()
+
+    // 操作が行われたターン（そのターンの処理後、次のターンの前に適用）
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    int32 Turn = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    EIdleReplayCommandType CommandType = EIdleReplayCommandType::CreateTeam;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    int32 TeamIndex = -1;
+
+    // グローバルタスクのインデックス / チームタスクの優先度
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    int32 Index = -1;
+
+    // チーム名 / キャラクター名 / 施設ID
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    FString Name;
+
+    // 対象キャラクターの安定ID（AC_IdleCharacter::CharacterId）
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    FGuid CharacterId;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    ETaskType TaskType = ETaskType::Idle;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    FTeamTask TeamTask;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    FGlobalTask GlobalTask;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    FVector Location = FVector::ZeroVector;
+
+    // 記録時の施設インスタンスID（再生時は新しいIDに読み替える）
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    FGuid FacilityInstanceId;
+};
+
+// 記録開始時のキャラクター1人分の状態
+USTRUCT(BlueprintType)
+struct FIdleReplayCharacterState
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    FGuid CharacterId;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    FString CharacterName;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    FCharacterTalent Talent;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    FCharacterStatus Status;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    ESpecialtyType SpecialtyType = ESpecialtyType::Baseball;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    TMap<FString, int32> Items;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    TMap<EEquipmentSlot, FString> EquippedItems;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    int32 Money = 0;
+};
+
+// 記録開始時のチーム1つ分の状態
+USTRUCT(BlueprintType)
+struct FIdleReplayTeamState
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    FString TeamName;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    ETaskType AssignedTask = ETaskType::Idle;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    FString AdventureLocationId;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    FString GatheringLocationId;
+
+    // 滞在中の場所（移動中だったチームは出発地に置く）
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    FString CurrentLocationId;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    TArray<FGuid> MemberIds;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    TArray<FTeamTask> Tasks;
+};
+
+// 記録開始時のワールド状態（再生前にこの状態へ戻す）
+USTRUCT(BlueprintType)
+struct FIdleReplayWorldSnapshot
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    bool bCaptured = false;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    int32 Turn = 0;
+
+    // プレイヤーキャラクター（チーム未所属も含む）
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    TArray<FIdleReplayCharacterState> Characters;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    TArray<FIdleReplayTeamState> Teams;
+
+    // 拠点倉庫
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    TMap<FString, int32> BaseItems;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    int32 BaseMoney = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    TArray<FGlobalTask> GlobalTasks;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    TArray<FFacilityInstance> Facilities;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    int32 Population = 0;
+};
+
+// 1セッション分の記録
+USTRUCT(BlueprintType)
+struct FIdleReplayRecording
+{
+    GENERATED_BODY()
+
+    // 2: 開始時のワールド状態を含む
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    int32 Version = 2;
+
+    // 記録開始時のシミュレーション乱数シード
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    int64 Seed = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    int32 StartTurn = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    int32 EndTurn = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    FIdleReplayWorldSnapshot InitialState;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    TArray<FIdleReplayCommand> Commands;
+};
+
+// 再生ベンチマーク結果
+USTRUCT(BlueprintType)
+struct FIdleReplayBenchmarkResult
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    int32 SimulatedTurns = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    float ElapsedSeconds = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    float TurnsPerSecond = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    int32 CommandsApplied = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    int32 CommandsFailed = 0;
+
+    // 再生前後の使用物理メモリ（MB）
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    float UsedMemoryBeforeMB = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    float UsedMemoryAfterMB = 0.0f;
+
+    // プロセスのピーク物理メモリ（MB）
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    float PeakMemoryMB = 0.0f;
+};
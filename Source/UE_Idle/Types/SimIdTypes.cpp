@@ -0,0 +1,59 @@
+#include "SimIdTypes.h"
+
+int32 FSimIdRegistry::Intern(const FString& Id)
+{
+    if (Id.IsEmpty())
+    {
+        return INDEX_NONE;
+    }
+
+    {
+        FReadScopeLock ReadLock(Lock);
+        if (const int32* Found = Indices.Find(Id))
+        {
+            return *Found;
+        }
+    }
+
+    FWriteScopeLock WriteLock(Lock);
+    if (const int32* Found = Indices.Find(Id))
+    {
+        return *Found; // ロック待ちの間に他から登録された
+    }
+
+    const int32 NewIndex = Strings.Add(MakeUnique<FString>(Id));
+    Indices.Add(Id, NewIndex);
+    return NewIndex;
+}
+
+int32 FSimIdRegistry::Find(const FString& Id) const
+{
+    if (Id.IsEmpty())
+    {
+        return INDEX_NONE;
+    }
+
+    FReadScopeLock ReadLock(Lock);
+    const int32* Found = Indices.Find(Id);
+    return Found ? *Found : INDEX_NONE;
+}
+
+const FString& FSimIdRegistry::GetString(int32 Index) const
+{
+    static const FString EmptyString;
+
+    FReadScopeLock ReadLock(Lock);
+    return Strings.IsValidIndex(Index) ? *Strings[Index] : EmptyString;
+}
+
+int32 FSimIdRegistry::Num() const
+{
+    FReadScopeLock ReadLock(Lock);
+    return Strings.Num();
+}
+
+FSimIdRegistry& FSimIdRegistry::Get(ESimIdKind Kind)
+{
+    static FSimIdRegistry Registries[static_cast<int32>(ESimIdKind::Count)];
+    return Registries[static_cast<int32>(Kind)];
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/ScopeRWLock.h"
+#include "Templates/UniquePtr.h"
+
+// IDの種類（種類ごとに別の番号空間を持つ）
+enum class ESimIdKind : uint8
+{
+    Item,
+    Location,
+    Count
+};
+
+/**
+ * ID文字列 ⇔ 番号の登録表
+ * 登録はデータ読み込み時やタスク追加時（ゲームスレッド）、参照は判断フェーズのワーカーからも行うため読み書きロックで保護する
+ * 登録した文字列は解放・移動しないので、GetStringの参照はプロセス終了まで有効
+ * 登録表はプロセス全体で1つ（PIEの各ワールドでも共有）なので、DataTable由来の有限なIDだけを登録する
+ * 実行中に生成されるID（タスクIDなど）は登録すると表が増え続けるので対象にしない
+ */
+class UE_IDLE_API FSimIdRegistry
+{
+public:
+    /** 番号を返す（未登録なら登録する）。空文字列はINDEX_NONE */
+    int32 Intern(const FString& Id);
+
+    /** 登録済みの番号を返す（未登録はINDEX_NONE） */
+    int32 Find(const FString& Id) const;
+
+    /** 番号から文字列（不明な番号は空文字列） */
+    const FString& GetString(int32 Index) const;
+
+    int32 Num() const;
+
+    static FSimIdRegistry& Get(ESimIdKind Kind);
+
+private:
+    mutable FRWLock Lock;
+    TMap<FString, int32> Indices;
+    TArray<TUniquePtr<FString>> Strings;
+};
+
+/**
+ * シミュレーション内部で使う文字列IDの整数ハンドル
+ * アイテム・場所のIDを一度だけ登録し、以降は32bitの番号で比較・ハッシュする
+ * 種類ごとに別の型にして取り違えを防ぐ（FSimItemId / FSimLocationId）
+ * Blueprint・DataTable・セーブデータは従来通りFString/FNameを使い、境界で変換する
+ */
+template<ESimIdKind Kind>
+struct TSimId
+{
+    TSimId() = default;
+
+    /** 登録済みのIDを返す（未登録なら登録する） */
+    static TSimId Intern(const FString& Id) { return TSimId(FSimIdRegistry::Get(Kind).Intern(Id)); }
+    static TSimId Intern(FName Id) { return Intern(Id.ToString()); }
+
+    /** 登録済みのIDを返す（未登録なら無効なID。参照だけの経路で表を増やさない） */
+    static TSimId Find(const FString& Id) { return TSimId(FSimIdRegistry::Get(Kind).Find(Id)); }
+
+    /** 番号から復元（ID番号で引く配列の走査用） */
+    static TSimId FromIndex(int32 InIndex) { return TSimId(InIndex); }
+
+    /** 登録済みのID数（ID番号で引く配列の大きさ） */
+    static int32 NumRegistered() { return FSimIdRegistry::Get(Kind).Num(); }
+
+    bool IsValid() const { return Index != INDEX_NONE; }
+    int32 GetIndex() const { return Index; }
+
+    const FString& ToString() const { return FSimIdRegistry::Get(Kind).GetString(Index); }
+    FName ToName() const { return FName(*ToString()); }
+
+    bool operator==(TSimId Other) const { return Index == Other.Index; }
+    bool operator!=(TSimId Other) const { return Index != Other.Index; }
+
+    friend uint32 GetTypeHash(TSimId Id) { return ::GetTypeHash(Id.Index); }
+
+private:
+    explicit TSimId(int32 InIndex) : Index(InIndex) {}
+
+    int32 Index = INDEX_NONE;
+};
+
+using FSimItemId = TSimId<ESimIdKind::Item>;
+using FSimLocationId = TSimId<ESimIdKind::Location>;
@@ -0,0 +1,26 @@
+#include "SimulationRandomTypes.h"
+
+FIdleRandomStream FIdleRandomStream::Make(uint64 Seed, EIdleRandomDomain Domain, int32 Turn, uint64 EntityKey, uint64 SubKey)
+{
+    // 各要素を順に混ぜ込み、どれか1つでも違えば無相関なキーになるようにする
+    uint64 StreamKey = Mix(Seed);
+    StreamKey = Mix(StreamKey ^ static_cast<uint64>(Domain));
+    StreamKey = Mix(StreamKey ^ static_cast<uint64>(static_cast<uint32>(Turn)));
+    StreamKey = Mix(StreamKey ^ EntityKey);
+    StreamKey = Mix(StreamKey ^ SubKey);
+    return FIdleRandomStream(StreamKey);
+}
+
+FIdleRandomStream FIdleRandomStream::MakeNondeterministic()
+{
+    const uint64 Random = (static_cast<uint64>(FMath::Rand()) << 32) ^ static_cast<uint64>(FMath::Rand()) ^ FPlatformTime::Cycles64();
+    return FIdleRandomStream(Mix(Random));
+}
+
+uint64 FIdleRandomStream::Mix(uint64 Value)
+{
+    Value += 0x9E3779B97F4A7C15ull;
+    Value = (Value ^ (Value >> 30)) * 0xBF58476D1CE4E5B9ull;
+    Value = (Value ^ (Value >> 27)) * 0x94D049BB133111EBull;
+    return Value ^ (Value >> 31);
+}
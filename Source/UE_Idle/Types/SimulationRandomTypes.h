@@ -0,0 +1,82 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SimulationRandomTypes.generated.h"
+
+// 乱数ストリームの用途（同じターン・同じエンティティでも用途ごとに独立した系列になる）
+UENUM(BlueprintType)
+enum class EIdleRandomDomain : uint8
+{
+    Combat                  UMETA(DisplayName = "戦闘判定"),
+    CharacterGeneration     UMETA(DisplayName = "キャラクター生成"),
+    EnemySpawn              UMETA(DisplayName = "敵出現"),
+    TaskPlanning            UMETA(DisplayName = "タスク計画"),
+    MapGeneration           UMETA(DisplayName = "マップ生成")
+};
+
+/**
+ * カウンターベースの乱数ストリーム
+ * (シード, 用途, ターン, エンティティ, サブキー) から決まるキーと呼び出し回数だけで値が決まり、
+ * 共有状態を持たないため並列評価でも競合せず、同じシードなら常に同じ系列を再現できる
+ */
+struct UE_IDLE_API FIdleRandomStream
+{
+public:
+    FIdleRandomStream() = default;
+    explicit FIdleRandomStream(uint64 InKey) : Key(InKey) {}
+
+    /** キー指定でストリーム生成 */
+    static FIdleRandomStream Make(uint64 Seed, EIdleRandomDomain Domain, int32 Turn, uint64 EntityKey, uint64 SubKey = 0);
+
+    /** グローバル乱数から生成（再現性不要なBlueprint互換API用） */
+    static FIdleRandomStream MakeNondeterministic();
+
+    /** 64bitミキサー（SplitMix64の最終段） */
+    static uint64 Mix(uint64 Value);
+
+    uint32 NextUInt32()
+    {
+        Counter++;
+        return static_cast<uint32>(Mix(Key + Counter * 0x9E3779B97F4A7C15ull) >> 32);
+    }
+
+    /** [0, 1) の一様乱数 */
+    float FRand()
+    {
+        return (NextUInt32() >> 8) * (1.0f / 16777216.0f);
+    }
+
+    /** [Min, Max] の整数乱数（FMath::RandRangeと同じ範囲） */
+    int32 RandRange(int32 Min, int32 Max)
+    {
+        const int64 Range = static_cast<int64>(Max) - Min + 1;
+        if (Range <= 0)
+        {
+            return Min;
+        }
+        return Min + static_cast<int32>((static_cast<uint64>(NextUInt32()) * static_cast<uint64>(Range)) >> 32);
+    }
+
+    /** [Min, Max) の実数乱数 */
+    float FRandRange(float Min, float Max)
+    {
+        return Min + (Max - Min) * FRand();
+    }
+
+    /** 系列から決まるGUID（生成したエンティティの安定IDに使う） */
+    FGuid NextGuid()
+    {
+        const uint32 A = NextUInt32();
+        const uint32 B = NextUInt32();
+        const uint32 C = NextUInt32();
+        const uint32 D = NextUInt32();
+        return FGuid(A, B, C, D);
+    }
+
+    uint64 GetKey() const { return Key; }
+    uint64 GetCounter() const { return Counter; }
+
+private:
+    uint64 Key = 0;
+    uint64 Counter = 0;
+};
@@ -0,0 +1,119 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TaskAllocationTypes.generated.h"
+
+// 「全て」モード割り当てのコスト重み
+USTRUCT(BlueprintType)
+struct FTaskAllocationWeights
+{
+    GENERATED_BODY()
+
+    // 優先度順位が1つ下がるごとのコスト
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Task Allocation")
+    float PriorityWeight = 10.0f;
+
+    // 移動距離1あたりのコスト（距離は拠点からの距離の差）
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Task Allocation")
+    float TravelWeight = 0.1f;
+
+    // 1ターンあたりの見込み採集量1あたりの減算（採集力が高いチームほど採集タスクに向く）
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Task Allocation")
+    float YieldWeight = 5.0f;
+};
+
+// 作業場所の候補
+struct FTaskAllocationSite
+{
+    FString LocationId;
+
+    // 拠点からの距離
+    float DistanceFromBase = 0.0f;
+
+    // 採取係数（採集以外は0）
+    float GatheringCoefficient = 0.0f;
+};
+
+// 割り当て候補のタスク
+struct FTaskAllocationCandidate
+{
+    // GlobalTasksの添字とID
+    int32 TaskIndex = INDEX_NONE;
+    FString TaskId;
+
+    // 優先度順での位置（0が最優先）
+    int32 PriorityPosition = 0;
+
+    // 作業できる場所（空なら場所を問わない）
+    TArray<FTaskAllocationSite> Sites;
+};
+
+// 割り当て対象のチーム
+struct FTaskAllocationTeam
+{
+    int32 TeamIndex = INDEX_NONE;
+
+    // 現在の拠点からの距離
+    float DistanceFromBase = 0.0f;
+
+    // メンバーの採集力合計
+    float GatheringPower = 0.0f;
+};
+
+// チームへのタスク割り当て結果
+USTRUCT(BlueprintType)
+struct FTeamTaskAllocation
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Task Allocation")
+    int32 TeamIndex = INDEX_NONE;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Task Allocation")
+    FString TaskId;
+
+    // 作業場所（場所を問わないタスクは空）
+    UPROPERTY(BlueprintReadOnly, Category = "Task Allocation")
+    FString LocationId;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Task Allocation")
+    float Cost = 0.0f;
+};
+
+// 割り当てソルバーのベンチマーク結果
+USTRUCT(BlueprintType)
+struct FTaskAllocationBenchmarkResult
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Task Allocation")
+    int32 TeamCount = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Task Allocation")
+    int32 TaskCount = 0;
+
+    // コスト行列の構築時間（ミリ秒）
+    UPROPERTY(BlueprintReadOnly, Category = "Task Allocation")
+    float BuildMatrixMs = 0.0f;
+
+    // 一括割り当ての求解時間（ミリ秒）
+    UPROPERTY(BlueprintReadOnly, Category = "Task Allocation")
+    float SolveMs = 0.0f;
+
+    // 比較用：チームごとの貪欲選択の時間（ミリ秒）
+    UPROPERTY(BlueprintReadOnly, Category = "Task Allocation")
+    float GreedyMs = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Task Allocation")
+    float TotalCost = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Task Allocation")
+    float GreedyTotalCost = 0.0f;
+
+    // 割り当てられた異なるタスクの数（貪欲選択は同じタスクに集中しやすい）
+    UPROPERTY(BlueprintReadOnly, Category = "Task Allocation")
+    int32 DistinctTasks = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Task Allocation")
+    int32 GreedyDistinctTasks = 0;
+};
@@ -0,0 +1,68 @@
+#include "TaskIndexTypes.h"
+
+namespace
+{
+    const TArray<int32> EmptyTaskList;
+}
+
+void FGlobalTaskIndex::Rebuild(const TArray<FGlobalTask>& Tasks)
+{
+    Reset();
+
+    PriorityOrder.Reserve(Tasks.Num());
+    for (int32 TaskIndex = 0; TaskIndex < Tasks.Num(); ++TaskIndex)
+    {
+        PriorityOrder.Add(TaskIndex);
+    }
+
+    // 優先度が高い（数値が小さい）順、同じ優先度は配列順で安定させる
+    PriorityOrder.Sort([&Tasks](int32 A, int32 B)
+    {
+        return Tasks[A].Priority != Tasks[B].Priority ? Tasks[A].Priority < Tasks[B].Priority : A < B;
+    });
+
+    PriorityPositions.SetNumUninitialized(Tasks.Num());
+    TaskIdToIndex.Reserve(Tasks.Num());
+    for (int32 Position = 0; Position < PriorityOrder.Num(); ++Position)
+    {
+        const int32 TaskIndex = PriorityOrder[Position];
+        const FGlobalTask& Task = Tasks[TaskIndex];
+
+        PriorityPositions[TaskIndex] = Position;
+        TasksByItem.FindOrAdd(FSimItemId::Intern(Task.TargetItemId)).Add(TaskIndex);
+        TasksByType.FindOrAdd(Task.TaskType).Add(TaskIndex);
+        TaskIdToIndex.Add(Task.TaskId, TaskIndex);
+    }
+}
+
+void FGlobalTaskIndex::Reset()
+{
+    PriorityOrder.Reset();
+    PriorityPositions.Reset();
+    TasksByItem.Reset();
+    TasksByType.Reset();
+    TaskIdToIndex.Reset();
+}
+
+int32 FGlobalTaskIndex::GetPriorityPosition(int32 TaskIndex) const
+{
+    return PriorityPositions.IsValidIndex(TaskIndex) ? PriorityPositions[TaskIndex] : INDEX_NONE;
+}
+
+const TArray<int32>& FGlobalTaskIndex::GetTasksForItem(FSimItemId ItemId) const
+{
+    const TArray<int32>* Found = TasksByItem.Find(ItemId);
+    return Found ? *Found : EmptyTaskList;
+}
+
+const TArray<int32>& FGlobalTaskIndex::GetTasksOfType(ETaskType TaskType) const
+{
+    const TArray<int32>* Found = TasksByType.Find(TaskType);
+    return Found ? *Found : EmptyTaskList;
+}
+
+int32 FGlobalTaskIndex::FindTaskIndex(const FString& TaskId) const
+{
+    const int32* Found = TaskIdToIndex.Find(TaskId);
+    return Found ? *Found : INDEX_NONE;
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TaskTypes.h"
+#include "SimIdTypes.h"
+
+/**
+ * 全体タスクの優先度順インデックス
+ * GlobalTasks配列への添字を優先度順（同じ優先度は配列順）で保持する
+ * 対象アイテム別・タスクタイプ別・タスクID別の副インデックスも同じ順序で持つため、
+ * 検索のたびに配列をコピーしてソートする必要がない
+ * タスク配列の追加・削除・優先度変更の後にRebuildで更新する
+ */
+class UE_IDLE_API FGlobalTaskIndex
+{
+public:
+    /** タスク配列からインデックスを作り直す */
+    void Rebuild(const TArray<FGlobalTask>& Tasks);
+
+    void Reset();
+
+    /** 優先度順のタスク添字 */
+    const TArray<int32>& GetPriorityOrder() const { return PriorityOrder; }
+
+    /** タスク添字の優先度順での位置（不明はINDEX_NONE） */
+    int32 GetPriorityPosition(int32 TaskIndex) const;
+
+    /** 対象アイテムが一致するタスク添字（優先度順） */
+    const TArray<int32>& GetTasksForItem(const FString& ItemId) const { return GetTasksForItem(FSimItemId::Find(ItemId)); }
+    const TArray<int32>& GetTasksForItem(FSimItemId ItemId) const;
+
+    /** タスクタイプが一致するタスク添字（優先度順） */
+    const TArray<int32>& GetTasksOfType(ETaskType TaskType) const;
+
+    /** タスクIDからの添字（不明はINDEX_NONE） */
+    int32 FindTaskIndex(const FString& TaskId) const;
+
+    int32 Num() const { return PriorityOrder.Num(); }
+
+private:
+    TArray<int32> PriorityOrder;
+
+    // タスク添字 → 優先度順での位置
+    TArray<int32> PriorityPositions;
+
+    TMap<FSimItemId, TArray<int32>> TasksByItem;
+    TMap<ETaskType, TArray<int32>> TasksByType;
+
+    // タスクIDは追加のたびに生成されるのでID登録表には載せず、文字列のまま引く
+    TMap<FString, int32> TaskIdToIndex;
+};
@@ -0,0 +1,19 @@
+#include "TeamDecisionCacheTypes.h"
+
+const FString* FTeamDecisionCache::Find(int32 TeamIndex, const FString& LocationId, const FTeamDecisionVersions& Versions) const
+{
+    const FEntry* Entry = Entries.Find(TPair<int32, FSimLocationId>(TeamIndex, FSimLocationId::Find(LocationId)));
+    if (!Entry || !(Entry->Versions == Versions))
+    {
+        return nullptr;
+    }
+
+    return &Entry->TargetItem;
+}
+
+void FTeamDecisionCache::Store(int32 TeamIndex, const FString& LocationId, const FTeamDecisionVersions& Versions, const FString& TargetItem)
+{
+    FEntry& Entry = Entries.FindOrAdd(TPair<int32, FSimLocationId>(TeamIndex, FSimLocationId::Intern(LocationId)));
+    Entry.Versions = Versions;
+    Entry.TargetItem = TargetItem;
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SimIdTypes.h"
+
+/**
+ * チーム目標アイテム判定の依存バージョン
+ * いずれかが変わった時点で、それ以前の判定結果は使えない
+ */
+struct FTeamDecisionVersions
+{
+    // 全体タスク集合（追加・削除・優先度・完了状態）
+    uint32 TaskSet = 0;
+
+    // チーム構成とチームタスク
+    uint32 TeamState = 0;
+
+    // 判定に関わる資源（タスク要件）の合計在庫
+    uint32 Inventory = 0;
+
+    // タスク要件の展開元となるレシピグラフ
+    uint32 Recipes = 0;
+
+    // 「全て」モードの割り当て
+    uint32 Allocation = 0;
+
+    bool operator==(const FTeamDecisionVersions& Other) const
+    {
+        return TaskSet == Other.TaskSet && TeamState == Other.TeamState && Inventory == Other.Inventory
+            && Recipes == Other.Recipes && Allocation == Other.Allocation;
+    }
+};
+
+/**
+ * (チーム, 場所) ごとの目標アイテム判定キャッシュ
+ * 同じターンに同じチームのメンバーが何度問い合わせても判定は1回で済む
+ * ゲームスレッド専用（判断フェーズのワーカーからは使わない）
+ */
+class UE_IDLE_API FTeamDecisionCache
+{
+public:
+    /** バージョンが一致する判定結果を返す（なければnullptr） */
+    const FString* Find(int32 TeamIndex, const FString& LocationId, const FTeamDecisionVersions& Versions) const;
+
+    void Store(int32 TeamIndex, const FString& LocationId, const FTeamDecisionVersions& Versions, const FString& TargetItem);
+
+    void Reset() { Entries.Reset(); }
+
+    int32 Num() const { return Entries.Num(); }
+
+private:
+    struct FEntry
+    {
+        FTeamDecisionVersions Versions;
+        FString TargetItem;
+    };
+
+    TMap<TPair<int32, FSimLocationId>, FEntry> Entries;
+};
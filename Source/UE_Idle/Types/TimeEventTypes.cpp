@@ -0,0 +1,88 @@
+#include "TimeEventTypes.h"
+
+int64 FIdleEventQueue::Schedule(int32 Turn, EIdleTimeEventType Type, TFunction<void()>&& Callback)
+{
+    FEntry Entry;
+    Entry.Turn = Turn;
+    Entry.EventId = NextEventId++;
+    Entry.Type = Type;
+
+    Callbacks.Add(Entry.EventId, MoveTemp(Callback));
+    Heap.HeapPush(Entry);
+
+    return Entry.EventId;
+}
+
+bool FIdleEventQueue::Cancel(int64 EventId)
+{
+    if (Callbacks.Remove(EventId) == 0)
+    {
+        return false;
+    }
+
+    PruneCancelled();
+    return true;
+}
+
+int32 FIdleEventQueue::DispatchDueEvents(int32 CurrentTurn)
+{
+    int32 DispatchedCount = 0;
+
+    while (Heap.Num() > 0 && Heap[0].Turn <= CurrentTurn)
+    {
+        FEntry Entry;
+        Heap.HeapPop(Entry, EAllowShrinking::No);
+
+        TFunction<void()> Callback;
+        if (Callbacks.RemoveAndCopyValue(Entry.EventId, Callback))
+        {
+            // コールバック内で新しいイベントが予約されても良い
+            if (Callback)
+            {
+                Callback();
+            }
+            DispatchedCount++;
+        }
+
+        PruneCancelled();
+    }
+
+    return DispatchedCount;
+}
+
+int32 FIdleEventQueue::NumOfType(EIdleTimeEventType Type) const
+{
+    int32 Count = 0;
+    for (const FEntry& Entry : Heap)
+    {
+        if (Entry.Type == Type && Callbacks.Contains(Entry.EventId))
+        {
+            Count++;
+        }
+    }
+    return Count;
+}
+
+void FIdleEventQueue::ShiftTurns(int32 DeltaTurns)
+{
+    // 一律にずらすだけなのでヒープ順序はそのまま
+    for (FEntry& Entry : Heap)
+    {
+        Entry.Turn += DeltaTurns;
+    }
+}
+
+void FIdleEventQueue::Reset()
+{
+    Heap.Empty();
+    Callbacks.Empty();
+}
+
+void FIdleEventQueue::PruneCancelled()
+{
+    while (Heap.Num() > 0 && !Callbacks.Contains(Heap[0].EventId))
+    {
+        FEntry Discarded;
+        Heap.HeapPop(Discarded, EAllowShrinking::No);
+    }
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TimeEventTypes.generated.h"
+
+// ターン時計上で予約されるイベントの種類
+UENUM(BlueprintType)
+enum class EIdleTimeEventType : uint8
+{
+    MovementArrival         UMETA(DisplayName = "移動到着"),
+    ModifierExpiry          UMETA(DisplayName = "時限効果終了"),
+    CombatEnd               UMETA(DisplayName = "戦闘終了"),
+
+    // 追加イベントタイプ（将来実装用）
+    GatheringYield          UMETA(DisplayName = "採集収穫"),
+    ConstructionComplete    UMETA(DisplayName = "建設完了")
+};
+
+/**
+ * 離散イベントキュー（ターン番号順の優先度付きキュー）
+ * 同じターンのイベントは予約順に実行される
+ * キャンセルはコールバックを外すだけで、ヒープ先頭に来た時点で破棄する
+ */
+class UE_IDLE_API FIdleEventQueue
+{
+public:
+    /** イベント予約。戻り値のIDでキャンセルできる */
+    int64 Schedule(int32 Turn, EIdleTimeEventType Type, TFunction<void()>&& Callback);
+
+    /** 予約取り消し（実行済み・不明なIDはfalse） */
+    bool Cancel(int64 EventId);
+
+    /** 指定ターン以前のイベントを全て実行し、実行数を返す */
+    int32 DispatchDueEvents(int32 CurrentTurn);
+
+    /** 次のイベントのターン（なければINDEX_NONE） */
+    int32 GetNextEventTurn() const { return Heap.Num() > 0 ? Heap[0].Turn : INDEX_NONE; }
+
+    /** 待機中のイベント数 */
+    int32 Num() const { return Callbacks.Num(); }
+
+    /** 種類別の待機中イベント数 */
+    int32 NumOfType(EIdleTimeEventType Type) const;
+
+    /** 全イベントのターンをずらす（ターン番号の巻き戻し・復元用。順序は変わらない） */
+    void ShiftTurns(int32 DeltaTurns);
+
+    void Reset();
+
+private:
+    struct FEntry
+    {
+        int32 Turn = 0;
+        int64 EventId = 0;
+        EIdleTimeEventType Type = EIdleTimeEventType::MovementArrival;
+
+        bool operator<(const FEntry& Other) const
+        {
+            return Turn != Other.Turn ? Turn < Other.Turn : EventId < Other.EventId;
+        }
+    };
+
+    /** ヒープ先頭のキャンセル済みエントリを取り除く */
+    void PruneCancelled();
+
+    TArray<FEntry> Heap;
+    TMap<int64, TFunction<void()>> Callbacks;
+    int64 NextEventId = 1;
+};
@@ -4,3 +4,73 @@
 #include "Modules/ModuleManager.h"
 
 IMPLEMENT_PRIMARY_GAME_MODULE( FDefaultGameModuleImpl, UE_Idle, "UE_Idle" );
+
+// シミュレーション用ログカテゴリ
+DEFINE_LOG_CATEGORY(LogIdleTime);
+DEFINE_LOG_CATEGORY(LogIdleTask);
+DEFINE_LOG_CATEGORY(LogIdleInventory);
+DEFINE_LOG_CATEGORY(LogIdleCombat);
+DEFINE_LOG_CATEGORY(LogIdleAI);
+DEFINE_LOG_CATEGORY(LogIdleSim);
+
+bool IdleLog::SetVerbosity(const FString& CategoryName, ELogVerbosity::Type Verbosity)
+{
+#if NO_LOGGING
+    return false;
+#else
+    FString ShortName = CategoryName;
+    ShortName.RemoveFromStart(TEXT("LogIdle"));
+    
+    struct FCategoryEntry
+    {
+        const TCHAR* Name;
+        FLogCategoryBase* Category;
+    };
+    FCategoryEntry Categories[] =
+    {
+        { TEXT("Time"), &LogIdleTime },
+        { TEXT("Task"), &LogIdleTask },
+        { TEXT("Inventory"), &LogIdleInventory },
+        { TEXT("Combat"), &LogIdleCombat },
+        { TEXT("AI"), &LogIdleAI },
+        { TEXT("Sim"), &LogIdleSim },
+    };
+    
+    const bool bAll = ShortName.Equals(TEXT("All"), ESearchCase::IgnoreCase);
+    bool bFound = false;
+    for (const FCategoryEntry& Entry : Categories)
+    {
+        if (bAll || ShortName.Equals(Entry.Name, ESearchCase::IgnoreCase))
+        {
+            // コンパイル時上限を超える詳細度はSetVerbosity側で切り詰められる
+            Entry.Category->SetVerbosity(Verbosity);
+            bFound = true;
+        }
+    }
+    return bFound;
+#endif
+}
+
+// シミュレーション計測
+DEFINE_STAT(STAT_IdleSim_AdvanceTurn);
+DEFINE_STAT(STAT_IdleSim_EventDispatch);
+DEFINE_STAT(STAT_IdleSim_BrainSnapshot);
+DEFINE_STAT(STAT_IdleSim_BrainDecide);
+DEFINE_STAT(STAT_IdleSim_BrainCommit);
+DEFINE_STAT(STAT_IdleSim_TargetItemForTeam);
+DEFINE_STAT(STAT_IdleSim_ExecutableGatheringTasks);
+DEFINE_STAT(STAT_IdleSim_GatheringStage);
+DEFINE_STAT(STAT_IdleSim_TaskAllocation);
+DEFINE_STAT(STAT_IdleSim_TaskForecast);
+DEFINE_STAT(STAT_IdleSim_InventoryAdd);
+DEFINE_STAT(STAT_IdleSim_InventoryRemove);
+DEFINE_STAT(STAT_IdleSim_InventoryTransfer);
+DEFINE_STAT(STAT_IdleSim_InventoryWeight);
+DEFINE_STAT(STAT_IdleSim_FindPath);
+DEFINE_STAT(STAT_IdleSim_CombatActions);
+DEFINE_STAT(STAT_IdleSim_EventLogAppend);
+DEFINE_STAT(STAT_IdleSim_CharactersProcessed);
+DEFINE_STAT(STAT_IdleSim_PathsComputed);
+DEFINE_STAT(STAT_IdleSim_LogEntries);
+DEFINE_STAT(STAT_IdleSim_TeamDecisionCacheHits);
+DEFINE_STAT(STAT_IdleSim_TeamDecisionCacheMisses);
@@ -3,4 +3,81 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Logging/LogMacros.h"
+
+// ===========================================
+// シミュレーション用ログカテゴリ
+// ===========================================
+
+// コンパイル時の詳細度上限。Shipping/TestではWarning未満のUE_LOGをコードごと除去し、
+// ターン毎の文字列フォーマットのコストをゼロにする
+#ifndef IDLE_SIM_LOG_COMPILE_VERBOSITY
+    #if UE_BUILD_SHIPPING || UE_BUILD_TEST
+        #define IDLE_SIM_LOG_COMPILE_VERBOSITY Warning
+    #else
+        #define IDLE_SIM_LOG_COMPILE_VERBOSITY All
+    #endif
+#endif
+
+// インベントリ重量キャッシュの検証。有効時はGetTotalWeightのたびにDataTableからの全再計算と照合する
+#ifndef IDLE_SIM_VALIDATE_INVENTORY_WEIGHT
+    #define IDLE_SIM_VALIDATE_INVENTORY_WEIGHT UE_BUILD_DEBUG
+#endif
+
+UE_IDLE_API DECLARE_LOG_CATEGORY_EXTERN(LogIdleTime, Log, IDLE_SIM_LOG_COMPILE_VERBOSITY);
+UE_IDLE_API DECLARE_LOG_CATEGORY_EXTERN(LogIdleTask, Log, IDLE_SIM_LOG_COMPILE_VERBOSITY);
+UE_IDLE_API DECLARE_LOG_CATEGORY_EXTERN(LogIdleInventory, Log, IDLE_SIM_LOG_COMPILE_VERBOSITY);
+UE_IDLE_API DECLARE_LOG_CATEGORY_EXTERN(LogIdleCombat, Log, IDLE_SIM_LOG_COMPILE_VERBOSITY);
+UE_IDLE_API DECLARE_LOG_CATEGORY_EXTERN(LogIdleAI, Log, IDLE_SIM_LOG_COMPILE_VERBOSITY);
+UE_IDLE_API DECLARE_LOG_CATEGORY_EXTERN(LogIdleSim, Log, IDLE_SIM_LOG_COMPILE_VERBOSITY);
+
+namespace IdleLog
+{
+    /**
+     * 実行時にカテゴリ別の詳細度を切り替える（デバッグ用）
+     * @param CategoryName "Time" / "Task" / "Inventory" / "Combat" / "AI" / "Sim" / "All"（LogIdle接頭辞は省略可）
+     * @return 該当カテゴリがあればtrue
+     */
+    UE_IDLE_API bool SetVerbosity(const FString& CategoryName, ELogVerbosity::Type Verbosity);
+}
+
+// ===========================================
+// シミュレーション計測（stat IdleSim / Unreal Insights）
+// ===========================================
+
+DECLARE_STATS_GROUP(TEXT("IdleSim"), STATGROUP_IdleSim, STATCAT_Advanced);
+
+// ターンループ
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Advance Turn"), STAT_IdleSim_AdvanceTurn, STATGROUP_IdleSim, UE_IDLE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Event Dispatch"), STAT_IdleSim_EventDispatch, STATGROUP_IdleSim, UE_IDLE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Brain Snapshot"), STAT_IdleSim_BrainSnapshot, STATGROUP_IdleSim, UE_IDLE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Brain Decide"), STAT_IdleSim_BrainDecide, STATGROUP_IdleSim, UE_IDLE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Brain Commit"), STAT_IdleSim_BrainCommit, STATGROUP_IdleSim, UE_IDLE_API);
+
+// タスクマッチング
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Target Item For Team"), STAT_IdleSim_TargetItemForTeam, STATGROUP_IdleSim, UE_IDLE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Executable Gathering Tasks"), STAT_IdleSim_ExecutableGatheringTasks, STATGROUP_IdleSim, UE_IDLE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Gathering Stage"), STAT_IdleSim_GatheringStage, STATGROUP_IdleSim, UE_IDLE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Task Allocation"), STAT_IdleSim_TaskAllocation, STATGROUP_IdleSim, UE_IDLE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Task Forecast"), STAT_IdleSim_TaskForecast, STATGROUP_IdleSim, UE_IDLE_API);
+
+// インベントリ
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Inventory Add"), STAT_IdleSim_InventoryAdd, STATGROUP_IdleSim, UE_IDLE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Inventory Remove"), STAT_IdleSim_InventoryRemove, STATGROUP_IdleSim, UE_IDLE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Inventory Transfer"), STAT_IdleSim_InventoryTransfer, STATGROUP_IdleSim, UE_IDLE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Inventory Weight"), STAT_IdleSim_InventoryWeight, STATGROUP_IdleSim, UE_IDLE_API);
+
+// 経路探索・戦闘・ログ
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Grid FindPath"), STAT_IdleSim_FindPath, STATGROUP_IdleSim, UE_IDLE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Combat ProcessActions"), STAT_IdleSim_CombatActions, STATGROUP_IdleSim, UE_IDLE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Event Log Append"), STAT_IdleSim_EventLogAppend, STATGROUP_IdleSim, UE_IDLE_API);
+
+// ターンごとの件数（ターン開始時にリセット）
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Characters Processed / Turn"), STAT_IdleSim_CharactersProcessed, STATGROUP_IdleSim, UE_IDLE_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Paths Computed / Turn"), STAT_IdleSim_PathsComputed, STATGROUP_IdleSim, UE_IDLE_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Log Entries / Turn"), STAT_IdleSim_LogEntries, STATGROUP_IdleSim, UE_IDLE_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Team Decision Cache Hits / Turn"), STAT_IdleSim_TeamDecisionCacheHits, STATGROUP_IdleSim, UE_IDLE_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Team Decision Cache Misses / Turn"), STAT_IdleSim_TeamDecisionCacheMisses, STATGROUP_IdleSim, UE_IDLE_API);
 
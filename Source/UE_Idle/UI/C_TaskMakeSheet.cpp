@@ -336,7 +336,7 @@ void UC_TaskMakeSheet::InitializeDefaultValues()
     {
         PrioritySpinBox->SetValue(1.0f);
         PrioritySpinBox->SetMinValue(1.0f);
-        PrioritySpinBox->SetMaxValue(20.0f);
+        PrioritySpinBox->SetMaxValue(static_cast<float>(FMath::Max(20, TaskManagerComponent ? TaskManagerComponent->GetTaskCount() + 1 : 0)));
         PrioritySpinBox->SetDelta(1.0f);
     }
 
@@ -628,10 +628,12 @@ bool UC_TaskMakeSheet::ValidateInput(FString& OutErrorMessage) const
         return false;
     }
 
+    // タスク数の上限はないので、末尾への追加まで許可する
     int32 InputPriority = static_cast<int32>(PrioritySpinBox->GetValue());
-    if (InputPriority < 1 || InputPriority > 20)
+    const int32 MaxPriority = FMath::Max(20, TaskManagerComponent ? TaskManagerComponent->GetTaskCount() + 1 : 0);
+    if (InputPriority < 1 || InputPriority > MaxPriority)
     {
-        OutErrorMessage = TEXT("優先度は1-20の範囲で設定してください");
+        OutErrorMessage = FString::Printf(TEXT("優先度は1-%dの範囲で設定してください"), MaxPriority);
         return false;
     }
 